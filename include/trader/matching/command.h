@@ -0,0 +1,124 @@
+/*!
+    \file command.h
+    \brief Market command definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_COMMAND_H
+#define CPPTRADER_MATCHING_COMMAND_H
+
+#include "order.h"
+#include "symbol.h"
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market command type
+enum class MarketCommandType : uint8_t
+{
+    ADD_SYMBOL,
+    DELETE_SYMBOL,
+    ADD_ORDER_BOOK,
+    DELETE_ORDER_BOOK,
+    ADD_ORDER,
+    REDUCE_ORDER,
+    MODIFY_ORDER,
+    MITIGATE_ORDER,
+    REPLACE_ORDER,
+    DELETE_ORDER,
+    EXECUTE_ORDER,
+    EXECUTE_ORDER_AT_PRICE,
+    ENABLE_MATCHING,
+    DISABLE_MATCHING,
+    MATCH
+};
+
+template <class TOutputStream>
+TOutputStream& operator<<(TOutputStream& stream, MarketCommandType type);
+
+//! Market command
+/*!
+    Market command is a tagged value which describes a single market manager
+    operation, so market operations could be queued, batched or routed to
+    another thread. Each command keeps the symbol Id of the affected order
+    book, which allows to route commands by symbol without orders lookup.
+    Matching commands affect all order books and have zero symbol Id.
+*/
+struct MarketCommand
+{
+    //! Command type
+    MarketCommandType Type;
+    //! Symbol Id of the affected order book
+    uint32_t SymbolId;
+
+    union
+    {
+        //! Symbol to add (ADD_SYMBOL, ADD_ORDER_BOOK)
+        Symbol NewSymbol;
+        //! Order to add (ADD_ORDER)
+        Order NewOrder;
+        //! Order operation parameters (other order commands)
+        struct
+        {
+            //! Order Id
+            uint64_t Id;
+            //! New order Id (REPLACE_ORDER)
+            uint64_t NewId;
+            //! Order price
+            uint64_t Price;
+            //! Order quantity
+            uint64_t Quantity;
+        } Params;
+    };
+
+    MarketCommand() noexcept = default;
+    MarketCommand(const MarketCommand&) noexcept = default;
+    MarketCommand(MarketCommand&&) noexcept = default;
+    ~MarketCommand() noexcept = default;
+
+    MarketCommand& operator=(const MarketCommand&) noexcept = default;
+    MarketCommand& operator=(MarketCommand&&) noexcept = default;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const MarketCommand& command);
+
+    //! Is the order command?
+    bool IsOrderCommand() const noexcept { return (Type >= MarketCommandType::ADD_ORDER) && (Type <= MarketCommandType::EXECUTE_ORDER_AT_PRICE); }
+    //! Is the matching command?
+    bool IsMatchingCommand() const noexcept { return Type >= MarketCommandType::ENABLE_MATCHING; }
+
+    // Symbol commands
+    static MarketCommand AddSymbol(const Symbol& symbol) noexcept;
+    static MarketCommand DeleteSymbol(uint32_t id) noexcept;
+
+    // Order book commands
+    static MarketCommand AddOrderBook(const Symbol& symbol) noexcept;
+    static MarketCommand DeleteOrderBook(uint32_t id) noexcept;
+
+    // Order commands
+    static MarketCommand AddOrder(const Order& order) noexcept;
+    static MarketCommand ReduceOrder(uint32_t symbol, uint64_t id, uint64_t quantity) noexcept;
+    static MarketCommand ModifyOrder(uint32_t symbol, uint64_t id, uint64_t new_price, uint64_t new_quantity) noexcept;
+    static MarketCommand MitigateOrder(uint32_t symbol, uint64_t id, uint64_t new_price, uint64_t new_quantity) noexcept;
+    static MarketCommand ReplaceOrder(uint32_t symbol, uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity) noexcept;
+    static MarketCommand DeleteOrder(uint32_t symbol, uint64_t id) noexcept;
+    static MarketCommand ExecuteOrder(uint32_t symbol, uint64_t id, uint64_t quantity) noexcept;
+    static MarketCommand ExecuteOrder(uint32_t symbol, uint64_t id, uint64_t price, uint64_t quantity) noexcept;
+
+    // Matching commands
+    static MarketCommand EnableMatching() noexcept;
+    static MarketCommand DisableMatching() noexcept;
+    static MarketCommand Match() noexcept;
+
+private:
+    static MarketCommand Create(MarketCommandType type, uint32_t symbol, uint64_t id, uint64_t new_id, uint64_t price, uint64_t quantity) noexcept;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "command.inl"
+
+#endif // CPPTRADER_MATCHING_COMMAND_H
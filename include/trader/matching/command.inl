@@ -0,0 +1,200 @@
+/*!
+    \file command.inl
+    \brief Market command inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, MarketCommandType type)
+{
+    switch (type)
+    {
+        case MarketCommandType::ADD_SYMBOL:
+            stream << "ADD-SYMBOL";
+            break;
+        case MarketCommandType::DELETE_SYMBOL:
+            stream << "DELETE-SYMBOL";
+            break;
+        case MarketCommandType::ADD_ORDER_BOOK:
+            stream << "ADD-ORDER-BOOK";
+            break;
+        case MarketCommandType::DELETE_ORDER_BOOK:
+            stream << "DELETE-ORDER-BOOK";
+            break;
+        case MarketCommandType::ADD_ORDER:
+            stream << "ADD-ORDER";
+            break;
+        case MarketCommandType::REDUCE_ORDER:
+            stream << "REDUCE-ORDER";
+            break;
+        case MarketCommandType::MODIFY_ORDER:
+            stream << "MODIFY-ORDER";
+            break;
+        case MarketCommandType::MITIGATE_ORDER:
+            stream << "MITIGATE-ORDER";
+            break;
+        case MarketCommandType::REPLACE_ORDER:
+            stream << "REPLACE-ORDER";
+            break;
+        case MarketCommandType::DELETE_ORDER:
+            stream << "DELETE-ORDER";
+            break;
+        case MarketCommandType::EXECUTE_ORDER:
+            stream << "EXECUTE-ORDER";
+            break;
+        case MarketCommandType::EXECUTE_ORDER_AT_PRICE:
+            stream << "EXECUTE-ORDER-AT-PRICE";
+            break;
+        case MarketCommandType::ENABLE_MATCHING:
+            stream << "ENABLE-MATCHING";
+            break;
+        case MarketCommandType::DISABLE_MATCHING:
+            stream << "DISABLE-MATCHING";
+            break;
+        case MarketCommandType::MATCH:
+            stream << "MATCH";
+            break;
+        default:
+            stream << "<unknown>";
+            break;
+    }
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const MarketCommand& command)
+{
+    stream << "MarketCommand(Type=" << command.Type
+        << "; SymbolId=" << command.SymbolId;
+    switch (command.Type)
+    {
+        case MarketCommandType::ADD_SYMBOL:
+        case MarketCommandType::ADD_ORDER_BOOK:
+            stream << "; " << command.NewSymbol;
+            break;
+        case MarketCommandType::ADD_ORDER:
+            stream << "; " << command.NewOrder;
+            break;
+        case MarketCommandType::DELETE_SYMBOL:
+        case MarketCommandType::DELETE_ORDER_BOOK:
+        case MarketCommandType::ENABLE_MATCHING:
+        case MarketCommandType::DISABLE_MATCHING:
+        case MarketCommandType::MATCH:
+            break;
+        default:
+            stream << "; Id=" << command.Params.Id
+                << "; NewId=" << command.Params.NewId
+                << "; Price=" << command.Params.Price
+                << "; Quantity=" << command.Params.Quantity;
+            break;
+    }
+    stream << ")";
+    return stream;
+}
+
+inline MarketCommand MarketCommand::Create(MarketCommandType type, uint32_t symbol, uint64_t id, uint64_t new_id, uint64_t price, uint64_t quantity) noexcept
+{
+    MarketCommand command;
+    command.Type = type;
+    command.SymbolId = symbol;
+    command.Params.Id = id;
+    command.Params.NewId = new_id;
+    command.Params.Price = price;
+    command.Params.Quantity = quantity;
+    return command;
+}
+
+inline MarketCommand MarketCommand::AddSymbol(const Symbol& symbol) noexcept
+{
+    MarketCommand command;
+    command.Type = MarketCommandType::ADD_SYMBOL;
+    command.SymbolId = symbol.Id;
+    command.NewSymbol = symbol;
+    return command;
+}
+
+inline MarketCommand MarketCommand::DeleteSymbol(uint32_t id) noexcept
+{
+    return Create(MarketCommandType::DELETE_SYMBOL, id, 0, 0, 0, 0);
+}
+
+inline MarketCommand MarketCommand::AddOrderBook(const Symbol& symbol) noexcept
+{
+    MarketCommand command;
+    command.Type = MarketCommandType::ADD_ORDER_BOOK;
+    command.SymbolId = symbol.Id;
+    command.NewSymbol = symbol;
+    return command;
+}
+
+inline MarketCommand MarketCommand::DeleteOrderBook(uint32_t id) noexcept
+{
+    return Create(MarketCommandType::DELETE_ORDER_BOOK, id, 0, 0, 0, 0);
+}
+
+inline MarketCommand MarketCommand::AddOrder(const Order& order) noexcept
+{
+    MarketCommand command;
+    command.Type = MarketCommandType::ADD_ORDER;
+    command.SymbolId = order.SymbolId;
+    command.NewOrder = order;
+    return command;
+}
+
+inline MarketCommand MarketCommand::ReduceOrder(uint32_t symbol, uint64_t id, uint64_t quantity) noexcept
+{
+    return Create(MarketCommandType::REDUCE_ORDER, symbol, id, 0, 0, quantity);
+}
+
+inline MarketCommand MarketCommand::ModifyOrder(uint32_t symbol, uint64_t id, uint64_t new_price, uint64_t new_quantity) noexcept
+{
+    return Create(MarketCommandType::MODIFY_ORDER, symbol, id, 0, new_price, new_quantity);
+}
+
+inline MarketCommand MarketCommand::MitigateOrder(uint32_t symbol, uint64_t id, uint64_t new_price, uint64_t new_quantity) noexcept
+{
+    return Create(MarketCommandType::MITIGATE_ORDER, symbol, id, 0, new_price, new_quantity);
+}
+
+inline MarketCommand MarketCommand::ReplaceOrder(uint32_t symbol, uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity) noexcept
+{
+    return Create(MarketCommandType::REPLACE_ORDER, symbol, id, new_id, new_price, new_quantity);
+}
+
+inline MarketCommand MarketCommand::DeleteOrder(uint32_t symbol, uint64_t id) noexcept
+{
+    return Create(MarketCommandType::DELETE_ORDER, symbol, id, 0, 0, 0);
+}
+
+inline MarketCommand MarketCommand::ExecuteOrder(uint32_t symbol, uint64_t id, uint64_t quantity) noexcept
+{
+    return Create(MarketCommandType::EXECUTE_ORDER, symbol, id, 0, 0, quantity);
+}
+
+inline MarketCommand MarketCommand::ExecuteOrder(uint32_t symbol, uint64_t id, uint64_t price, uint64_t quantity) noexcept
+{
+    return Create(MarketCommandType::EXECUTE_ORDER_AT_PRICE, symbol, id, 0, price, quantity);
+}
+
+inline MarketCommand MarketCommand::EnableMatching() noexcept
+{
+    return Create(MarketCommandType::ENABLE_MATCHING, 0, 0, 0, 0, 0);
+}
+
+inline MarketCommand MarketCommand::DisableMatching() noexcept
+{
+    return Create(MarketCommandType::DISABLE_MATCHING, 0, 0, 0, 0, 0);
+}
+
+inline MarketCommand MarketCommand::Match() noexcept
+{
+    return Create(MarketCommandType::MATCH, 0, 0, 0, 0, 0);
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,132 @@
+/*!
+    \file depth_publisher.h
+    \brief Depth publisher definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_DEPTH_PUBLISHER_H
+#define CPPTRADER_MATCHING_DEPTH_PUBLISHER_H
+
+#include "level.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Depth snapshot
+struct DepthSnapshot
+{
+    //! Publication sequence number
+    uint64_t Sequence;
+    //! Bid price levels ordered from the best price
+    std::vector<Level> Bids;
+    //! Ask price levels ordered from the best price
+    std::vector<Level> Asks;
+
+    DepthSnapshot() noexcept : Sequence(0) {}
+};
+
+//! Depth publisher
+/*!
+    Depth publisher allows a single writer thread to publish the order book
+    depth (up to the given count of the best bid and ask price levels) and any
+    count of reader threads to read consistent depth snapshots without locks.
+
+    Depth is published into a ring of buffers. The writer fills the next buffer
+    and publishes it by swapping the current buffer index, so readers keep on
+    reading the previous buffer in the meantime. Each buffer is guarded by its
+    own sequence number, so a reader detects the rare case when the writer has
+    wrapped around the ring and reuses the buffer being read. Price levels are
+    stored as relaxed atomic 64-bit words, so such a reader copies them
+    concurrently with the writer without a data race.
+
+    Single writer, multiple readers thread-safe.
+*/
+class DepthPublisher
+{
+public:
+    //! Create a new depth publisher
+    /*!
+        \param depth - Depth size in price levels (0 to disable the publisher)
+        \param buffers - Buffers count (default is 4)
+    */
+    explicit DepthPublisher(size_t depth, size_t buffers = 4);
+    DepthPublisher(const DepthPublisher&) = delete;
+    DepthPublisher(DepthPublisher&&) = delete;
+    ~DepthPublisher() = default;
+
+    DepthPublisher& operator=(const DepthPublisher&) = delete;
+    DepthPublisher& operator=(DepthPublisher&&) = delete;
+
+    //! Is the depth publisher enabled?
+    bool enabled() const noexcept { return _depth > 0; }
+
+    //! Get the depth size in price levels
+    size_t depth() const noexcept { return _depth; }
+    //! Get the last published sequence number
+    uint64_t sequence() const noexcept { return _buffers[_current.load(std::memory_order_acquire)].Sequence.load(std::memory_order_acquire) >> 1; }
+
+    //! Publish the depth (writer thread only)
+    /*!
+        \param bids - Bid price levels ordered from the best price (only first depth() levels are published)
+        \param asks - Ask price levels ordered from the best price (only first depth() levels are published)
+    */
+    void Publish(const std::vector<Level>& bids, const std::vector<Level>& asks) noexcept;
+
+    //! Try to read the consistent depth snapshot
+    /*!
+        Single read attempt of the last published depth. It fails only if the
+        writer thread has wrapped around all buffers during the read.
+
+        \param snapshot - Depth snapshot to fill
+        \return 'true' if the consistent depth snapshot was read, 'false' otherwise
+    */
+    bool TryRead(DepthSnapshot& snapshot) const;
+    //! Read the consistent depth snapshot
+    /*!
+        Repeats read attempts until the consistent depth snapshot is read.
+
+        \param snapshot - Depth snapshot to fill
+    */
+    void Read(DepthSnapshot& snapshot) const;
+
+private:
+    // Buffer header is placed into its own cache line, because readers poll it
+    struct alignas(64) Buffer
+    {
+        std::atomic<uint64_t> Sequence;
+        std::atomic<size_t> Bids;
+        std::atomic<size_t> Asks;
+
+        Buffer() noexcept : Sequence(0), Bids(0), Asks(0) {}
+    };
+
+    // Price level words: type, price, total, hidden and visible volumes, orders
+    static const size_t LEVEL_WORDS = 6;
+
+    size_t _depth;
+    uint64_t _published;
+    std::vector<Buffer> _buffers;
+    // Bid and ask price level words of all buffers
+    std::unique_ptr<std::atomic<uint64_t>[]> _levels;
+    alignas(64) std::atomic<size_t> _current;
+
+    std::atomic<uint64_t>* BufferLevels(size_t buffer, bool bid) noexcept { return _levels.get() + (2 * buffer + (bid ? 0 : 1)) * _depth * LEVEL_WORDS; }
+    const std::atomic<uint64_t>* BufferLevels(size_t buffer, bool bid) const noexcept { return _levels.get() + (2 * buffer + (bid ? 0 : 1)) * _depth * LEVEL_WORDS; }
+
+    static void StoreLevels(std::atomic<uint64_t>* words, const Level* levels, size_t size) noexcept;
+    static void LoadLevels(const std::atomic<uint64_t>* words, size_t size, std::vector<Level>& levels);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "depth_publisher.inl"
+
+#endif // CPPTRADER_MATCHING_DEPTH_PUBLISHER_H
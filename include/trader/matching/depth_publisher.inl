@@ -0,0 +1,94 @@
+/*!
+    \file depth_publisher.inl
+    \brief Depth publisher inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline void DepthPublisher::Publish(const std::vector<Level>& bids, const std::vector<Level>& asks) noexcept
+{
+    if (_depth == 0)
+        return;
+
+    // Fill the next buffer while readers keep on reading the current one
+    size_t index = (_current.load(std::memory_order_relaxed) + 1) % _buffers.size();
+    Buffer& buffer = _buffers[index];
+    ++_published;
+
+    // Mark the buffer modification in progress before any level is modified
+    buffer.Sequence.store(2 * _published - 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    size_t bids_size = std::min(bids.size(), _depth);
+    size_t asks_size = std::min(asks.size(), _depth);
+    StoreLevels(BufferLevels(index, true), bids.data(), bids_size);
+    StoreLevels(BufferLevels(index, false), asks.data(), asks_size);
+    buffer.Bids.store(bids_size, std::memory_order_relaxed);
+    buffer.Asks.store(asks_size, std::memory_order_relaxed);
+
+    // Complete the buffer modification and swap the current buffer
+    buffer.Sequence.store(2 * _published, std::memory_order_release);
+    _current.store(index, std::memory_order_release);
+}
+
+inline bool DepthPublisher::TryRead(DepthSnapshot& snapshot) const
+{
+    size_t index = _current.load(std::memory_order_acquire);
+    const Buffer& buffer = _buffers[index];
+
+    uint64_t sequence = buffer.Sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) != 0)
+        return false;
+
+    // Sizes could be torn by the wrapped around writer, so they are limited by the depth
+    size_t bids_size = std::min(buffer.Bids.load(std::memory_order_relaxed), _depth);
+    size_t asks_size = std::min(buffer.Asks.load(std::memory_order_relaxed), _depth);
+    LoadLevels(BufferLevels(index, true), bids_size, snapshot.Bids);
+    LoadLevels(BufferLevels(index, false), asks_size, snapshot.Asks);
+    snapshot.Sequence = sequence >> 1;
+
+    // Levels must be read before the sequence number is checked again
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (buffer.Sequence.load(std::memory_order_relaxed) == sequence);
+}
+
+inline void DepthPublisher::StoreLevels(std::atomic<uint64_t>* words, const Level* levels, size_t size) noexcept
+{
+    for (size_t i = 0; i < size; ++i, words += LEVEL_WORDS)
+    {
+        words[0].store((uint64_t)levels[i].Type, std::memory_order_relaxed);
+        words[1].store(levels[i].Price, std::memory_order_relaxed);
+        words[2].store(levels[i].TotalVolume, std::memory_order_relaxed);
+        words[3].store(levels[i].HiddenVolume, std::memory_order_relaxed);
+        words[4].store(levels[i].VisibleVolume, std::memory_order_relaxed);
+        words[5].store((uint64_t)levels[i].Orders, std::memory_order_relaxed);
+    }
+}
+
+inline void DepthPublisher::LoadLevels(const std::atomic<uint64_t>* words, size_t size, std::vector<Level>& levels)
+{
+    levels.clear();
+    for (size_t i = 0; i < size; ++i, words += LEVEL_WORDS)
+    {
+        Level level((LevelType)words[0].load(std::memory_order_relaxed), words[1].load(std::memory_order_relaxed));
+        level.TotalVolume = words[2].load(std::memory_order_relaxed);
+        level.HiddenVolume = words[3].load(std::memory_order_relaxed);
+        level.VisibleVolume = words[4].load(std::memory_order_relaxed);
+        level.Orders = (size_t)words[5].load(std::memory_order_relaxed);
+        levels.push_back(level);
+    }
+}
+
+inline void DepthPublisher::Read(DepthSnapshot& snapshot) const
+{
+    while (!TryRead(snapshot))
+    {
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -29,7 +29,13 @@ enum class ErrorCode : uint8_t
     ORDER_ID_INVALID,
     ORDER_TYPE_INVALID,
     ORDER_PARAMETER_INVALID,
-    ORDER_QUANTITY_INVALID
+    ORDER_QUANTITY_INVALID,
+    MARKET_NOT_EMPTY,
+    SNAPSHOT_INVALID,
+    SNAPSHOT_WRITE_FAILED,
+    JOURNAL_INVALID,
+    JOURNAL_WRITE_FAILED,
+    SCENARIO_INVALID
 };
 
 template <class TOutputStream>
@@ -47,6 +47,24 @@ inline TOutputStream& operator<<(TOutputStream& stream, ErrorCode error)
         case ErrorCode::ORDER_QUANTITY_INVALID:
             stream << "ORDER_QUANTITY_INVALID";
             break;
+        case ErrorCode::MARKET_NOT_EMPTY:
+            stream << "MARKET_NOT_EMPTY";
+            break;
+        case ErrorCode::SNAPSHOT_INVALID:
+            stream << "SNAPSHOT_INVALID";
+            break;
+        case ErrorCode::SNAPSHOT_WRITE_FAILED:
+            stream << "SNAPSHOT_WRITE_FAILED";
+            break;
+        case ErrorCode::JOURNAL_INVALID:
+            stream << "JOURNAL_INVALID";
+            break;
+        case ErrorCode::JOURNAL_WRITE_FAILED:
+            stream << "JOURNAL_WRITE_FAILED";
+            break;
+        case ErrorCode::SCENARIO_INVALID:
+            stream << "SCENARIO_INVALID";
+            break;
         default:
             stream << "<unknown>";
             break;
@@ -0,0 +1,116 @@
+/*!
+    \file journal.h
+    \brief Market journal definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_JOURNAL_H
+#define CPPTRADER_MATCHING_JOURNAL_H
+
+#include "order.h"
+#include "symbol.h"
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market journal header
+/*!
+    Market journal is a journal header followed by a sequence of variable size
+    command records. Each record starts with the JournalRecord header followed
+    by the command fields without padding:
+    \li ADD_SYMBOL, ADD_ORDER_BOOK - Symbol
+    \li DELETE_SYMBOL, DELETE_ORDER_BOOK - symbol Id (uint32_t)
+    \li ADD_ORDER - Order
+    \li REDUCE_ORDER, EXECUTE_ORDER - order Id, quantity (uint64_t)
+    \li MODIFY_ORDER, MITIGATE_ORDER, EXECUTE_ORDER_AT_PRICE - order Id, price, quantity (uint64_t)
+    \li REPLACE_ORDER - order Id, new order Id, new price, new quantity (uint64_t)
+    \li REPLACE_ORDER_WITH_ORDER - order Id (uint64_t), new Order
+    \li DELETE_ORDER - order Id (uint64_t)
+    \li ENABLE_MATCHING, DISABLE_MATCHING, MATCH - no fields
+
+    Journal file is preallocated, so the zero record size marks the end of the
+    journal. All records are stored in the host byte order.
+*/
+struct JournalHeader
+{
+    //! Journal signature
+    uint32_t Signature;
+    //! Journal format version
+    uint32_t Version;
+
+    //! Journal signature ("CTMJ")
+    static const uint32_t SIGNATURE = 0x4A4D5443;
+    //! Journal format version
+    static const uint32_t VERSION = 1;
+};
+
+//! Market journal record type
+enum class JournalRecordType : uint8_t
+{
+    ADD_SYMBOL = 1,
+    DELETE_SYMBOL,
+    ADD_ORDER_BOOK,
+    DELETE_ORDER_BOOK,
+    ADD_ORDER,
+    REDUCE_ORDER,
+    MODIFY_ORDER,
+    MITIGATE_ORDER,
+    REPLACE_ORDER,
+    REPLACE_ORDER_WITH_ORDER,
+    DELETE_ORDER,
+    EXECUTE_ORDER,
+    EXECUTE_ORDER_AT_PRICE,
+    ENABLE_MATCHING,
+    DISABLE_MATCHING,
+    MATCH
+};
+
+//! Market journal record header
+struct JournalRecord
+{
+    //! Record size including the record header
+    uint8_t Size;
+    //! Record type
+    JournalRecordType Type;
+    //! Fletcher-16 checksum of the record size, type and fields
+    uint16_t Checksum;
+
+    //! Calculate the checksum of the record
+    /*!
+        \param record - Record buffer
+        \param size - Record size
+        \return Fletcher-16 checksum of the record size, type and fields
+    */
+    static uint16_t CalculateChecksum(const uint8_t* record, size_t size) noexcept;
+
+    //! Encode the record with the given fields
+    /*!
+        \param buffer - Record buffer of at least RecordSize<TFields...>() bytes
+        \param type - Record type
+        \param fields - Record fields
+        \return Record size
+    */
+    template <typename... TFields>
+    static size_t Encode(uint8_t* buffer, JournalRecordType type, const TFields&... fields) noexcept;
+
+    //! Get the record size with the given fields
+    template <typename... TFields>
+    static constexpr size_t RecordSize() noexcept { return sizeof(JournalRecord) + (sizeof(TFields) + ... + 0); }
+};
+
+static_assert(std::is_trivially_copyable<Order>::value, "Order must be trivially copyable to be stored in the market journal!");
+static_assert(std::is_trivially_copyable<Symbol>::value, "Symbol must be trivially copyable to be stored in the market journal!");
+static_assert((sizeof(JournalRecord) + sizeof(uint64_t) + sizeof(Order)) <= 255, "Market journal record size must fit into one byte!");
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "journal.inl"
+
+#endif // CPPTRADER_MATCHING_JOURNAL_H
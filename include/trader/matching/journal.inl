@@ -0,0 +1,44 @@
+/*!
+    \file journal.inl
+    \brief Market journal inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline uint16_t JournalRecord::CalculateChecksum(const uint8_t* record, size_t size) noexcept
+{
+    // Fletcher-16 checksum of the record size, type and fields
+    uint32_t sum1 = record[0];
+    uint32_t sum2 = sum1;
+    sum1 += record[1];
+    sum2 += sum1;
+    for (size_t i = sizeof(JournalRecord); i < size; ++i)
+    {
+        sum1 += record[i];
+        sum2 += sum1;
+    }
+    return (uint16_t)(((sum2 % 255) << 8) | (sum1 % 255));
+}
+
+template <typename... TFields>
+inline size_t JournalRecord::Encode(uint8_t* buffer, JournalRecordType type, const TFields&... fields) noexcept
+{
+    constexpr size_t size = RecordSize<TFields...>();
+
+    uint8_t* data = buffer + sizeof(JournalRecord);
+    ((std::memcpy(data, &fields, sizeof(TFields)), data += sizeof(TFields)), ...);
+    (void)data;
+    buffer[0] = (uint8_t)size;
+    buffer[1] = (uint8_t)type;
+    uint16_t checksum = CalculateChecksum(buffer, size);
+    std::memcpy(buffer + 2, &checksum, sizeof(checksum));
+
+    return size;
+}
+
+} // namespace Matching
+} // namespace CppTrader
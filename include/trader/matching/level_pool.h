@@ -0,0 +1,85 @@
+/*!
+    \file level_pool.h
+    \brief Price level pool definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_LEVEL_POOL_H
+#define CPPTRADER_MATCHING_LEVEL_POOL_H
+
+#include "level.h"
+
+#include <cassert>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Price level pool
+/*!
+    Price level pool keeps price levels in a single contiguous array and
+    addresses them by index. Released indexes are kept in a free list and
+    reused by the next created price levels, so both create and release
+    operations take O(1).
+
+    Indexes stay valid while the pool grows, but references to pooled price
+    levels are invalidated by the next Create() call.
+
+    Not thread-safe.
+*/
+class LevelPool
+{
+public:
+    LevelPool() = default;
+    explicit LevelPool(size_t capacity) { Reserve(capacity); }
+    LevelPool(const LevelPool&) = delete;
+    LevelPool(LevelPool&&) = delete;
+    ~LevelPool() = default;
+
+    LevelPool& operator=(const LevelPool&) = delete;
+    LevelPool& operator=(LevelPool&&) = delete;
+
+    //! Get the price level with the given index
+    Level& operator[](size_t index) noexcept { return _levels[index]; }
+    const Level& operator[](size_t index) const noexcept { return _levels[index]; }
+
+    //! Is the price level pool empty?
+    bool empty() const noexcept { return size() == 0; }
+
+    //! Get the count of price levels in use
+    size_t size() const noexcept { return _levels.size() - _free.size(); }
+    //! Get the price level pool capacity
+    size_t capacity() const noexcept { return _levels.capacity(); }
+
+    //! Reserve the price level pool capacity
+    /*!
+        \param capacity - Price level pool capacity
+    */
+    void Reserve(size_t capacity);
+
+    //! Create a new empty price level
+    /*!
+        \param type - Price level type
+        \param price - Price level price
+        \return Index of the created price level
+    */
+    size_t Create(LevelType type, uint64_t price);
+    //! Release the price level with the given index
+    /*!
+        \param index - Price level index
+    */
+    void Release(size_t index);
+
+private:
+    std::vector<Level> _levels;
+    std::vector<size_t> _free;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "level_pool.inl"
+
+#endif // CPPTRADER_MATCHING_LEVEL_POOL_H
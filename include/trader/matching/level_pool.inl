@@ -0,0 +1,42 @@
+/*!
+    \file level_pool.inl
+    \brief Price level pool inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline void LevelPool::Reserve(size_t capacity)
+{
+    _levels.reserve(capacity);
+    _free.reserve(capacity);
+}
+
+inline size_t LevelPool::Create(LevelType type, uint64_t price)
+{
+    if (_free.empty())
+    {
+        size_t index = _levels.size();
+        _levels.emplace_back(type, price);
+        return index;
+    }
+    else
+    {
+        size_t index = _free.back();
+        _free.pop_back();
+        _levels[index] = Level(type, price);
+        return index;
+    }
+}
+
+inline void LevelPool::Release(size_t index)
+{
+    assert((index < _levels.size()) && "Invalid price level index!");
+    _free.push_back(index);
+}
+
+} // namespace Matching
+} // namespace CppTrader
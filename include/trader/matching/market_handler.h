@@ -14,6 +14,8 @@
 #include "order_book.h"
 #include "symbol.h"
 
+#include <tuple>
+
 namespace CppTrader {
 namespace Matching {
 
@@ -31,7 +33,10 @@ namespace Matching {
 */
 class MarketHandler
 {
-    friend class MarketManager;
+    template <class THandler>
+    friend class BasicMarketManager;
+    template <class... THandlers>
+    friend class MarketHandlerList;
 
 public:
     MarketHandler() = default;
@@ -66,6 +71,93 @@ protected:
     virtual void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) {}
 };
 
+//! Static market handler class
+/*!
+    Static market handler is a base class for market handlers dispatched at
+    compile time with BasicMarketManager<THandler>. All handlers are empty
+    non-virtual methods, so derived classes hide only required ones and the
+    rest of handler calls are compiled away.
+
+    Handlers are public in order to be called by the market manager directly.
+
+    Not thread-safe.
+*/
+class StaticMarketHandler
+{
+public:
+    // Symbol handlers
+    void onAddSymbol(const Symbol& symbol) {}
+    void onDeleteSymbol(const Symbol& symbol) {}
+
+    // Order book handlers
+    void onAddOrderBook(const OrderBook& order_book) {}
+    void onUpdateOrderBook(const OrderBook& order_book, bool top) {}
+    void onDeleteOrderBook(const OrderBook& order_book) {}
+
+    // Price level handlers
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) {}
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) {}
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) {}
+
+    // Order handlers
+    void onAddOrder(const Order& order) {}
+    void onUpdateOrder(const Order& order) {}
+    void onDeleteOrder(const Order& order) {}
+
+    // Order execution handlers
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) {}
+};
+
+//! Market handler list class
+/*!
+    Market handler list forwards each market event to the given list of
+    market handlers in the declaration order. Handlers are bound at compile
+    time, so BasicMarketManager<MarketHandlerList<...>> fans out market events
+    without virtual calls.
+
+    Not thread-safe.
+*/
+template <class... THandlers>
+class MarketHandlerList
+{
+public:
+    explicit MarketHandlerList(THandlers&... handlers) : _handlers(handlers...) {}
+    MarketHandlerList(const MarketHandlerList&) = delete;
+    MarketHandlerList(MarketHandlerList&&) = delete;
+    ~MarketHandlerList() = default;
+
+    MarketHandlerList& operator=(const MarketHandlerList&) = delete;
+    MarketHandlerList& operator=(MarketHandlerList&&) = delete;
+
+    // Symbol handlers
+    void onAddSymbol(const Symbol& symbol) { Dispatch([&](auto& handler) { handler.onAddSymbol(symbol); }); }
+    void onDeleteSymbol(const Symbol& symbol) { Dispatch([&](auto& handler) { handler.onDeleteSymbol(symbol); }); }
+
+    // Order book handlers
+    void onAddOrderBook(const OrderBook& order_book) { Dispatch([&](auto& handler) { handler.onAddOrderBook(order_book); }); }
+    void onUpdateOrderBook(const OrderBook& order_book, bool top) { Dispatch([&](auto& handler) { handler.onUpdateOrderBook(order_book, top); }); }
+    void onDeleteOrderBook(const OrderBook& order_book) { Dispatch([&](auto& handler) { handler.onDeleteOrderBook(order_book); }); }
+
+    // Price level handlers
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) { Dispatch([&](auto& handler) { handler.onAddLevel(order_book, level, top); }); }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) { Dispatch([&](auto& handler) { handler.onUpdateLevel(order_book, level, top); }); }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) { Dispatch([&](auto& handler) { handler.onDeleteLevel(order_book, level, top); }); }
+
+    // Order handlers
+    void onAddOrder(const Order& order) { Dispatch([&](auto& handler) { handler.onAddOrder(order); }); }
+    void onUpdateOrder(const Order& order) { Dispatch([&](auto& handler) { handler.onUpdateOrder(order); }); }
+    void onDeleteOrder(const Order& order) { Dispatch([&](auto& handler) { handler.onDeleteOrder(order); }); }
+
+    // Order execution handlers
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) { Dispatch([&](auto& handler) { handler.onExecuteOrder(order, price, quantity); }); }
+
+private:
+    std::tuple<THandlers&...> _handlers;
+
+    template <class TFunction>
+    void Dispatch(TFunction&& function) { std::apply([&](auto&... handlers) { (function(handlers), ...); }, _handlers); }
+};
+
 } // namespace Matching
 } // namespace CppTrader
 
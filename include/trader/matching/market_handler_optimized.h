@@ -0,0 +1,65 @@
+/*!
+    \file market_handler_optimized.h
+    \brief Optimized market handler definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_HANDLER_OPTIMIZED_H
+#define CPPTRADER_MATCHING_MARKET_HANDLER_OPTIMIZED_H
+
+#include "order_book_optimized.h"
+
+namespace CppTrader {
+namespace Matching {
+
+//! Optimized market handler class
+/*!
+    Optimized market handler is used to handle all market events from
+    MarketManagerOptimized with a custom actions. It provides the same set
+    of handlers as MarketHandler for optimized orders and order books.
+
+    Not thread-safe.
+*/
+class MarketHandlerOptimized
+{
+    friend class MarketManagerOptimized;
+
+public:
+    MarketHandlerOptimized() = default;
+    MarketHandlerOptimized(const MarketHandlerOptimized&) = delete;
+    MarketHandlerOptimized(MarketHandlerOptimized&&) = delete;
+    virtual ~MarketHandlerOptimized() = default;
+
+    MarketHandlerOptimized& operator=(const MarketHandlerOptimized&) = delete;
+    MarketHandlerOptimized& operator=(MarketHandlerOptimized&&) = delete;
+
+protected:
+    // Symbol handlers
+    virtual void onAddSymbol(const Symbol& symbol) {}
+    virtual void onDeleteSymbol(const Symbol& symbol) {}
+
+    // Order book handlers
+    virtual void onAddOrderBook(const OrderBookOptimized& order_book) {}
+    virtual void onUpdateOrderBook(const OrderBookOptimized& order_book, bool top) {}
+    virtual void onDeleteOrderBook(const OrderBookOptimized& order_book) {}
+
+    // Price level handlers
+    virtual void onAddLevel(const OrderBookOptimized& order_book, const Level& level, bool top) {}
+    virtual void onUpdateLevel(const OrderBookOptimized& order_book, const Level& level, bool top) {}
+    virtual void onDeleteLevel(const OrderBookOptimized& order_book, const Level& level, bool top) {}
+
+    // Order handlers
+    virtual void onAddOrder(const OrderOptimized& order) {}
+    virtual void onUpdateOrder(const OrderOptimized& order) {}
+    virtual void onDeleteOrder(const OrderOptimized& order) {}
+
+    // Order execution handlers
+    virtual void onExecuteOrder(const OrderOptimized& order, uint64_t price, uint64_t quantity) {}
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#endif // CPPTRADER_MATCHING_MARKET_HANDLER_OPTIMIZED_H
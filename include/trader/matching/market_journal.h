@@ -0,0 +1,202 @@
+/*!
+    \file market_journal.h
+    \brief Market journal definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_JOURNAL_H
+#define CPPTRADER_MATCHING_MARKET_JOURNAL_H
+
+#include "journal.h"
+#include "market_manager.h"
+
+#include "filesystem/file.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market journal
+/*!
+    Market journal is a write-ahead log around the market manager. Each market
+    manager mutator called through the journal appends a compact binary command
+    record into the in-memory journal buffer and then performs the command with
+    the market manager. Commands are journaled before they are performed, so the
+    journal could be replayed into a fresh market manager to restore the same
+    market state (failed commands fail in the same way during replay).
+
+    Journal records are written into the journal file preallocated on the disk
+    (not a sparse file, so group commits do not allocate disk blocks) by the
+    background commit thread. The commit thread takes all records appended since
+    the previous commit, writes them with a single write and syncs the file once
+    (group commit), so the caller never waits for the disk. Commit() method
+    could be used to wait until all appended records are durable.
+
+    Journal file is truncated on open, so it should be opened only after the
+    previous journal is replayed (or saved into the market snapshot).
+
+    Journal methods must be called from the single thread.
+*/
+class MarketJournal
+{
+public:
+    //! Default journal file preallocation size (64 megabytes)
+    static const uint64_t DEFAULT_PREALLOCATE = 64 * 1024 * 1024;
+    //! Default group commit interval in nanoseconds (1 millisecond)
+    static const uint64_t DEFAULT_INTERVAL = 1000000;
+
+    //! Initialize the market journal and open the journal file
+    /*!
+        \param market - Market manager to journal
+        \param path - Journal file path
+        \param preallocate - Journal file preallocation size. The journal file is extended by the same size when it is full (default is DEFAULT_PREALLOCATE)
+        \param interval - Group commit interval in nanoseconds (default is DEFAULT_INTERVAL)
+    */
+    MarketJournal(MarketManager& market, const CppCommon::Path& path, uint64_t preallocate = DEFAULT_PREALLOCATE, uint64_t interval = DEFAULT_INTERVAL);
+    MarketJournal(const MarketJournal&) = delete;
+    MarketJournal(MarketJournal&&) = delete;
+    ~MarketJournal();
+
+    MarketJournal& operator=(const MarketJournal&) = delete;
+    MarketJournal& operator=(MarketJournal&&) = delete;
+
+    //! Get the journaled market manager
+    MarketManager& market() noexcept { return _market; }
+    const MarketManager& market() const noexcept { return _market; }
+
+    //! Get the journal file path
+    const CppCommon::Path& path() const noexcept { return _file.path(); }
+    //! Get the journal size in bytes (including the journal header)
+    uint64_t size() const noexcept { return _size; }
+    //! Get appended records count
+    uint64_t appended() const noexcept { return _appended; }
+    //! Get committed (durable) records count
+    uint64_t committed() const noexcept { return _committed.load(std::memory_order_acquire); }
+    //! Is the journal failed to write?
+    bool failed() const noexcept { return _failed.load(std::memory_order_acquire); }
+
+    //! Add a new symbol
+    ErrorCode AddSymbol(const Symbol& symbol);
+    //! Delete the symbol
+    ErrorCode DeleteSymbol(uint32_t id);
+
+    //! Add a new order book
+    ErrorCode AddOrderBook(const Symbol& symbol);
+    //! Delete the order book
+    ErrorCode DeleteOrderBook(uint32_t id);
+
+    //! Add a new order
+    ErrorCode AddOrder(const Order& order);
+    //! Reduce the order by the given quantity
+    ErrorCode ReduceOrder(uint64_t id, uint64_t quantity);
+    //! Modify the order
+    ErrorCode ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity);
+    //! Mitigate the order
+    ErrorCode MitigateOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity);
+    //! Replace the order with a similar order but different Id, price and quantity
+    ErrorCode ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity);
+    //! Replace the order with a new one
+    ErrorCode ReplaceOrder(uint64_t id, const Order& new_order);
+    //! Delete the order
+    ErrorCode DeleteOrder(uint64_t id);
+    //! Execute the order
+    ErrorCode ExecuteOrder(uint64_t id, uint64_t quantity);
+    //! Execute the order at the given price
+    ErrorCode ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity);
+
+    //! Enable automatic matching
+    void EnableMatching();
+    //! Disable automatic matching
+    void DisableMatching();
+    //! Match crossed orders in all order books
+    void Match();
+
+    //! Commit the journal
+    /*!
+        Wake up the commit thread and wait until all appended records are
+        written and synced to the journal file.
+
+        \return Error code (JOURNAL_WRITE_FAILED if the journal file cannot be written)
+    */
+    ErrorCode Commit();
+
+    //! Replay the market journal from the memory buffer
+    /*!
+        Journal records are performed with the given market manager in order.
+        Replay stops at the end of the journal, at the first incomplete record
+        or at the first record with the broken checksum (torn write of the last
+        group commit). Only zeros of the preallocated journal file could follow
+        the end of the journal or the record with the broken checksum, otherwise
+        the journal is corrupted.
+
+        \param buffer - Journal buffer
+        \param size - Journal buffer size
+        \param market - Market manager to replay the journal into
+        \param records - Replayed records count
+        \return Error code (JOURNAL_INVALID if the journal header is invalid or the journal is corrupted)
+    */
+    static ErrorCode Replay(const void* buffer, size_t size, MarketManager& market, uint64_t& records);
+    //! Replay the market journal from the journal file
+    /*!
+        \param path - Journal file path
+        \param market - Market manager to replay the journal into
+        \param records - Replayed records count
+        \return Error code (JOURNAL_INVALID if the journal header is invalid or the journal is corrupted)
+    */
+    static ErrorCode Replay(const CppCommon::Path& path, MarketManager& market, uint64_t& records);
+    //! Replay the single market journal record
+    /*!
+        \param record - Complete journal record with the valid checksum
+        \param market - Market manager to replay the record into
+        \return Error code of the replayed command (JOURNAL_INVALID if the record type or size is invalid)
+    */
+    static ErrorCode ReplayRecord(const uint8_t* record, MarketManager& market);
+
+private:
+    MarketManager& _market;
+    CppCommon::File _file;
+    uint64_t _preallocate;
+    uint64_t _interval;
+    uint64_t _capacity;
+    uint64_t _size;
+    uint64_t _appended;
+
+    // Commit thread state
+    std::mutex _mutex;
+    std::condition_variable _commit_request;
+    std::condition_variable _commit_response;
+    std::vector<uint8_t> _buffer;
+    std::vector<uint8_t> _commit_buffer;
+    bool _commit_requested;
+    bool _stop;
+    std::atomic<uint64_t> _committed;
+    std::atomic<bool> _failed;
+    uint64_t _offset;
+    std::thread _thread;
+
+    template <typename... TFields>
+    void Append(JournalRecordType type, const TFields&... fields);
+
+    void Committer();
+    bool WriteAndSync(const std::vector<uint8_t>& buffer);
+
+    static const size_t REPLAY_BUFFER_SIZE = 1024 * 1024;
+    static bool ReadHeader(const uint8_t*& data, const uint8_t* end);
+    static ErrorCode ReplayRecords(const uint8_t*& data, const uint8_t* end, MarketManager& market, uint64_t& records, bool& finished);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_journal.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_JOURNAL_H
@@ -0,0 +1,122 @@
+/*!
+    \file market_journal.inl
+    \brief Market journal inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline ErrorCode MarketJournal::AddSymbol(const Symbol& symbol)
+{
+    Append(JournalRecordType::ADD_SYMBOL, symbol);
+    return _market.AddSymbol(symbol);
+}
+
+inline ErrorCode MarketJournal::DeleteSymbol(uint32_t id)
+{
+    Append(JournalRecordType::DELETE_SYMBOL, id);
+    return _market.DeleteSymbol(id);
+}
+
+inline ErrorCode MarketJournal::AddOrderBook(const Symbol& symbol)
+{
+    Append(JournalRecordType::ADD_ORDER_BOOK, symbol);
+    return _market.AddOrderBook(symbol);
+}
+
+inline ErrorCode MarketJournal::DeleteOrderBook(uint32_t id)
+{
+    Append(JournalRecordType::DELETE_ORDER_BOOK, id);
+    return _market.DeleteOrderBook(id);
+}
+
+inline ErrorCode MarketJournal::AddOrder(const Order& order)
+{
+    Append(JournalRecordType::ADD_ORDER, order);
+    return _market.AddOrder(order);
+}
+
+inline ErrorCode MarketJournal::ReduceOrder(uint64_t id, uint64_t quantity)
+{
+    Append(JournalRecordType::REDUCE_ORDER, id, quantity);
+    return _market.ReduceOrder(id, quantity);
+}
+
+inline ErrorCode MarketJournal::ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
+{
+    Append(JournalRecordType::MODIFY_ORDER, id, new_price, new_quantity);
+    return _market.ModifyOrder(id, new_price, new_quantity);
+}
+
+inline ErrorCode MarketJournal::MitigateOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
+{
+    Append(JournalRecordType::MITIGATE_ORDER, id, new_price, new_quantity);
+    return _market.MitigateOrder(id, new_price, new_quantity);
+}
+
+inline ErrorCode MarketJournal::ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity)
+{
+    Append(JournalRecordType::REPLACE_ORDER, id, new_id, new_price, new_quantity);
+    return _market.ReplaceOrder(id, new_id, new_price, new_quantity);
+}
+
+inline ErrorCode MarketJournal::ReplaceOrder(uint64_t id, const Order& new_order)
+{
+    Append(JournalRecordType::REPLACE_ORDER_WITH_ORDER, id, new_order);
+    return _market.ReplaceOrder(id, new_order);
+}
+
+inline ErrorCode MarketJournal::DeleteOrder(uint64_t id)
+{
+    Append(JournalRecordType::DELETE_ORDER, id);
+    return _market.DeleteOrder(id);
+}
+
+inline ErrorCode MarketJournal::ExecuteOrder(uint64_t id, uint64_t quantity)
+{
+    Append(JournalRecordType::EXECUTE_ORDER, id, quantity);
+    return _market.ExecuteOrder(id, quantity);
+}
+
+inline ErrorCode MarketJournal::ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity)
+{
+    Append(JournalRecordType::EXECUTE_ORDER_AT_PRICE, id, price, quantity);
+    return _market.ExecuteOrder(id, price, quantity);
+}
+
+inline void MarketJournal::EnableMatching()
+{
+    Append(JournalRecordType::ENABLE_MATCHING);
+    _market.EnableMatching();
+}
+
+inline void MarketJournal::DisableMatching()
+{
+    Append(JournalRecordType::DISABLE_MATCHING);
+    _market.DisableMatching();
+}
+
+inline void MarketJournal::Match()
+{
+    Append(JournalRecordType::MATCH);
+    _market.Match();
+}
+
+template <typename... TFields>
+inline void MarketJournal::Append(JournalRecordType type, const TFields&... fields)
+{
+    // Encode the record on the stack to keep the buffer lock short
+    uint8_t record[JournalRecord::RecordSize<TFields...>()];
+    size_t size = JournalRecord::Encode(record, type, fields...);
+
+    std::lock_guard<std::mutex> locker(_mutex);
+    _buffer.insert(_buffer.end(), record, record + size);
+    _size += size;
+    ++_appended;
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -9,15 +9,25 @@
 #ifndef CPPTRADER_MATCHING_MARKET_MANAGER_H
 #define CPPTRADER_MATCHING_MARKET_MANAGER_H
 
-#include "fast_hash.h"
+#include "command.h"
 #include "market_handler.h"
+#include "order_index.h"
+#include "reserved_memory_manager.h"
+#include "snapshot.h"
 
+#include "common/writer.h"
 #include "containers/hashmap.h"
+
 #include "memory/allocator_pool.h"
 
 #include <cassert>
+#include <cstring>
 #include <vector>
 
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
 namespace CppTrader {
 
 /*!
@@ -31,30 +41,41 @@ namespace Matching {
     Market manager is used to manage the market with symbols, orders and order books.
 
     Automatic orders matching can be enabled with EnableMatching() method or can be
-    manually performed with Match() method.
+    manually performed with Match() method. While automatic matching is disabled
+    the market manager keeps the list of order books which could be matched (crossed
+    order books and order books with stop orders), so Match() visits only them
+    instead of all order books of the market.
+
+    Market events are delivered to the market handler of THandler type, which is
+    bound at compile time. MarketManager uses MarketHandler with virtual handlers.
+    Custom handlers based on StaticMarketHandler or combined into MarketHandlerList
+    are called directly, so they could be inlined and empty handlers are compiled
+    away.
 
     Not thread-safe.
 */
-class MarketManager
+template <class THandler>
+class BasicMarketManager
 {
-    friend class OrderBook;
-
 public:
     //! Symbols container
     typedef std::vector<Symbol*> Symbols;
     //! Order books container
     typedef std::vector<OrderBook*> OrderBooks;
     //! Orders container
-    typedef CppCommon::HashMap<uint64_t, OrderNode*, FastHash> Orders;
+    typedef OrderIndex Orders;
+
+    BasicMarketManager();
+    BasicMarketManager(THandler& market_handler);
+    BasicMarketManager(const BasicMarketManager&) = delete;
+    BasicMarketManager(BasicMarketManager&&) = delete;
+    ~BasicMarketManager();
 
-    MarketManager();
-    MarketManager(MarketHandler& market_handler);
-    MarketManager(const MarketManager&) = delete;
-    MarketManager(MarketManager&&) = delete;
-    ~MarketManager();
+    BasicMarketManager& operator=(const BasicMarketManager&) = delete;
+    BasicMarketManager& operator=(BasicMarketManager&&) = delete;
 
-    MarketManager& operator=(const MarketManager&) = delete;
-    MarketManager& operator=(MarketManager&&) = delete;
+    //! Get the market handler
+    THandler& market_handler() noexcept { return _market_handler; }
 
     //! Get the symbols container
     const Symbols& symbols() const noexcept { return _symbols; }
@@ -62,6 +83,8 @@ public:
     const OrderBooks& order_books() const noexcept { return _order_books; }
     //! Get the orders container
     const Orders& orders() const noexcept { return _orders; }
+    //! Get the auxiliary memory manager of memory pools
+    const ReservedMemoryManager& memory_manager() const noexcept { return _auxiliary_memory_manager; }
 
     //! Get the symbol with the given Id
     /*!
@@ -206,13 +229,201 @@ public:
     */
     ErrorCode ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity);
 
+    //! Process the market command
+    /*!
+        Dispatch the given market command to the corresponding market manager method.
+
+        \param command - Market command to process
+        \return Error code
+    */
+    ErrorCode ProcessCommand(const MarketCommand& command);
+    //! Process the batch of market commands
+    /*!
+        Process market commands from the contiguous array in order and store the
+        error code of each command into the corresponding results array item.
+
+        Order index slots and order books of the next commands are prefetched
+        while the current command is processed. If automatic matching is enabled
+        the final matching pass (crossed orders and stop orders activation) is
+        performed once per touched order book at the end of the batch instead of
+        once per command. Incoming orders are still matched immediately and the matching
+        price is reset after each command, while deferred stop orders activation
+        uses the lowest market bid price and the highest market ask price seen
+        after batch commands, bounded by the current best bid and ask prices.
+
+        Batch processed from the market handler during another batch joins the
+        enclosing batch, so its matching is deferred to the end of the enclosing
+        batch as well.
+
+        \param commands - Market commands array
+        \param count - Market commands count
+        \param results - Error codes array of the same size as commands array
+        \return Count of failed commands
+    */
+    size_t ProcessBatch(const MarketCommand* commands, size_t count, ErrorCode* results);
+
     //! Is automatic matching enabled?
     bool IsMatchingEnabled() const noexcept { return _matching; }
     //! Enable automatic matching
+    /*!
+        Order books changed while automatic matching was disabled will be matched.
+    */
     void EnableMatching() { _matching = true; Match(); }
     //! Disable automatic matching
     void DisableMatching() { _matching = false; }
 
+    //! Is the conflation mode enabled?
+    bool IsConflationEnabled() const noexcept { return _conflation; }
+    //! Enable the conflation mode
+    /*!
+        In the conflation mode price level changes are collected during each market
+        operation including automatic matching and stop orders activation triggered
+        by it. At the end of the operation each changed price level is notified once
+        with its final state followed by a single order book update notification for
+        each changed order book. Price levels added and deleted during the same
+        operation are not notified at all.
+
+        Batch processing (see ProcessBatch() method) is conflated as a single
+        operation. Order notifications are not conflated.
+    */
+    void EnableConflation() { _conflation = true; }
+    //! Disable the conflation mode
+    void DisableConflation() { _conflation = false; }
+
+    //! Is the price ladder mode enabled?
+    bool IsPriceLadderEnabled() const noexcept { return _options.LadderTickSize > 0; }
+    //! Enable the price ladder mode for new order books
+    /*!
+        Price ladder keeps bid/ask and stop price levels around the best ones in a flat
+        tick-indexed ring instead of the AVL tree, so adding and deleting price
+        levels near the top of the book do not require tree rebalancing and the next
+        best price level is found with a couple of bitmap scans. Price levels outside
+        of the ladder window or not aligned to the tick size are still kept in the
+        AVL tree.
+
+        The mode is applied to order books added after the call.
+
+        \param tick_size - Price ladder tick size
+        \param ticks - Price ladder window size in ticks (default is 1024)
+    */
+    void EnablePriceLadder(uint64_t tick_size, size_t ticks = 1024) { _options.LadderTickSize = tick_size; _options.LadderTicks = ticks; }
+    //! Disable the price ladder mode for new order books
+    void DisablePriceLadder() { _options.LadderTickSize = 0; _options.LadderTicks = 0; }
+
+    //! Is the order book depth enabled?
+    bool IsDepthEnabled() const noexcept { return _options.Depth > 0; }
+    //! Enable the order book depth for new order books
+    /*!
+        Each order book keeps copies of the given count of the best bid and ask
+        price levels in contiguous arrays (see OrderBook::bid_depth() and
+        OrderBook::ask_depth() methods). Depth arrays are updated incrementally
+        with each order book change, so market data publishers could take depth
+        snapshots without walking the price levels containers.
+
+        The mode is applied to order books added after the call.
+
+        \param levels - Depth size in price levels (default is 10)
+    */
+    void EnableDepth(size_t levels = 10) { _options.Depth = levels; }
+    //! Disable the order book depth for new order books
+    void DisableDepth() { _options.Depth = 0; }
+
+    //! Is the order book depth publication enabled?
+    bool IsDepthPublicationEnabled() const noexcept { return _options.DepthPublication; }
+    //! Enable the order book depth publication for new order books
+    /*!
+        Each order book with the enabled depth (see EnableDepth() method) publishes
+        its bid and ask depth into a ring of buffers once at the end of each market
+        operation which changed the depth (see OrderBook::depth_publisher() method).
+        Analytics threads could read consistent depth snapshots without locks while
+        the market manager thread keeps on processing orders.
+
+        The mode is applied to order books added after the call.
+    */
+    void EnableDepthPublication() { _options.DepthPublication = true; }
+    //! Disable the order book depth publication for new order books
+    void DisableDepthPublication() { _options.DepthPublication = false; }
+
+    //! Is the volume index enabled?
+    bool IsVolumeIndexEnabled() const noexcept { return _options.VolumeIndex; }
+    //! Enable the volume index for new order books
+    /*!
+        Each order book keeps bid and ask volumes in volume indexes (sparse segment
+        trees over prices), so the volume available up to the given price is found
+        in O(log n) instead of walking price levels (see OrderBook::GetBidVolume()
+        and OrderBook::GetAskVolume() methods). 'Fill-Or-Kill' and 'All-Or-None'
+        orders which cannot be filled are rejected with a single volume index
+        lookup instead of walking the book. Volume indexes are updated with each
+        bid and ask price level change.
+
+        The mode is applied to order books added after the call.
+    */
+    void EnableVolumeIndex() { _options.VolumeIndex = true; }
+    //! Disable the volume index for new order books
+    void DisableVolumeIndex() { _options.VolumeIndex = false; }
+
+    //! Is the top of the book publication enabled?
+    bool IsTopOfBookEnabled() const noexcept { return _options.TopOfBook; }
+    //! Enable the top of the book publication for new order books
+    /*!
+        Each order book publishes its best bid and ask price levels and the last
+        trade price with a seqlock after each change of them (see OrderBook::top_of_book()
+        method). Strategy and risk threads could read the consistent top of the book
+        without locks while the market manager thread keeps on processing orders.
+
+        The mode is applied to order books added after the call.
+    */
+    void EnableTopOfBook() { _options.TopOfBook = true; }
+    //! Disable the top of the book publication for new order books
+    void DisableTopOfBook() { _options.TopOfBook = false; }
+
+    //! Is the direct order index enabled?
+    bool IsDirectOrderIndexEnabled() const noexcept { return _orders.enabled(); }
+    //! Enable the direct order index
+    /*!
+        Orders with Ids below the given limit are stored in the paged table directly
+        indexed by order Id instead of the hash map, so order lookups do not require
+        hashing and probing. It is useful for dense order Ids like exchange order
+        reference numbers. Orders with greater Ids are still kept in the hash map.
+
+        Orders already added to the market manager are moved into the new index.
+
+        \param limit - Direct order index limit
+    */
+    void EnableDirectOrderIndex(uint64_t limit) { _orders.SetLimit(limit); }
+    //! Disable the direct order index
+    void DisableDirectOrderIndex() { _orders.SetLimit(0); }
+
+    //! Reserve the orders container capacity
+    /*!
+        \param capacity - Orders capacity
+    */
+    void ReserveOrders(size_t capacity) { _orders.Reserve(capacity); }
+
+    //! Reserve the market capacity
+    /*!
+        Symbols and order books containers, the orders container and memory pools
+        of symbols, order books, price levels and orders are reserved for the given
+        counts, so they do not grow while the market is loaded at the market open.
+
+        Memory pools are backed by the single memory region which is prefaulted and
+        optionally backed by huge pages. Memory pools are warmed up by allocating
+        and releasing the given count of objects, so the first orders do not cause
+        page faults, system allocator calls or orders container rehashing. Memory
+        allocated by order books internally (price ladders, depth arrays, volume
+        indexes) is not reserved.
+
+        The memory region is reserved only once, the following calls only reserve
+        containers and warm up memory pools.
+
+        \param symbols - Symbols capacity (maximal symbol Id + 1)
+        \param order_books - Order books capacity (maximal symbol Id + 1)
+        \param levels - Price levels capacity of all order books
+        \param orders - Orders capacity
+        \param huge_pages - Huge pages flag (default is false)
+    */
+    void Reserve(size_t symbols, size_t order_books, size_t levels, size_t orders, bool huge_pages = false);
+
     //! Match crossed orders in all order books
     /*!
         Method will match all crossed orders in each order book. Buy orders will be
@@ -220,49 +431,171 @@ public:
         Matched orders will be executed with deleted form the order book. After the
         matching operation each order book will have the best bid price guarantied
         less than the best ask price!
+
+        Only order books which were changed since the last matching are visited,
+        so the method cost does not depend on the count of idle order books.
     */
     void Match();
 
+    //! Save the market snapshot
+    /*!
+        Market snapshot keeps all symbols, order books, price levels and orders
+        including stop and trailing stop ones together with last, matching and
+        trailing prices of each order book (see SnapshotHeader for the format).
+
+        \param writer - Snapshot writer
+        \return Error code
+    */
+    ErrorCode SaveSnapshot(CppCommon::Writer& writer) const;
+    //! Restore the market snapshot
+    /*!
+        Market manager must not have any symbols, order books and orders. Snapshot
+        is read in place, so the buffer could be a memory mapped snapshot file.
+
+        Price levels are created once for each price level record with orders
+        linked to them directly without price level lookups. The whole snapshot is
+        restored before any handler is called. If the snapshot is invalid the
+        partially restored market is released, so the market manager stays empty
+        and no handlers are called. Otherwise symbols and order books are notified
+        with the corresponding handlers. Order and price level handlers are not
+        called, instead each restored order book is notified once with
+        onUpdateOrderBook() handler.
+
+        Price ladder, depth and direct order index modes of the market manager are
+        applied to restored order books and orders.
+
+        Malformed records (including duplicate order Ids and symbol Ids above
+        SnapshotSymbol::MAX_ID) make the snapshot invalid.
+
+        \param buffer - Snapshot buffer
+        \param size - Snapshot buffer size
+        \return Error code
+    */
+    ErrorCode LoadSnapshot(const void* buffer, size_t size);
+
 private:
     // Market handler
-    static MarketHandler _default;
-    MarketHandler& _market_handler;
+    static THandler _default;
+    THandler& _market_handler;
 
     // Auxiliary memory manager
-    CppCommon::DefaultMemoryManager _auxiliary_memory_manager;
+    ReservedMemoryManager _auxiliary_memory_manager;
 
     // Bid/Ask price levels
-    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _level_memory_manager;
-    CppCommon::PoolAllocator<LevelNode, CppCommon::DefaultMemoryManager> _level_pool;
+    CppCommon::PoolMemoryManager<ReservedMemoryManager> _level_memory_manager;
+    CppCommon::PoolAllocator<LevelNode, ReservedMemoryManager> _level_pool;
 
     // Symbols
-    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _symbol_memory_manager;
-    CppCommon::PoolAllocator<Symbol, CppCommon::DefaultMemoryManager> _symbol_pool;
+    CppCommon::PoolMemoryManager<ReservedMemoryManager> _symbol_memory_manager;
+    CppCommon::PoolAllocator<Symbol, ReservedMemoryManager> _symbol_pool;
     Symbols _symbols;
 
     // Order books
-    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _order_book_memory_manager;
-    CppCommon::PoolAllocator<OrderBook, CppCommon::DefaultMemoryManager> _order_book_pool;
+    CppCommon::PoolMemoryManager<ReservedMemoryManager> _order_book_memory_manager;
+    CppCommon::PoolAllocator<OrderBook, ReservedMemoryManager> _order_book_pool;
     OrderBooks _order_books;
 
     // Orders
-    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _order_memory_manager;
-    CppCommon::PoolAllocator<OrderNode, CppCommon::DefaultMemoryManager> _order_pool;
+    CppCommon::PoolMemoryManager<ReservedMemoryManager> _order_memory_manager;
+    CppCommon::PoolAllocator<OrderNode, ReservedMemoryManager> _order_pool;
     Orders _orders;
 
+    // Release all orders, order books and symbols
+    void ReleaseMarket();
+
+    // Memory pools allocate their pages in 64 KiB chunks
+    static const size_t RESERVE_SLACK = 4 * 65536;
+
+    static void WarmUpPool(CppCommon::PoolMemoryManager<ReservedMemoryManager>& memory_manager, size_t size, size_t alignment, size_t count);
+
+    // Options of new order books
+    OrderBookOptions _options;
+
+    // Order books with the depth pending for publication at the end of the market operation
+    std::vector<OrderBook*> _depth_order_books;
+
+    void PublishDepth(OrderBook& order_book);
+    void PublishPendingDepth();
+
     ErrorCode AddMarketOrder(const Order& order, bool recursive);
     ErrorCode AddLimitOrder(const Order& order, bool recursive);
     ErrorCode AddStopOrder(const Order& order, bool recursive);
     ErrorCode AddStopLimitOrder(const Order& order, bool recursive);
-    ErrorCode ReduceOrder(uint64_t id, uint64_t quantity, bool recursive);
+    void ReduceOrder(OrderBook* order_book_ptr, OrderNode* order_ptr, uint64_t quantity, bool recursive);
     ErrorCode ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity, bool mitigate, bool recursive);
     ErrorCode ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity, bool recursive);
-    ErrorCode DeleteOrder(uint64_t id, bool recursive);
+    void DeleteOrder(OrderBook* order_book_ptr, OrderNode* order_ptr, bool recursive);
+    void ExecuteOrder(OrderBook* order_book_ptr, OrderNode* order_ptr, uint64_t price, uint64_t quantity);
 
     // Matching
     bool _matching;
 
+    // Batch processing
+    bool _batch;
+
+    // Order books pending for matching
+    std::vector<uint32_t> _pending_order_books;
+
+    void MarkPending(OrderBook* order_book_ptr);
+    void MatchPending();
+
+    static const size_t BATCH_PREFETCH_DISTANCE = 8;
+
+    void PrefetchCommand(const MarketCommand& command) const;
+
+    // Conflation mode
+    bool _conflation;
+    size_t _conflation_depth;
+    // Conflated price level key
+    struct ConflatedLevel
+    {
+        const OrderBook* OrderBookPtr;
+        LevelType Type;
+        uint64_t Price;
+
+        friend bool operator==(const ConflatedLevel& level1, const ConflatedLevel& level2) noexcept
+        { return (level1.OrderBookPtr == level2.OrderBookPtr) && (level1.Type == level2.Type) && (level1.Price == level2.Price); }
+    };
+    struct ConflatedLevelHash
+    {
+        size_t operator()(const ConflatedLevel& level) const noexcept
+        { return FastHash()(level.Price ^ ((uint64_t)(uintptr_t)level.OrderBookPtr << 1) ^ (uint64_t)level.Type); }
+    };
+    // Conflated price level updates are kept in order books, the hash map
+    // maps the price level to its update index in the order book
+    CppCommon::HashMap<ConflatedLevel, size_t, ConflatedLevelHash> _conflated_levels;
+    std::vector<OrderBook*> _conflated_order_books;
+
+    // Conflation scope of the market operation
+    class ConflationScope
+    {
+    public:
+        explicit ConflationScope(BasicMarketManager& manager) noexcept : _manager(manager) { ++_manager._conflation_depth; }
+        ConflationScope(const ConflationScope&) = delete;
+        ConflationScope(ConflationScope&&) = delete;
+        ~ConflationScope()
+        {
+            if (--_manager._conflation_depth == 0)
+            {
+                if (!_manager._conflated_order_books.empty())
+                    _manager.FlushLevels();
+                if (!_manager._depth_order_books.empty())
+                    _manager.PublishPendingDepth();
+            }
+        }
+
+        ConflationScope& operator=(const ConflationScope&) = delete;
+        ConflationScope& operator=(ConflationScope&&) = delete;
+
+    private:
+        BasicMarketManager& _manager;
+    };
+
+    void ConflateLevel(OrderBook& order_book, const LevelUpdate& update);
+    void FlushLevels();
+
     void Match(OrderBook* order_book_ptr);
+    void MatchOrderBook(OrderBook* order_book_ptr, bool recursive);
     void MatchMarket(OrderBook* order_book_ptr, Order* order_ptr);
     void MatchLimit(OrderBook* order_book_ptr, Order* order_ptr);
     void MatchOrder(OrderBook* order_book_ptr, Order* order_ptr);
@@ -277,9 +610,23 @@ private:
     void ExecuteMatchingChain(OrderBook* order_book_ptr, LevelNode* level_ptr, uint64_t price, uint64_t volume);
     void RecalculateTrailingStopPrice(OrderBook* order_book_ptr, LevelNode* level_ptr);
 
-    void UpdateLevel(const OrderBook& order_book, const LevelUpdate& update) const;
+    // Trailing stop orders to reprice with their new stop prices
+    std::vector<std::pair<OrderNode*, uint64_t>> _trailing_orders;
+
+    void UpdateLevel(OrderBook& order_book, const LevelUpdate& update);
+
+    static const size_t SNAPSHOT_BUFFER_SIZE = 65536;
+
+    ErrorCode RestoreSnapshot(const SnapshotHeader& header, const uint8_t*& data, const uint8_t* end);
+    ErrorCode LoadSnapshotLevel(OrderBook* order_book_ptr, size_t container, const uint8_t*& data, const uint8_t* end);
+    static bool ReadSnapshotRecord(void* record, size_t size, const uint8_t*& data, const uint8_t* end) noexcept;
 };
 
+//! Market manager with virtual market handler
+typedef BasicMarketManager<MarketHandler> MarketManager;
+
+extern template class BasicMarketManager<MarketHandler>;
+
 /*! \example market_manager.cpp Market manager example */
 /*! \example matching_engine.cpp Matching engine example */
 
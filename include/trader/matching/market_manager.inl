@@ -9,12 +9,17 @@
 namespace CppTrader {
 namespace Matching {
 
-inline MarketManager::MarketManager()
-    : MarketManager(_default)
+template <class THandler>
+THandler BasicMarketManager<THandler>::_default;
+
+template <class THandler>
+inline BasicMarketManager<THandler>::BasicMarketManager()
+    : BasicMarketManager(_default)
 {
 }
 
-inline MarketManager::MarketManager(MarketHandler& market_handler)
+template <class THandler>
+inline BasicMarketManager<THandler>::BasicMarketManager(THandler& market_handler)
     : _market_handler(market_handler),
       _auxiliary_memory_manager(),
       _level_memory_manager(_auxiliary_memory_manager),
@@ -25,30 +30,2457 @@ inline MarketManager::MarketManager(MarketHandler& market_handler)
       _order_book_pool(_order_book_memory_manager),
       _order_memory_manager(_auxiliary_memory_manager),
       _order_pool(_order_memory_manager),
-      _orders(16384, 0),
-      _matching(false)
+      _matching(false),
+      _batch(false),
+      _conflation(false),
+      _conflation_depth(0)
 {
 
 }
 
-inline const Symbol* MarketManager::GetSymbol(uint32_t id) const noexcept
+template <class THandler>
+inline const Symbol* BasicMarketManager<THandler>::GetSymbol(uint32_t id) const noexcept
 {
     return ((id < _symbols.size()) ? _symbols[id] : nullptr);
 }
 
-inline const OrderBook* MarketManager::GetOrderBook(uint32_t id) const noexcept
+template <class THandler>
+inline const OrderBook* BasicMarketManager<THandler>::GetOrderBook(uint32_t id) const noexcept
 {
     return ((id < _order_books.size()) ? _order_books[id] : nullptr);
 }
 
-inline const Order* MarketManager::GetOrder(uint64_t id) const noexcept
+template <class THandler>
+inline const Order* BasicMarketManager<THandler>::GetOrder(uint64_t id) const noexcept
 {
     assert((id > 0) && "Order Id must be greater than zero!");
     if (id == 0)
         return nullptr;
 
-    auto it = _orders.find(id);
-    return ((it != _orders.end()) ? it->second : nullptr);
+    return _orders.Find(id);
+}
+
+template <class THandler>
+inline BasicMarketManager<THandler>::~BasicMarketManager()
+{
+    ReleaseMarket();
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::ReleaseMarket()
+{
+    // Release orders
+    for (const auto& order : _orders)
+        _order_pool.Release(order.second);
+    _orders.Clear();
+
+    // Release order books
+    for (auto order_book_ptr : _order_books)
+        if (order_book_ptr != nullptr)
+            _order_book_pool.Release(order_book_ptr);
+    _order_books.clear();
+
+    // Release symbols
+    for (auto symbol_ptr : _symbols)
+        if (symbol_ptr != nullptr)
+            _symbol_pool.Release(symbol_ptr);
+    _symbols.clear();
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::Reserve(size_t symbols, size_t order_books, size_t levels, size_t orders, bool huge_pages)
+{
+    // Reserve containers
+    _symbols.reserve(symbols);
+    _order_books.reserve(order_books);
+    _pending_order_books.reserve(order_books);
+    _orders.Reserve(orders);
+
+    // Reserve the memory region for memory pools with the space for their pages
+    // bookkeeping and partially used pages
+    size_t capacity = symbols * sizeof(Symbol) + order_books * sizeof(OrderBook) + levels * sizeof(LevelNode) + orders * sizeof(OrderNode);
+    if ((capacity > 0) && (_auxiliary_memory_manager.capacity() == 0))
+        _auxiliary_memory_manager.Reserve(capacity + capacity / 8 + RESERVE_SLACK, huge_pages);
+
+    // Warm up memory pools
+    WarmUpPool(_symbol_memory_manager, sizeof(Symbol), alignof(Symbol), symbols);
+    WarmUpPool(_order_book_memory_manager, sizeof(OrderBook), alignof(OrderBook), order_books);
+    WarmUpPool(_level_memory_manager, sizeof(LevelNode), alignof(LevelNode), levels);
+    WarmUpPool(_order_memory_manager, sizeof(OrderNode), alignof(OrderNode), orders);
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::WarmUpPool(CppCommon::PoolMemoryManager<ReservedMemoryManager>& memory_manager, size_t size, size_t alignment, size_t count)
+{
+    // Allocate and touch the given count of memory blocks linked into the list
+    void* blocks = nullptr;
+    for (size_t i = 0; i < count; ++i)
+    {
+        void* block = memory_manager.malloc(size, alignment);
+        if (block == nullptr)
+            break;
+        std::memset(block, 0, size);
+        *(void**)block = blocks;
+        blocks = block;
+    }
+
+    // Release memory blocks into the memory pool for the reuse
+    while (blocks != nullptr)
+    {
+        void* next = *(void**)blocks;
+        memory_manager.free(blocks, size);
+        blocks = next;
+    }
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddSymbol(const Symbol& symbol)
+{
+    // Resize the symbol container
+    if (_symbols.size() <= symbol.Id)
+        _symbols.resize(symbol.Id + 1, nullptr);
+
+    // Create a new symbol
+    Symbol* symbol_ptr = _symbol_pool.Create(symbol);
+
+    // Insert the symbol
+    assert((_symbols[symbol.Id] == nullptr) && "Duplicate symbol detected!");
+    if (_symbols[symbol.Id] != nullptr)
+    {
+        // Release the symbol
+        _symbol_pool.Release(symbol_ptr);
+        return ErrorCode::SYMBOL_DUPLICATE;
+    }
+    _symbols[symbol.Id] = symbol_ptr;
+
+    // Call the corresponding handler
+    _market_handler.onAddSymbol(*symbol_ptr);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::DeleteSymbol(uint32_t id)
+{
+    assert(((id < _symbols.size()) && (_symbols[id] != nullptr)) && "Symbol not found!");
+    if ((_symbols.size() <= id) || (_symbols[id] == nullptr))
+        return ErrorCode::SYMBOL_NOT_FOUND;
+
+    // Get the symbol by Id
+    Symbol* symbol_ptr = _symbols[id];
+
+    // Call the corresponding handler
+    _market_handler.onDeleteSymbol(*symbol_ptr);
+
+    // Erase the symbol
+    _symbols[id] = nullptr;
+
+    // Release the symbol
+    _symbol_pool.Release(symbol_ptr);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddOrderBook(const Symbol& symbol)
+{
+    assert(((symbol.Id < _symbols.size()) && (_symbols[symbol.Id] != nullptr)) && "Symbol not found!");
+    if ((_symbols.size() <= symbol.Id) || (_symbols[symbol.Id] == nullptr))
+        return ErrorCode::SYMBOL_NOT_FOUND;
+
+    // Get the symbol by Id
+    Symbol* symbol_ptr = _symbols[symbol.Id];
+
+    // Resize the order book container
+    if (_order_books.size() <= symbol.Id)
+        _order_books.resize(symbol.Id + 1, nullptr);
+
+    // Create a new order book
+    OrderBook* order_book_ptr = _order_book_pool.Create(_level_pool, *symbol_ptr, _options);
+
+    // Insert the order book
+    assert((_order_books[symbol.Id] == nullptr) && "Duplicate order book detected!");
+    if (_order_books[symbol.Id] != nullptr)
+    {
+        // Release the order book
+        _order_book_pool.Release(order_book_ptr);
+        return ErrorCode::ORDER_BOOK_DUPLICATE;
+    }
+    _order_books[symbol.Id] = order_book_ptr;
+
+    // Call the corresponding handler
+    _market_handler.onAddOrderBook(*order_book_ptr);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::DeleteOrderBook(uint32_t id)
+{
+    assert(((id < _order_books.size()) && (_order_books[id] != nullptr)) && "Order book not found!");
+    if ((_order_books.size() <= id) || (_order_books[id] == nullptr))
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Get the order book by Id
+    OrderBook* order_book_ptr = _order_books[id];
+
+    // Flush conflated price levels before the order book is released
+    if (!_conflated_order_books.empty())
+        FlushLevels();
+
+    // Publish pending depth before the order book is released
+    if (!_depth_order_books.empty())
+        PublishPendingDepth();
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrderBook(*order_book_ptr);
+
+    // Erase the order book
+    _order_books[id] = nullptr;
+
+    // Release the order book
+    _order_book_pool.Release(order_book_ptr);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddOrder(const Order& order)
+{
+    ConflationScope scope(*this);
+
+    // Validate order parameters
+    ErrorCode result = order.Validate();
+    if (result != ErrorCode::OK)
+        return result;
+
+    // Add the corresponding order type
+    switch (order.Type)
+    {
+        case OrderType::MARKET:
+            return AddMarketOrder(order, false);
+        case OrderType::LIMIT:
+            return AddLimitOrder(order, false);
+        case OrderType::STOP:
+        case OrderType::TRAILING_STOP:
+            return AddStopOrder(order, false);
+        case OrderType::STOP_LIMIT:
+        case OrderType::TRAILING_STOP_LIMIT:
+            return AddStopLimitOrder(order, false);
+        default:
+            return ErrorCode::ORDER_TYPE_INVALID;
+    }
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddMarketOrder(const Order& order, bool recursive)
+{
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order.SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    Order new_order(order);
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(new_order);
+
+    // Automatic order matching
+    if (_matching && !recursive)
+        MatchMarket(order_book_ptr, &new_order);
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(new_order);
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddLimitOrder(const Order& order, bool recursive)
+{
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order.SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    Order new_order(order);
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(new_order);
+
+    // Automatic order matching
+    if (_matching && !recursive)
+        MatchLimit(order_book_ptr, &new_order);
+
+    // Add a new order or delete remaining part in case of 'Immediate-Or-Cancel'/'Fill-Or-Kill' order
+    if ((new_order.LeavesQuantity > 0) && !new_order.IsIOC() && !new_order.IsFOK())
+    {
+        // Create a new order
+        OrderNode* order_ptr = _order_pool.Create(new_order);
+
+        // Insert the order
+        if (!_orders.Insert(order_ptr))
+        {
+            // Call the corresponding handler
+            _market_handler.onDeleteOrder(*order_ptr);
+
+            // Release the order
+            _order_pool.Release(order_ptr);
+
+            return ErrorCode::ORDER_DUPLICATE;
+        }
+
+        // Add the new limit order into the order book
+        UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(new_order);
+    }
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddStopOrder(const Order& order, bool recursive)
+{
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order.SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    Order new_order(order);
+
+    // Recalculate stop price for trailing stop orders
+    if (new_order.IsTrailingStop() || new_order.IsTrailingStopLimit())
+        new_order.StopPrice = order_book_ptr->CalculateTrailingStopPrice(new_order);
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(new_order);
+
+    // Automatic order matching
+    if (_matching && !recursive)
+    {
+        // Find the price to match the stop order
+        uint64_t stop_price = new_order.IsBuy() ? order_book_ptr->GetMarketPriceAsk() : order_book_ptr->GetMarketPriceBid();
+
+        // Check the arbitrage bid/ask prices
+        bool arbitrage = new_order.IsBuy() ? (new_order.StopPrice <= stop_price) : (new_order.StopPrice >= stop_price);
+        if (arbitrage)
+        {
+            // Convert the stop order into the market order
+            new_order.Type = OrderType::MARKET;
+            new_order.Price = 0;
+            new_order.StopPrice = 0;
+            new_order.TimeInForce = new_order.IsFOK() ? OrderTimeInForce::FOK : OrderTimeInForce::IOC;
+
+            // Call the corresponding handler
+            _market_handler.onUpdateOrder(new_order);
+
+            // Match the market order
+            MatchMarket(order_book_ptr, &new_order);
+
+            // Call the corresponding handler
+            _market_handler.onDeleteOrder(new_order);
+
+            // Automatic order matching and reset matching price
+            MatchOrderBook(order_book_ptr, recursive);
+
+            return ErrorCode::OK;
+        }
+    }
+
+    // Add a new order
+    if (new_order.LeavesQuantity > 0)
+    {
+        // Create a new order
+        OrderNode* order_ptr = _order_pool.Create(new_order);
+
+        // Insert the order
+        if (!_orders.Insert(order_ptr))
+        {
+            // Call the corresponding handler
+            _market_handler.onDeleteOrder(*order_ptr);
+
+            // Release the order
+            _order_pool.Release(order_ptr);
+
+            return ErrorCode::ORDER_DUPLICATE;
+        }
+
+        // Add the new stop order into the order book
+        if (order_ptr->IsTrailingStop() || order_ptr->IsTrailingStopLimit())
+            order_book_ptr->AddTrailingStopOrder(order_ptr);
+        else
+            order_book_ptr->AddStopOrder(order_ptr);
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(new_order);
+    }
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::AddStopLimitOrder(const Order& order, bool recursive)
+{
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order.SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    Order new_order(order);
+
+    // Recalculate stop price for trailing stop orders
+    if (new_order.IsTrailingStop() || new_order.IsTrailingStopLimit())
+    {
+        int64_t diff = new_order.Price - new_order.StopPrice;
+        new_order.StopPrice = order_book_ptr->CalculateTrailingStopPrice(new_order);
+        new_order.Price = new_order.StopPrice + diff;
+    }
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(new_order);
+
+    // Automatic order matching
+    if (_matching && !recursive)
+    {
+        // Find the price to match the stop-limit order
+        uint64_t stop_price = new_order.IsBuy() ? order_book_ptr->GetMarketPriceAsk() : order_book_ptr->GetMarketPriceBid();
+
+        // Check the arbitrage bid/ask prices
+        bool arbitrage = new_order.IsBuy() ? (new_order.StopPrice <= stop_price) : (new_order.StopPrice >= stop_price);
+        if (arbitrage)
+        {
+            // Convert the stop-limit order into the limit order
+            new_order.Type = OrderType::LIMIT;
+            new_order.StopPrice = 0;
+
+            // Call the corresponding handler
+            _market_handler.onUpdateOrder(new_order);
+
+            // Match the limit order
+            MatchLimit(order_book_ptr, &new_order);
+
+            // Add a new limit order or delete remaining part in case of 'Immediate-Or-Cancel'/'Fill-Or-Kill' order
+            if ((new_order.LeavesQuantity > 0) && !new_order.IsIOC() && !new_order.IsFOK())
+            {
+                // Create a new order
+                OrderNode* order_ptr = _order_pool.Create(new_order);
+
+                // Insert the order
+                if (!_orders.Insert(order_ptr))
+                {
+                    // Call the corresponding handler
+                    _market_handler.onDeleteOrder(*order_ptr);
+
+                    // Release the order
+                    _order_pool.Release(order_ptr);
+
+                    return ErrorCode::ORDER_DUPLICATE;
+                }
+
+                // Add the new limit order into the order book
+                UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+            }
+            else
+            {
+                // Call the corresponding handler
+                _market_handler.onDeleteOrder(new_order);
+            }
+
+            // Automatic order matching and reset matching price
+            MatchOrderBook(order_book_ptr, recursive);
+
+            return ErrorCode::OK;
+        }
+    }
+
+    // Add a new order
+    if (new_order.LeavesQuantity > 0)
+    {
+        // Create a new order
+        OrderNode* order_ptr = _order_pool.Create(new_order);
+
+        // Insert the order
+        if (!_orders.Insert(order_ptr))
+        {
+            // Call the corresponding handler
+            _market_handler.onDeleteOrder(*order_ptr);
+
+            // Release the order
+            _order_pool.Release(order_ptr);
+
+            return ErrorCode::ORDER_DUPLICATE;
+        }
+
+        // Add the new stop order into the order book
+        if (order_ptr->IsTrailingStop() || order_ptr->IsTrailingStopLimit())
+            order_book_ptr->AddTrailingStopOrder(order_ptr);
+        else
+            order_book_ptr->AddStopOrder(order_ptr);
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(new_order);
+    }
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ReduceOrder(uint64_t id, uint64_t quantity)
+{
+    ConflationScope scope(*this);
+
+    // Validate parameters
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    assert((quantity > 0) && "Order quantity must be greater than zero!");
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to reduce
+    OrderNode* order_ptr = _orders.Find(id);
+    assert((order_ptr != nullptr) && "Order not found!");
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Reduce the order
+    ReduceOrder(order_book_ptr, order_ptr, quantity, false);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::ReduceOrder(OrderBook* order_book_ptr, OrderNode* order_ptr, uint64_t quantity, bool recursive)
+{
+    // Calculate the minimal possible order quantity to reduce
+    quantity = std::min(quantity, order_ptr->LeavesQuantity);
+
+    uint64_t hidden = order_ptr->HiddenQuantity();
+    uint64_t visible = order_ptr->VisibleQuantity();
+
+    // Reduce the order leaves quantity
+    order_ptr->LeavesQuantity -= quantity;
+
+    hidden -= order_ptr->HiddenQuantity();
+    visible -= order_ptr->VisibleQuantity();
+
+    // Update the order or delete the empty order
+    if (order_ptr->LeavesQuantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+
+        // Reduce the order in the order book
+        switch (order_ptr->Type)
+        {
+            case OrderType::LIMIT:
+                UpdateLevel(*order_book_ptr, order_book_ptr->ReduceOrder(order_ptr, quantity, hidden, visible));
+                break;
+            case OrderType::STOP:
+            case OrderType::STOP_LIMIT:
+                order_book_ptr->ReduceStopOrder(order_ptr, quantity, hidden, visible);
+                break;
+            case OrderType::TRAILING_STOP:
+            case OrderType::TRAILING_STOP_LIMIT:
+                order_book_ptr->ReduceTrailingStopOrder(order_ptr, quantity, hidden, visible);
+                break;
+            default:
+                assert(false && "Unsupported order type!");
+                break;
+        }
+     }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Reduce the order in the order book
+        switch (order_ptr->Type)
+        {
+            case OrderType::LIMIT:
+                UpdateLevel(*order_book_ptr, order_book_ptr->ReduceOrder(order_ptr, quantity, hidden, visible));
+                break;
+            case OrderType::STOP:
+            case OrderType::STOP_LIMIT:
+                order_book_ptr->ReduceStopOrder(order_ptr, quantity, hidden, visible);
+                break;
+            case OrderType::TRAILING_STOP:
+            case OrderType::TRAILING_STOP_LIMIT:
+                order_book_ptr->ReduceTrailingStopOrder(order_ptr, quantity, hidden, visible);
+                break;
+            default:
+                assert(false && "Unsupported order type!");
+                break;
+        }
+
+        // Erase the order
+        _orders.Erase(order_ptr->Id);
+
+        // Relase the order
+        _order_pool.Release(order_ptr);
+    }
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
+{
+    ConflationScope scope(*this);
+
+    return ModifyOrder(id, new_price, new_quantity, false, false);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::MitigateOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
+{
+    ConflationScope scope(*this);
+
+    return ModifyOrder(id, new_price, new_quantity, true, false);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity, bool mitigate, bool recursive)
+{
+    // Validate parameters
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    assert((new_quantity > 0) && "Order quantity must be greater than zero!");
+    if (new_quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to modify
+    OrderNode* order_ptr = _orders.Find(id);
+    assert((order_ptr != nullptr) && "Order not found!");
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Delete the order from the order book
+    switch (order_ptr->Type)
+    {
+        case OrderType::LIMIT:
+            UpdateLevel(*order_book_ptr, order_book_ptr->DeleteOrder(order_ptr));
+            break;
+        case OrderType::STOP:
+        case OrderType::STOP_LIMIT:
+            order_book_ptr->DeleteStopOrder(order_ptr);
+            break;
+        case OrderType::TRAILING_STOP:
+        case OrderType::TRAILING_STOP_LIMIT:
+            order_book_ptr->DeleteTrailingStopOrder(order_ptr);
+            break;
+        default:
+            assert(false && "Unsupported order type!");
+            break;
+    }
+
+    // Modify the order
+    order_ptr->Price = new_price;
+    order_ptr->Quantity = new_quantity;
+    order_ptr->LeavesQuantity = new_quantity;
+
+    // In-Flight Mitigation (IFM)
+    if (mitigate)
+    {
+        // This calculation has the goal of preventing orders from being overfilled
+        if (new_quantity > order_ptr->ExecutedQuantity)
+            order_ptr->LeavesQuantity = new_quantity - order_ptr->ExecutedQuantity;
+        else
+            order_ptr->LeavesQuantity = 0;
+    }
+
+    // Update the order
+    if (order_ptr->LeavesQuantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+
+        // Automatic order matching
+        if (_matching && !recursive)
+            MatchLimit(order_book_ptr, order_ptr);
+
+        // Add non empty order into the order book
+        if (order_ptr->LeavesQuantity > 0)
+        {
+            // Add the modified order into the order book
+            switch (order_ptr->Type)
+            {
+                case OrderType::LIMIT:
+                    UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+                    break;
+                case OrderType::STOP:
+                case OrderType::STOP_LIMIT:
+                    order_book_ptr->AddStopOrder(order_ptr);
+                    break;
+                case OrderType::TRAILING_STOP:
+                case OrderType::TRAILING_STOP_LIMIT:
+                    order_book_ptr->AddTrailingStopOrder(order_ptr);
+                    break;
+                default:
+                    assert(false && "Unsupported order type!");
+                    break;
+            }
+        }
+    }
+
+    // Delete the empty order
+    if (order_ptr->LeavesQuantity == 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Erase the order
+        _orders.Erase(order_ptr->Id);
+
+        // Relase the order
+        _order_pool.Release(order_ptr);
+    }
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity)
+{
+    ConflationScope scope(*this);
+
+    return ReplaceOrder(id, new_id, new_price, new_quantity, false);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity, bool recursive)
+{
+    // Validate parameters
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    assert((new_id > 0) && "New order Id must be greater than zero!");
+    if (new_id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    assert((new_quantity > 0) && "Order quantity must be greater than zero!");
+    if (new_quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to replace
+    OrderNode* order_ptr = _orders.Find(id);
+    assert((order_ptr != nullptr) && "Order not found!");
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+    assert(order_ptr->IsLimit() && "Replace order operation is valid only for limit orders!");
+    if (!order_ptr->IsLimit())
+        return ErrorCode::ORDER_TYPE_INVALID;
+
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Delete the old order from the order book
+    switch (order_ptr->Type)
+    {
+        case OrderType::LIMIT:
+            UpdateLevel(*order_book_ptr, order_book_ptr->DeleteOrder(order_ptr));
+            break;
+        case OrderType::STOP:
+        case OrderType::STOP_LIMIT:
+            order_book_ptr->DeleteStopOrder(order_ptr);
+            break;
+        case OrderType::TRAILING_STOP:
+        case OrderType::TRAILING_STOP_LIMIT:
+            order_book_ptr->DeleteTrailingStopOrder(order_ptr);
+            break;
+        default:
+            assert(false && "Unsupported order type!");
+            break;
+    }
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the order
+    _orders.Erase(order_ptr->Id);
+
+    // Replace the order
+    order_ptr->Id = new_id;
+    order_ptr->Price = new_price;
+    order_ptr->Quantity = new_quantity;
+    order_ptr->ExecutedQuantity = 0;
+    order_ptr->LeavesQuantity = new_quantity;
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(*order_ptr);
+
+    // Automatic order matching
+    if (_matching && !recursive)
+        MatchLimit(order_book_ptr, order_ptr);
+
+    if (order_ptr->LeavesQuantity > 0)
+    {
+        // Insert the order
+        if (!_orders.Insert(order_ptr))
+        {
+            // Call the corresponding handler
+            _market_handler.onDeleteOrder(*order_ptr);
+
+            // Release the order
+            _order_pool.Release(order_ptr);
+
+            return ErrorCode::ORDER_DUPLICATE;
+        }
+
+        // Add the modified order into the order book
+        switch (order_ptr->Type)
+        {
+            case OrderType::LIMIT:
+                UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+                break;
+            case OrderType::STOP:
+            case OrderType::STOP_LIMIT:
+                order_book_ptr->AddStopOrder(order_ptr);
+                break;
+            case OrderType::TRAILING_STOP:
+            case OrderType::TRAILING_STOP_LIMIT:
+                order_book_ptr->AddTrailingStopOrder(order_ptr);
+                break;
+            default:
+                assert(false && "Unsupported order type!");
+                break;
+        }
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Relase the order
+        _order_pool.Release(order_ptr);
+    }
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ReplaceOrder(uint64_t id, const Order& new_order)
+{
+    ConflationScope scope(*this);
+
+    // Delete the previous order by Id
+    ErrorCode result = DeleteOrder(id);
+    if (result != ErrorCode::OK)
+        return result;
+
+    // Add the new order
+    return AddOrder(new_order);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::DeleteOrder(uint64_t id)
+{
+    ConflationScope scope(*this);
+
+    // Validate parameters
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+
+    // Get the order to delete
+    OrderNode* order_ptr = _orders.Find(id);
+    assert((order_ptr != nullptr) && "Order not found!");
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Delete the order
+    DeleteOrder(order_book_ptr, order_ptr, false);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::DeleteOrder(OrderBook* order_book_ptr, OrderNode* order_ptr, bool recursive)
+{
+    // Delete the order from the order book
+    switch (order_ptr->Type)
+    {
+        case OrderType::LIMIT:
+            UpdateLevel(*order_book_ptr, order_book_ptr->DeleteOrder(order_ptr));
+            break;
+        case OrderType::STOP:
+        case OrderType::STOP_LIMIT:
+            order_book_ptr->DeleteStopOrder(order_ptr);
+            break;
+        case OrderType::TRAILING_STOP:
+        case OrderType::TRAILING_STOP_LIMIT:
+            order_book_ptr->DeleteTrailingStopOrder(order_ptr);
+            break;
+        default:
+            assert(false && "Unsupported order type!");
+            break;
+    }
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the order
+    _orders.Erase(order_ptr->Id);
+
+    // Relase the order
+    _order_pool.Release(order_ptr);
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, recursive);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ExecuteOrder(uint64_t id, uint64_t quantity)
+{
+    ConflationScope scope(*this);
+
+    // Validate parameters
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    assert((quantity > 0) && "Order quantity must be greater than zero!");
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to execute
+    OrderNode* order_ptr = _orders.Find(id);
+    assert((order_ptr != nullptr) && "Order not found!");
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Execute the order
+    ExecuteOrder(order_book_ptr, order_ptr, order_ptr->Price, quantity);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity)
+{
+    ConflationScope scope(*this);
+
+    // Validate parameters
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    assert((quantity > 0) && "Order quantity must be greater than zero!");
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to execute
+    OrderNode* order_ptr = _orders.Find(id);
+    assert((order_ptr != nullptr) && "Order not found!");
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Execute the order
+    ExecuteOrder(order_book_ptr, order_ptr, price, quantity);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::ExecuteOrder(OrderBook* order_book_ptr, OrderNode* order_ptr, uint64_t price, uint64_t quantity)
+{
+    // Calculate the minimal possible order quantity to execute
+    quantity = std::min(quantity, order_ptr->LeavesQuantity);
+
+    // Call the corresponding handler
+    _market_handler.onExecuteOrder(*order_ptr, price, quantity);
+
+    // Update the corresponding market price
+    order_book_ptr->UpdateLastPrice(*order_ptr, price);
+    order_book_ptr->UpdateMatchingPrice(*order_ptr, price);
+
+    uint64_t hidden = order_ptr->HiddenQuantity();
+    uint64_t visible = order_ptr->VisibleQuantity();
+
+    // Increase the order executed quantity
+    order_ptr->ExecutedQuantity += quantity;
+
+    // Reduce the order leaves quantity
+    order_ptr->LeavesQuantity -= quantity;
+
+    hidden -= order_ptr->HiddenQuantity();
+    visible -= order_ptr->VisibleQuantity();
+
+    // Reduce the order in the order book
+    bool top = false;
+    switch (order_ptr->Type)
+    {
+        case OrderType::LIMIT:
+        {
+            LevelUpdate update = order_book_ptr->ReduceOrder(order_ptr, quantity, hidden, visible);
+            top = update.Top;
+            UpdateLevel(*order_book_ptr, update);
+            break;
+        }
+        case OrderType::STOP:
+        case OrderType::STOP_LIMIT:
+            order_book_ptr->ReduceStopOrder(order_ptr, quantity, hidden, visible);
+            break;
+        case OrderType::TRAILING_STOP:
+        case OrderType::TRAILING_STOP_LIMIT:
+            order_book_ptr->ReduceTrailingStopOrder(order_ptr, quantity, hidden, visible);
+            break;
+        default:
+            assert(false && "Unsupported order type!");
+            break;
+    }
+
+    // Update the order or delete the empty order
+    if (order_ptr->LeavesQuantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Erase the order
+        _orders.Erase(order_ptr->Id);
+
+        // Relase the order
+        _order_pool.Release(order_ptr);
+    }
+
+    // Publish the last trade price of the order executed outside of the top of
+    // the book (the top of the book price level update is already published)
+    if (!top)
+        order_book_ptr->PublishTopOfBook();
+
+    // Automatic order matching and reset matching price
+    MatchOrderBook(order_book_ptr, false);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::ProcessCommand(const MarketCommand& command)
+{
+    switch (command.Type)
+    {
+        case MarketCommandType::ADD_SYMBOL:
+            return AddSymbol(command.NewSymbol);
+        case MarketCommandType::DELETE_SYMBOL:
+            return DeleteSymbol(command.SymbolId);
+        case MarketCommandType::ADD_ORDER_BOOK:
+            return AddOrderBook(command.NewSymbol);
+        case MarketCommandType::DELETE_ORDER_BOOK:
+            return DeleteOrderBook(command.SymbolId);
+        case MarketCommandType::ADD_ORDER:
+            return AddOrder(command.NewOrder);
+        case MarketCommandType::REDUCE_ORDER:
+            return ReduceOrder(command.Params.Id, command.Params.Quantity);
+        case MarketCommandType::MODIFY_ORDER:
+            return ModifyOrder(command.Params.Id, command.Params.Price, command.Params.Quantity);
+        case MarketCommandType::MITIGATE_ORDER:
+            return MitigateOrder(command.Params.Id, command.Params.Price, command.Params.Quantity);
+        case MarketCommandType::REPLACE_ORDER:
+            return ReplaceOrder(command.Params.Id, command.Params.NewId, command.Params.Price, command.Params.Quantity);
+        case MarketCommandType::DELETE_ORDER:
+            return DeleteOrder(command.Params.Id);
+        case MarketCommandType::EXECUTE_ORDER:
+            return ExecuteOrder(command.Params.Id, command.Params.Quantity);
+        case MarketCommandType::EXECUTE_ORDER_AT_PRICE:
+            return ExecuteOrder(command.Params.Id, command.Params.Price, command.Params.Quantity);
+        case MarketCommandType::ENABLE_MATCHING:
+            EnableMatching();
+            return ErrorCode::OK;
+        case MarketCommandType::DISABLE_MATCHING:
+            DisableMatching();
+            return ErrorCode::OK;
+        case MarketCommandType::MATCH:
+            Match();
+            return ErrorCode::OK;
+        default:
+            assert(false && "Unsupported market command type!");
+            return ErrorCode::ORDER_PARAMETER_INVALID;
+    }
+}
+
+template <class THandler>
+inline size_t BasicMarketManager<THandler>::ProcessBatch(const MarketCommand* commands, size_t count, ErrorCode* results)
+{
+    ConflationScope scope(*this);
+
+    // Nested batch from the market handler joins the enclosing batch
+    bool nested = _batch;
+
+    size_t errors = 0;
+
+    // Prefetch the first commands
+    for (size_t i = 0; (i < BATCH_PREFETCH_DISTANCE) && (i < count); ++i)
+        PrefetchCommand(commands[i]);
+
+    // Process commands with deferred matching
+    _batch = true;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if ((i + BATCH_PREFETCH_DISTANCE) < count)
+            PrefetchCommand(commands[i + BATCH_PREFETCH_DISTANCE]);
+
+        results[i] = ProcessCommand(commands[i]);
+        if (results[i] != ErrorCode::OK)
+            ++errors;
+    }
+
+    // Deferred matching is performed by the enclosing batch
+    if (nested)
+        return errors;
+
+    _batch = false;
+
+    // Perform deferred matching of touched order books
+    if (_matching)
+        MatchPending();
+
+    return errors;
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::PrefetchCommand(const MarketCommand& command) const
+{
+    if (!command.IsOrderCommand())
+        return;
+
+    // Prefetch the order index slot without the order lookup
+    if (command.Type != MarketCommandType::ADD_ORDER)
+        _orders.Prefetch(command.Params.Id);
+
+    const void* address = GetOrderBook(command.SymbolId);
+    if (address != nullptr)
+    {
+#if defined(_MSC_VER)
+        _mm_prefetch((const char*)address, _MM_HINT_T0);
+#else
+        __builtin_prefetch(address);
+#endif
+    }
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::Match()
+{
+    ConflationScope scope(*this);
+
+    MatchPending();
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::MatchPending()
+{
+    // Market handlers could modify the market during matching, so the pending
+    // order books list could grow here
+    for (size_t i = 0; i < _pending_order_books.size(); ++i)
+    {
+        OrderBook* order_book_ptr = (OrderBook*)GetOrderBook(_pending_order_books[i]);
+        if ((order_book_ptr != nullptr) && order_book_ptr->_match_pending)
+        {
+            order_book_ptr->_match_pending = false;
+            order_book_ptr->ApplyBatchPrice();
+            Match(order_book_ptr);
+            order_book_ptr->ResetMatchingPrice();
+        }
+    }
+    _pending_order_books.clear();
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::MarkPending(OrderBook* order_book_ptr)
+{
+    if (order_book_ptr->_match_pending)
+        return;
+
+    // Only crossed order books and order books with stop orders could be matched
+    bool crossed = (order_book_ptr->_best_bid != nullptr) &&
+                   (order_book_ptr->_best_ask != nullptr) &&
+                   (order_book_ptr->_best_bid->Price >= order_book_ptr->_best_ask->Price);
+    bool stops = (order_book_ptr->_best_buy_stop != nullptr) ||
+                 (order_book_ptr->_best_sell_stop != nullptr) ||
+                 (order_book_ptr->_best_trailing_buy_stop != nullptr) ||
+                 (order_book_ptr->_best_trailing_sell_stop != nullptr);
+
+    // Batch processing defers matching of all touched order books
+    if (crossed || stops || _batch)
+    {
+        order_book_ptr->_match_pending = true;
+        _pending_order_books.push_back(order_book_ptr->_symbol.Id);
+    }
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::Match(OrderBook* order_book_ptr)
+{
+    // Matching loop
+    for (;;)
+    {
+        // Check the arbitrage bid/ask prices
+        while ((order_book_ptr->_best_bid != nullptr) &&
+               (order_book_ptr->_best_ask != nullptr) &&
+               (order_book_ptr->_best_bid->Price >= order_book_ptr->_best_ask->Price))
+        {
+            // Find the best bid/ask price level
+            LevelNode* bid_level_ptr = order_book_ptr->_best_bid;
+            LevelNode* ask_level_ptr = order_book_ptr->_best_ask;
+
+            // Find the first order to execute and the first order to reduce
+            OrderNode* bid_order_ptr = bid_level_ptr->OrderList.front();
+            OrderNode* ask_order_ptr = ask_level_ptr->OrderList.front();
+
+            // Execute crossed orders
+            while ((bid_order_ptr != nullptr) && (ask_order_ptr != nullptr))
+            {
+                // Find the next orders pair
+                OrderNode* next_bid_order_ptr = bid_order_ptr->next;
+                OrderNode* next_ask_order_ptr = ask_order_ptr->next;
+
+                // Special case for 'All-Or-None' orders
+                if (bid_order_ptr->IsAON() || ask_order_ptr->IsAON())
+                {
+                    // Calculate the matching chain
+                    uint64_t chain = CalculateMatchingChain(order_book_ptr, bid_level_ptr, ask_level_ptr);
+
+                    // Matching is not avaliable
+                    if (chain == 0)
+                        return;
+
+                    // Execute orders in the matching chain
+                    if (bid_order_ptr->IsAON())
+                    {
+                        uint64_t price = bid_order_ptr->Price;
+                        ExecuteMatchingChain(order_book_ptr, bid_level_ptr, price, chain);
+                        ExecuteMatchingChain(order_book_ptr, ask_level_ptr, price, chain);
+                    }
+                    else
+                    {
+                        uint64_t price = ask_order_ptr->Price;
+                        ExecuteMatchingChain(order_book_ptr, ask_level_ptr, price, chain);
+                        ExecuteMatchingChain(order_book_ptr, bid_level_ptr, price, chain);
+                    }
+
+                    break;
+                }
+
+                // Find the best order to execute and the best order to reduce
+                OrderNode* executing_order_ptr = bid_order_ptr;
+                OrderNode* reducing_order_ptr = ask_order_ptr;
+                if (executing_order_ptr->LeavesQuantity > reducing_order_ptr->LeavesQuantity)
+                    std::swap(executing_order_ptr, reducing_order_ptr);
+
+                // Get the execution quantity
+                uint64_t quantity = executing_order_ptr->LeavesQuantity;
+
+                // Get the execution price
+                uint64_t price = executing_order_ptr->Price;
+
+                // Call the corresponding handler
+                _market_handler.onExecuteOrder(*executing_order_ptr, price, quantity);
+
+                // Update the corresponding market price
+                order_book_ptr->UpdateLastPrice(*executing_order_ptr, price);
+                order_book_ptr->UpdateMatchingPrice(*executing_order_ptr, price);
+
+                // Increase the order executed quantity
+                executing_order_ptr->ExecutedQuantity += quantity;
+
+                // Delete the executing order from the order book
+                DeleteOrder(order_book_ptr, executing_order_ptr, true);
+
+                // Call the corresponding handler
+                _market_handler.onExecuteOrder(*reducing_order_ptr, price, quantity);
+
+                // Update the corresponding market price
+                order_book_ptr->UpdateLastPrice(*reducing_order_ptr, price);
+                order_book_ptr->UpdateMatchingPrice(*reducing_order_ptr, price);
+
+                // Increase the order executed quantity
+                reducing_order_ptr->ExecutedQuantity += quantity;
+
+                // Reduce the remaining order in the order book
+                ReduceOrder(order_book_ptr, reducing_order_ptr, quantity, true);
+
+                // Move to the next orders pair at the same price level
+                bid_order_ptr = next_bid_order_ptr;
+                ask_order_ptr = next_ask_order_ptr;
+            }
+
+            // Activate stop orders only if the current price level changed
+            ActivateStopOrders(order_book_ptr, (LevelNode*)order_book_ptr->best_buy_stop(), order_book_ptr->GetMarketPriceAsk());
+            ActivateStopOrders(order_book_ptr, (LevelNode*)order_book_ptr->best_sell_stop(), order_book_ptr->GetMarketPriceBid());
+        }
+
+        // Activate stop orders until there is something to activate
+        if (!ActivateStopOrders(order_book_ptr))
+            break;
+    }
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::MatchOrderBook(OrderBook* order_book_ptr, bool recursive)
+{
+    if (!recursive)
+    {
+        // Defer matching till the end of the batch and remember the extreme market price for stop orders activation
+        if (_matching && _batch)
+        {
+            order_book_ptr->UpdateBatchPrice();
+            MarkPending(order_book_ptr);
+        }
+        // Remember the order book to match when automatic matching is enabled
+        else if (!_matching)
+            MarkPending(order_book_ptr);
+        else
+            Match(order_book_ptr);
+    }
+
+    // Reset matching price
+    order_book_ptr->ResetMatchingPrice();
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::MatchMarket(OrderBook* order_book_ptr, Order* order_ptr)
+{
+    // Calculate acceptable marker order price with optional slippage value
+    if (order_ptr->IsBuy())
+    {
+        // Check if there is nothing to buy
+        if (order_book_ptr->best_ask() == nullptr)
+            return;
+
+        order_ptr->Price = order_book_ptr->best_ask()->Price;
+        if (order_ptr->Price > (std::numeric_limits<uint64_t>::max() - order_ptr->Slippage))
+            order_ptr->Price = std::numeric_limits<uint64_t>::max();
+        else
+            order_ptr->Price += order_ptr->Slippage;
+    }
+    else
+    {
+        // Check if there is nothing to sell
+        if (order_book_ptr->best_bid() == nullptr)
+            return;
+
+        order_ptr->Price = order_book_ptr->best_bid()->Price;
+        if (order_ptr->Price < (std::numeric_limits<uint64_t>::min() + order_ptr->Slippage))
+            order_ptr->Price = std::numeric_limits<uint64_t>::min();
+        else
+            order_ptr->Price -= order_ptr->Slippage;
+    }
+
+    // Match the market order
+    MatchOrder(order_book_ptr, order_ptr);
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::MatchLimit(OrderBook* order_book_ptr, Order* order_ptr)
+{
+    // Match the limit order
+    MatchOrder(order_book_ptr, order_ptr);
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::MatchOrder(OrderBook* order_book_ptr, Order* order_ptr)
+{
+    // Start the matching from the top of the book
+    LevelNode* level_ptr;
+    while ((level_ptr = order_ptr->IsBuy() ? order_book_ptr->_best_ask : order_book_ptr->_best_bid) != nullptr)
+    {
+        // Check the arbitrage bid/ask prices
+        bool arbitrage = order_ptr->IsBuy() ? (order_ptr->Price >= level_ptr->Price) : (order_ptr->Price <= level_ptr->Price);
+        if (!arbitrage)
+            return;
+
+        // Special case for 'Fill-Or-Kill'/'All-Or-None' order
+        if (order_ptr->IsFOK() || order_ptr->IsAON())
+        {
+            // Calculate the matching chain
+            uint64_t chain = CalculateMatchingChain(order_book_ptr, level_ptr, order_ptr->Price, order_ptr->LeavesQuantity);
+
+            // Matching is not avaliable
+            if (chain == 0)
+                return;
+
+            // Execute orders in the matching chain
+            ExecuteMatchingChain(order_book_ptr, level_ptr, order_ptr->Price, chain);
+
+            // Call the corresponding handler
+            _market_handler.onExecuteOrder(*order_ptr, order_ptr->Price, order_ptr->LeavesQuantity);
+
+            // Update the corresponding market price
+            order_book_ptr->UpdateLastPrice(*order_ptr, order_ptr->Price);
+            order_book_ptr->UpdateMatchingPrice(*order_ptr, order_ptr->Price);
+
+            // Increase the order executed quantity
+            order_ptr->ExecutedQuantity += order_ptr->LeavesQuantity;
+
+            // Reduce the order leaves quantity
+            order_ptr->LeavesQuantity = 0;
+
+            return;
+        }
+
+        // Find the first order to execute
+        OrderNode* executing_order_ptr = level_ptr->OrderList.front();
+
+        // Execute crossed orders
+        while (executing_order_ptr != nullptr)
+        {
+            // Find the next order to execute
+            OrderNode* next_executing_order_ptr = executing_order_ptr->next;
+
+            // Get the execution quantity
+            uint64_t quantity = std::min(executing_order_ptr->LeavesQuantity, order_ptr->LeavesQuantity);
+
+            // Special case for 'All-Or-None' orders
+            if (executing_order_ptr->IsAON() && (executing_order_ptr->LeavesQuantity > order_ptr->LeavesQuantity))
+                return;
+
+            // Get the execution price
+            uint64_t price = executing_order_ptr->Price;
+
+            // Call the corresponding handler
+            _market_handler.onExecuteOrder(*executing_order_ptr, price, quantity);
+
+            // Update the corresponding market price
+            order_book_ptr->UpdateLastPrice(*executing_order_ptr, price);
+            order_book_ptr->UpdateMatchingPrice(*executing_order_ptr, price);
+
+            // Increase the order executed quantity
+            executing_order_ptr->ExecutedQuantity += quantity;
+
+            // Reduce the executing order in the order book
+            ReduceOrder(order_book_ptr, executing_order_ptr, quantity, true);
+
+            // Call the corresponding handler
+            _market_handler.onExecuteOrder(*order_ptr, price, quantity);
+
+            // Update the corresponding market price
+            order_book_ptr->UpdateLastPrice(*order_ptr, price);
+            order_book_ptr->UpdateMatchingPrice(*order_ptr, price);
+
+            // Increase the order executed quantity
+            order_ptr->ExecutedQuantity += quantity;
+
+            // Reduce the order leaves quantity
+            order_ptr->LeavesQuantity -= quantity;
+            if (order_ptr->LeavesQuantity == 0)
+                return;
+
+            // Move to the next order to execute at the same price level
+            executing_order_ptr = next_executing_order_ptr;
+        }
+    }
+}
+
+template <class THandler>
+inline bool BasicMarketManager<THandler>::ActivateStopOrders(OrderBook* order_book_ptr)
+{
+    bool result = false;
+    bool stop = false;
+
+    while (!stop)
+    {
+        stop = true;
+
+        // Try to activate buy stop orders
+        if (ActivateStopOrders(order_book_ptr, (LevelNode*)order_book_ptr->best_buy_stop(), order_book_ptr->GetMarketPriceAsk()) ||
+            ActivateStopOrders(order_book_ptr, (LevelNode*)order_book_ptr->best_trailing_buy_stop(), order_book_ptr->GetMarketPriceAsk()))
+        {
+            result = true;
+            stop = false;
+        }
+
+        // Recalculate trailing buy stop orders
+        RecalculateTrailingStopPrice(order_book_ptr, order_book_ptr->_best_ask);
+
+        // Try to activate sell stop orders
+        if (ActivateStopOrders(order_book_ptr, (LevelNode*)order_book_ptr->best_sell_stop(), order_book_ptr->GetMarketPriceBid()) ||
+            ActivateStopOrders(order_book_ptr, (LevelNode*)order_book_ptr->best_trailing_sell_stop(), order_book_ptr->GetMarketPriceBid()))
+        {
+            result = true;
+            stop = false;
+        }
+
+        // Recalculate trailing sell stop orders
+        RecalculateTrailingStopPrice(order_book_ptr, order_book_ptr->_best_bid);
+    }
+
+    return result;
+}
+
+template <class THandler>
+inline bool BasicMarketManager<THandler>::ActivateStopOrders(OrderBook* order_book_ptr, LevelNode* level_ptr, uint64_t stop_price)
+{
+    bool result = false;
+
+    if (level_ptr != nullptr)
+    {
+        // Check the arbitrage bid/ask prices
+        bool arbitrage = level_ptr->IsBid() ? (stop_price <= level_ptr->Price) : (stop_price >= level_ptr->Price);
+        if (!arbitrage)
+            return result;
+
+        // Find the stop order to activate
+        OrderNode* activating_order_ptr = level_ptr->OrderList.front();
+
+        // Activate all stop orders
+        while (activating_order_ptr != nullptr)
+        {
+            // Find the next order to activate
+            OrderNode* next_activating_order_ptr = activating_order_ptr->next;
+
+            // Activate the stop order
+            switch (activating_order_ptr->Type)
+            {
+                case OrderType::STOP:
+                case OrderType::TRAILING_STOP:
+                    result = ActivateStopOrder(order_book_ptr, activating_order_ptr);
+                    break;
+                case OrderType::STOP_LIMIT:
+                case OrderType::TRAILING_STOP_LIMIT:
+                    result = ActivateStopLimitOrder(order_book_ptr, activating_order_ptr);
+                    break;
+                default:
+                    assert(false && "Unsupported order type!");
+                    break;
+
+            }
+
+            // Move to the next order to activate at the same price level
+            activating_order_ptr = next_activating_order_ptr;
+        }
+    }
+
+    return result;
+}
+
+template <class THandler>
+inline bool BasicMarketManager<THandler>::ActivateStopOrder(OrderBook* order_book_ptr, OrderNode* order_ptr)
+{
+    // Delete the stop order from the order book
+    if (order_ptr->IsTrailingStop() || order_ptr->IsTrailingStopLimit())
+        order_book_ptr->DeleteTrailingStopOrder(order_ptr);
+    else
+        order_book_ptr->DeleteStopOrder(order_ptr);
+
+    // Convert the stop order into the market order
+    order_ptr->Type = OrderType::MARKET;
+    order_ptr->Price = 0;
+    order_ptr->StopPrice = 0;
+    order_ptr->TimeInForce = order_ptr->IsFOK() ? OrderTimeInForce::FOK : OrderTimeInForce::IOC;
+
+    // Call the corresponding handler
+    _market_handler.onUpdateOrder(*order_ptr);
+
+    // Match the market order
+    MatchMarket(order_book_ptr, order_ptr);
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the order
+    _orders.Erase(order_ptr->Id);
+
+    // Relase the order
+    _order_pool.Release(order_ptr);
+
+    return true;
+}
+
+template <class THandler>
+inline bool BasicMarketManager<THandler>::ActivateStopLimitOrder(OrderBook* order_book_ptr, OrderNode* order_ptr)
+{
+    // Delete the stop order from the order book
+    if (order_ptr->IsTrailingStop() || order_ptr->IsTrailingStopLimit())
+        order_book_ptr->DeleteTrailingStopOrder(order_ptr);
+    else
+        order_book_ptr->DeleteStopOrder(order_ptr);
+
+    // Convert the stop-limit order into the limit order
+    order_ptr->Type = OrderType::LIMIT;
+    order_ptr->StopPrice = 0;
+
+    // Call the corresponding handler
+    _market_handler.onUpdateOrder(*order_ptr);
+
+    // Match the limit order
+    MatchLimit(order_book_ptr, order_ptr);
+
+    // Add a new limit order or delete remaining part in case of 'Immediate-Or-Cancel'/'Fill-Or-Kill' order
+    if ((order_ptr->LeavesQuantity > 0) && !order_ptr->IsIOC() && !order_ptr->IsFOK())
+    {
+        // Add the new limit order into the order book
+        UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Erase the order
+        _orders.Erase(order_ptr->Id);
+
+        // Relase the order
+        _order_pool.Release(order_ptr);
+    }
+
+    return true;
+}
+
+template <class THandler>
+inline uint64_t BasicMarketManager<THandler>::CalculateMatchingChain(OrderBook* order_book_ptr, LevelNode* level_ptr, uint64_t price, uint64_t volume)
+{
+    // Matching is not possible if the whole volume available at the given price is not enough
+    if (order_book_ptr->_volume_index)
+    {
+        uint64_t total = level_ptr->IsBid() ? order_book_ptr->_bid_volume.Above(price) : order_book_ptr->_ask_volume.Below(price);
+        if (total < volume)
+            return 0;
+    }
+
+    OrderNode* order_ptr = level_ptr->OrderList.front();
+    uint64_t available = 0;
+
+    // Travel through price levels
+    while (level_ptr != nullptr)
+    {
+        // Check the arbitrage bid/ask prices
+        bool arbitrage = level_ptr->IsBid() ? (price <= level_ptr->Price) : (price >= level_ptr->Price);
+        if (!arbitrage)
+            return 0;
+
+        // Travel through orders at current price levels
+        while (order_ptr != nullptr)
+        {
+            uint64_t need = volume - available;
+            uint64_t quantity = order_ptr->IsAON() ? order_ptr->LeavesQuantity : std::min(order_ptr->LeavesQuantity, need);
+            available += quantity;
+
+            // Matching is possible, return the chain size
+            if (volume == available)
+                return available;
+
+            // Matching is not possible
+            if (volume < available)
+                return 0;
+
+            // Take the next order
+            order_ptr = order_ptr->next;
+        }
+
+        // Switch to the next price level
+        if (order_ptr == nullptr)
+        {
+            level_ptr = order_book_ptr->GetNextLevel(level_ptr);
+            if (level_ptr != nullptr)
+                order_ptr = level_ptr->OrderList.front();
+        }
+    }
+
+    // Matching is not available
+    return 0;
+}
+
+template <class THandler>
+inline uint64_t BasicMarketManager<THandler>::CalculateMatchingChain(OrderBook* order_book_ptr, LevelNode* bid_level_ptr, LevelNode* ask_level_ptr)
+{
+    LevelNode* longest_level_ptr = bid_level_ptr;
+    LevelNode* shortest_level_ptr = ask_level_ptr;
+    OrderNode* longest_order_ptr = bid_level_ptr->OrderList.front();
+    OrderNode* shortest_order_ptr = ask_level_ptr->OrderList.front();
+    uint64_t required = longest_order_ptr->LeavesQuantity;
+    uint64_t available = 0;
+
+    // Find the initial longest order chain
+    if (longest_order_ptr->IsAON() && shortest_order_ptr->IsAON())
+    {
+        // Choose the longest 'All-Or-None' order
+        if (shortest_order_ptr->LeavesQuantity > longest_order_ptr->LeavesQuantity)
+        {
+            required = shortest_order_ptr->LeavesQuantity;
+            available = 0;
+            std::swap(longest_level_ptr, shortest_level_ptr);
+            std::swap(longest_order_ptr, shortest_order_ptr);
+        }
+    }
+    else if (shortest_order_ptr->IsAON())
+    {
+        required = shortest_order_ptr->LeavesQuantity;
+        available = 0;
+        std::swap(longest_level_ptr, shortest_level_ptr);
+        std::swap(longest_order_ptr, shortest_order_ptr);
+    }
+
+    // Travel through price levels
+    while ((longest_level_ptr != nullptr) && (shortest_level_ptr != nullptr))
+    {
+        // Travel through orders at current price levels
+        while ((longest_order_ptr != nullptr) && (shortest_order_ptr != nullptr))
+        {
+            uint64_t need = required - available;
+            uint64_t quantity = shortest_order_ptr->IsAON() ? shortest_order_ptr->LeavesQuantity : std::min(shortest_order_ptr->LeavesQuantity, need);
+            available += quantity;
+
+            // Matching is possible, return the chain size
+            if (required == available)
+                return required;
+
+            // Swap longest and shortest chains
+            if (required < available)
+            {
+                OrderNode* next = longest_order_ptr->next;
+                longest_order_ptr = shortest_order_ptr;
+                shortest_order_ptr = next;
+                std::swap(required, available);
+                continue;
+            }
+
+            // Take the next order
+            shortest_order_ptr = shortest_order_ptr->next;
+        }
+
+        // Switch to the next longest price level
+        if (longest_order_ptr == nullptr)
+        {
+            longest_level_ptr = order_book_ptr->GetNextLevel(longest_level_ptr);
+            if (longest_level_ptr != nullptr)
+                longest_order_ptr = longest_level_ptr->OrderList.front();
+        }
+
+        // Switch to the next shortest price level
+        if (shortest_order_ptr == nullptr)
+        {
+            shortest_level_ptr = order_book_ptr->GetNextLevel(shortest_level_ptr);
+            if (shortest_level_ptr != nullptr)
+                shortest_order_ptr = shortest_level_ptr->OrderList.front();
+        }
+    }
+
+    // Matching is not available
+    return 0;
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::ExecuteMatchingChain(OrderBook* order_book_ptr, LevelNode* level_ptr, uint64_t price, uint64_t volume)
+{
+    // Execute all orders in the matching chain
+    while ((volume > 0) && (level_ptr != nullptr))
+    {
+        // Get the next prive level to execute
+        LevelNode* next_level_ptr = order_book_ptr->GetNextLevel(level_ptr);
+
+        // Find the first order to execute
+        OrderNode* executing_order_ptr = level_ptr->OrderList.front();
+
+        // Execute all orders in the current price level
+        while ((volume > 0) && (executing_order_ptr != nullptr))
+        {
+            // Find the next order to execute
+            OrderNode* next_executing_order_ptr = executing_order_ptr->next;
+
+            uint64_t quantity;
+
+            // Execute order
+            if (executing_order_ptr->IsAON())
+            {
+                // Get the execution quantity
+                quantity = executing_order_ptr->LeavesQuantity;
+
+                // Call the corresponding handler
+                _market_handler.onExecuteOrder(*executing_order_ptr, price, quantity);
+
+                // Update the corresponding market price
+                order_book_ptr->UpdateLastPrice(*executing_order_ptr, price);
+                order_book_ptr->UpdateMatchingPrice(*executing_order_ptr, price);
+
+                // Increase the order executed quantity
+                executing_order_ptr->ExecutedQuantity += quantity;
+
+                // Delete the executing order from the order book
+                DeleteOrder(order_book_ptr, executing_order_ptr, true);
+            }
+            else
+            {
+                // Get the execution quantity
+                quantity = std::min(executing_order_ptr->LeavesQuantity, volume);
+
+                // Call the corresponding handler
+                _market_handler.onExecuteOrder(*executing_order_ptr, price, quantity);
+
+                // Update the corresponding market price
+                order_book_ptr->UpdateLastPrice(*executing_order_ptr, price);
+                order_book_ptr->UpdateMatchingPrice(*executing_order_ptr, price);
+
+                // Increase the order executed quantity
+                executing_order_ptr->ExecutedQuantity += quantity;
+
+                // Reduce the executing order in the order book
+                ReduceOrder(order_book_ptr, executing_order_ptr, quantity, true);
+            }
+
+            // Reduce the execution chain
+            volume -= quantity;
+
+            // Move to the next order to execute at the same price level
+            executing_order_ptr = next_executing_order_ptr;
+        }
+
+        // Move to the next price level
+        level_ptr = next_level_ptr;
+    }
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::RecalculateTrailingStopPrice(OrderBook* order_book_ptr, LevelNode* level_ptr)
+{
+    if (level_ptr == nullptr)
+        return;
+
+    uint64_t new_trailing_price;
+
+    // Check if we should skip the recalculation because of the market price goes to the wrong direction
+    if (level_ptr->Type == LevelType::ASK)
+    {
+        uint64_t old_trailing_price = order_book_ptr->_trailing_ask_price;
+        new_trailing_price = order_book_ptr->GetMarketTrailingStopPriceAsk();
+        order_book_ptr->_trailing_ask_price = new_trailing_price;
+        if (new_trailing_price >= old_trailing_price)
+            return;
+    }
+    if (level_ptr->Type == LevelType::BID)
+    {
+        uint64_t old_trailing_price = order_book_ptr->_trailing_bid_price;
+        new_trailing_price = order_book_ptr->GetMarketTrailingStopPriceBid();
+        order_book_ptr->_trailing_bid_price = new_trailing_price;
+        if (new_trailing_price <= old_trailing_price)
+            return;
+    }
+
+    // Find the first trailing stop price level which orders could be repriced.
+    // Closer price levels are skipped with the minimal repricing threshold.
+    LevelNode* current = order_book_ptr->GetTrailingStopRepriceLevel(level_ptr->Type == LevelType::ASK);
+
+    // Collect trailing stop orders to reprice in a single pass. Repriced orders
+    // are moved to better price levels only, so they are never repriced twice
+    // and the collected orders could be moved in the price level order.
+    _trailing_orders.clear();
+    while (current != nullptr)
+    {
+        for (OrderNode* order_ptr = current->OrderList.front(); order_ptr != nullptr; order_ptr = order_ptr->next)
+        {
+            uint64_t new_stop_price = order_book_ptr->CalculateTrailingStopPrice(*order_ptr);
+
+            // Trailing distance for the order must be changed
+            if (new_stop_price != order_ptr->StopPrice)
+                _trailing_orders.emplace_back(order_ptr, new_stop_price);
+        }
+
+        // Move to the next stop price level
+        current = order_book_ptr->GetNextTrailingStopLevel(current);
+    }
+
+    // Reprice collected trailing stop orders
+    for (auto& trailing_order : _trailing_orders)
+    {
+        OrderNode* order_ptr = trailing_order.first;
+
+        // Delete the order from the order book
+        order_book_ptr->DeleteTrailingStopOrder(order_ptr, true);
+
+        // Update the stop order price
+        switch (order_ptr->Type)
+        {
+            case OrderType::TRAILING_STOP:
+                order_ptr->StopPrice = trailing_order.second;
+                break;
+            case OrderType::TRAILING_STOP_LIMIT:
+            {
+                int64_t diff = order_ptr->Price - order_ptr->StopPrice;
+                order_ptr->StopPrice = trailing_order.second;
+                order_ptr->Price = order_ptr->StopPrice + diff;
+                break;
+            }
+            default:
+                assert(false && "Unsupported order type!");
+                break;
+        }
+
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+
+        // Add the new stop order into the order book
+        order_book_ptr->AddTrailingStopOrder(order_ptr, true);
+    }
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::UpdateLevel(OrderBook& order_book, const LevelUpdate& update)
+{
+    // Publish the top of the book immediately, readers do not wait for conflated updates
+    if (update.Top)
+        order_book.PublishTopOfBook();
+
+    // Publish the depth once at the end of the market operation
+    if (order_book._depth_publisher.enabled())
+        PublishDepth(order_book);
+
+    if (_conflation && (_conflation_depth > 0))
+    {
+        ConflateLevel(order_book, update);
+        return;
+    }
+
+    switch (update.Type)
+    {
+        case UpdateType::ADD:
+            _market_handler.onAddLevel(order_book, update.Update, update.Top);
+            break;
+        case UpdateType::UPDATE:
+            _market_handler.onUpdateLevel(order_book, update.Update, update.Top);
+            break;
+        case UpdateType::DELETE:
+            _market_handler.onDeleteLevel(order_book, update.Update, update.Top);
+            break;
+        default:
+            break;
+    }
+
+    _market_handler.onUpdateOrderBook(order_book, update.Top);
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::SaveSnapshot(CppCommon::Writer& writer) const
+{
+    std::vector<uint8_t> buffer;
+    buffer.reserve(SNAPSHOT_BUFFER_SIZE);
+    bool failed = false;
+
+    // Buffer snapshot records to write them with large chunks
+    auto flush = [&]()
+    {
+        if (!buffer.empty() && (writer.Write(buffer.data(), buffer.size()) != buffer.size()))
+            failed = true;
+        buffer.clear();
+    };
+    auto write = [&](const void* record, size_t size)
+    {
+        if ((buffer.size() + size) > SNAPSHOT_BUFFER_SIZE)
+            flush();
+        buffer.insert(buffer.end(), (const uint8_t*)record, (const uint8_t*)record + size);
+    };
+
+    // Write the snapshot header
+    SnapshotHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.Signature = SnapshotHeader::SIGNATURE;
+    header.Version = SnapshotHeader::VERSION;
+    for (auto symbol_ptr : _symbols)
+        if (symbol_ptr != nullptr)
+            ++header.Symbols;
+    for (auto order_book_ptr : _order_books)
+    {
+        if (order_book_ptr != nullptr)
+        {
+            ++header.OrderBooks;
+            header.Levels += order_book_ptr->size();
+        }
+    }
+    header.Orders = _orders.size();
+    header.Matching = _matching ? 1 : 0;
+    write(&header, sizeof(header));
+
+    // Write symbols
+    for (auto symbol_ptr : _symbols)
+    {
+        if (symbol_ptr != nullptr)
+        {
+            SnapshotSymbol symbol;
+            std::memset(&symbol, 0, sizeof(symbol));
+            symbol.Value = *symbol_ptr;
+            write(&symbol, sizeof(symbol));
+        }
+    }
+
+    // Write order books
+    for (auto order_book_ptr : _order_books)
+    {
+        if (order_book_ptr == nullptr)
+            continue;
+
+        SnapshotOrderBook order_book;
+        std::memset(&order_book, 0, sizeof(order_book));
+        order_book.SymbolId = order_book_ptr->_symbol.Id;
+        order_book.LastBidPrice = order_book_ptr->_last_bid_price;
+        order_book.LastAskPrice = order_book_ptr->_last_ask_price;
+        order_book.MatchingBidPrice = order_book_ptr->_matching_bid_price;
+        order_book.MatchingAskPrice = order_book_ptr->_matching_ask_price;
+        order_book.TrailingBidPrice = order_book_ptr->_trailing_bid_price;
+        order_book.TrailingAskPrice = order_book_ptr->_trailing_ask_price;
+        order_book.Levels[SNAPSHOT_BIDS] = order_book_ptr->bids_size();
+        order_book.Levels[SNAPSHOT_ASKS] = order_book_ptr->asks_size();
+        order_book.Levels[SNAPSHOT_BUY_STOP] = order_book_ptr->buy_stop_size();
+        order_book.Levels[SNAPSHOT_SELL_STOP] = order_book_ptr->sell_stop_size();
+        order_book.Levels[SNAPSHOT_TRAILING_BUY_STOP] = order_book_ptr->trailing_buy_stop_size();
+        order_book.Levels[SNAPSHOT_TRAILING_SELL_STOP] = order_book_ptr->trailing_sell_stop_size();
+        write(&order_book, sizeof(order_book));
+
+        // Write price levels of each container from the best one
+        const LevelNode* best[SNAPSHOT_LEVELS] =
+        {
+            order_book_ptr->best_bid(),
+            order_book_ptr->best_ask(),
+            order_book_ptr->best_buy_stop(),
+            order_book_ptr->best_sell_stop(),
+            order_book_ptr->best_trailing_buy_stop(),
+            order_book_ptr->best_trailing_sell_stop()
+        };
+        for (size_t container = 0; container < SNAPSHOT_LEVELS; ++container)
+        {
+            const LevelNode* level_ptr = best[container];
+            while (level_ptr != nullptr)
+            {
+                SnapshotLevel level;
+                level.Price = level_ptr->Price;
+                level.Orders = level_ptr->Orders;
+                write(&level, sizeof(level));
+
+                // Write orders in the price level queue order
+                for (const OrderNode* order_ptr = level_ptr->OrderList.front(); order_ptr != nullptr; order_ptr = order_ptr->next)
+                {
+                    // Copy order fields into the zeroed record to keep padding bytes out of the snapshot
+                    Order order;
+                    std::memset(&order, 0, sizeof(order));
+                    order.Id = order_ptr->Id;
+                    order.Price = order_ptr->Price;
+                    order.LeavesQuantity = order_ptr->LeavesQuantity;
+                    order.MaxVisibleQuantity = order_ptr->MaxVisibleQuantity;
+                    order.SymbolId = order_ptr->SymbolId;
+                    order.Type = order_ptr->Type;
+                    order.Side = order_ptr->Side;
+                    order.TimeInForce = order_ptr->TimeInForce;
+                    order.Quantity = order_ptr->Quantity;
+                    order.ExecutedQuantity = order_ptr->ExecutedQuantity;
+                    order.StopPrice = order_ptr->StopPrice;
+                    order.Slippage = order_ptr->Slippage;
+                    order.TrailingDistance = order_ptr->TrailingDistance;
+                    order.TrailingStep = order_ptr->TrailingStep;
+                    write(&order, sizeof(order));
+                }
+
+                if (container < SNAPSHOT_BUY_STOP)
+                    level_ptr = order_book_ptr->GetNextLevel(level_ptr);
+                else if (container < SNAPSHOT_TRAILING_BUY_STOP)
+                    level_ptr = order_book_ptr->GetNextStopLevel(level_ptr);
+                else
+                    level_ptr = order_book_ptr->GetNextTrailingStopLevel(level_ptr);
+            }
+        }
+    }
+
+    flush();
+    if (!writer.Flush())
+        failed = true;
+
+    return failed ? ErrorCode::SNAPSHOT_WRITE_FAILED : ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::LoadSnapshot(const void* buffer, size_t size)
+{
+    // Market manager must be empty
+    bool empty = _orders.empty();
+    for (auto symbol_ptr : _symbols)
+        empty = empty && (symbol_ptr == nullptr);
+    for (auto order_book_ptr : _order_books)
+        empty = empty && (order_book_ptr == nullptr);
+    assert(empty && "Market manager must be empty to restore the snapshot!");
+    if (!empty)
+        return ErrorCode::MARKET_NOT_EMPTY;
+
+    const uint8_t* data = (const uint8_t*)buffer;
+    const uint8_t* end = data + size;
+
+    // Read and validate the snapshot header
+    SnapshotHeader header;
+    if (!ReadSnapshotRecord(&header, sizeof(header), data, end))
+        return ErrorCode::SNAPSHOT_INVALID;
+    if ((header.Signature != SnapshotHeader::SIGNATURE) || (header.Version != SnapshotHeader::VERSION))
+        return ErrorCode::SNAPSHOT_INVALID;
+
+    // Reserve the orders container, but not more than the snapshot could contain
+    _orders.Reserve((size_t)std::min<uint64_t>(header.Orders, size / sizeof(Order)));
+
+    // Restore the market without handlers and roll it back if the snapshot is invalid
+    ErrorCode result = RestoreSnapshot(header, data, end);
+    if (result != ErrorCode::OK)
+    {
+        ReleaseMarket();
+        return result;
+    }
+
+    // Call the corresponding handlers
+    for (auto symbol_ptr : _symbols)
+        if (symbol_ptr != nullptr)
+            _market_handler.onAddSymbol(*symbol_ptr);
+    for (auto order_book_ptr : _order_books)
+    {
+        if (order_book_ptr == nullptr)
+            continue;
+
+        _market_handler.onAddOrderBook(*order_book_ptr);
+
+        // Restored order book could be crossed if the snapshot was taken with disabled matching
+        MarkPending(order_book_ptr);
+
+        // Publish the restored top of the book and depth
+        order_book_ptr->PublishTopOfBook();
+        order_book_ptr->PublishDepth();
+
+        _market_handler.onUpdateOrderBook(*order_book_ptr, true);
+    }
+
+    // Restore automatic matching flag
+    _matching = (header.Matching != 0);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::RestoreSnapshot(const SnapshotHeader& header, const uint8_t*& data, const uint8_t* end)
+{
+    // Restore symbols
+    for (uint64_t i = 0; i < header.Symbols; ++i)
+    {
+        SnapshotSymbol symbol;
+        if (!ReadSnapshotRecord(&symbol, sizeof(symbol), data, end))
+            return ErrorCode::SNAPSHOT_INVALID;
+        if ((symbol.Value.Id > SnapshotSymbol::MAX_ID) || (GetSymbol(symbol.Value.Id) != nullptr))
+            return ErrorCode::SNAPSHOT_INVALID;
+
+        if (_symbols.size() <= symbol.Value.Id)
+            _symbols.resize(symbol.Value.Id + 1, nullptr);
+        _symbols[symbol.Value.Id] = _symbol_pool.Create(symbol.Value);
+    }
+
+    // Restore order books
+    for (uint64_t i = 0; i < header.OrderBooks; ++i)
+    {
+        SnapshotOrderBook order_book;
+        if (!ReadSnapshotRecord(&order_book, sizeof(order_book), data, end))
+            return ErrorCode::SNAPSHOT_INVALID;
+        const Symbol* symbol_ptr = GetSymbol(order_book.SymbolId);
+        if ((symbol_ptr == nullptr) || (GetOrderBook(order_book.SymbolId) != nullptr))
+            return ErrorCode::SNAPSHOT_INVALID;
+
+        if (_order_books.size() <= order_book.SymbolId)
+            _order_books.resize(order_book.SymbolId + 1, nullptr);
+        OrderBook* order_book_ptr = _order_book_pool.Create(_level_pool, *symbol_ptr, _options);
+        _order_books[order_book.SymbolId] = order_book_ptr;
+
+        // Restore market last and trailing prices
+        order_book_ptr->_last_bid_price = order_book.LastBidPrice;
+        order_book_ptr->_last_ask_price = order_book.LastAskPrice;
+        order_book_ptr->_matching_bid_price = order_book.MatchingBidPrice;
+        order_book_ptr->_matching_ask_price = order_book.MatchingAskPrice;
+        order_book_ptr->_trailing_bid_price = order_book.TrailingBidPrice;
+        order_book_ptr->_trailing_ask_price = order_book.TrailingAskPrice;
+
+        // Restore price levels of each container
+        for (size_t container = 0; container < SNAPSHOT_LEVELS; ++container)
+        {
+            for (uint64_t j = 0; j < order_book.Levels[container]; ++j)
+            {
+                ErrorCode result = LoadSnapshotLevel(order_book_ptr, container, data, end);
+                if (result != ErrorCode::OK)
+                    return result;
+            }
+        }
+    }
+
+    if (_orders.size() != header.Orders)
+        return ErrorCode::SNAPSHOT_INVALID;
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline ErrorCode BasicMarketManager<THandler>::LoadSnapshotLevel(OrderBook* order_book_ptr, size_t container, const uint8_t*& data, const uint8_t* end)
+{
+    SnapshotLevel level;
+    if (!ReadSnapshotRecord(&level, sizeof(level), data, end) || (level.Orders == 0))
+        return ErrorCode::SNAPSHOT_INVALID;
+
+    // Buy side containers have even indexes
+    bool buy = ((container % 2) == 0);
+
+    // Price level must not exist
+    const LevelNode* existing_ptr = nullptr;
+    switch (container)
+    {
+        case SNAPSHOT_BIDS:
+            existing_ptr = order_book_ptr->GetBid(level.Price);
+            break;
+        case SNAPSHOT_ASKS:
+            existing_ptr = order_book_ptr->GetAsk(level.Price);
+            break;
+        case SNAPSHOT_BUY_STOP:
+            existing_ptr = order_book_ptr->GetBuyStopLevel(level.Price);
+            break;
+        case SNAPSHOT_SELL_STOP:
+            existing_ptr = order_book_ptr->GetSellStopLevel(level.Price);
+            break;
+        case SNAPSHOT_TRAILING_BUY_STOP:
+            existing_ptr = order_book_ptr->GetTrailingBuyStopLevel(level.Price);
+            break;
+        default:
+            existing_ptr = order_book_ptr->GetTrailingSellStopLevel(level.Price);
+            break;
+    }
+    if (existing_ptr != nullptr)
+        return ErrorCode::SNAPSHOT_INVALID;
+
+    LevelNode* level_ptr = nullptr;
+    for (uint64_t i = 0; i < level.Orders; ++i)
+    {
+        Order order;
+        if (!ReadSnapshotRecord(&order, sizeof(order), data, end))
+            return ErrorCode::SNAPSHOT_INVALID;
+
+        // Validate the order type against its price level container
+        bool type;
+        if (container < SNAPSHOT_BUY_STOP)
+            type = order.IsLimit();
+        else if (container < SNAPSHOT_TRAILING_BUY_STOP)
+            type = order.IsStop() || order.IsStopLimit();
+        else
+            type = order.IsTrailingStop() || order.IsTrailingStopLimit();
+
+        // Validate the order against its price level
+        uint64_t price = (container < SNAPSHOT_BUY_STOP) ? order.Price : order.StopPrice;
+        if (!type || (order.SymbolId != order_book_ptr->_symbol.Id) || (order.IsBuy() != buy) || (price != level.Price) ||
+            (order.LeavesQuantity == 0) || (order.LeavesQuantity > order.Quantity))
+            return ErrorCode::SNAPSHOT_INVALID;
+
+        // Create a new order
+        OrderNode* order_ptr = _order_pool.Create(order);
+
+        // Insert the order
+        if (!_orders.Insert(order_ptr))
+        {
+            // Release the order
+            _order_pool.Release(order_ptr);
+            return ErrorCode::SNAPSHOT_INVALID;
+        }
+
+        // Create the price level with the first order
+        if (level_ptr == nullptr)
+        {
+            if (container < SNAPSHOT_BUY_STOP)
+                level_ptr = order_book_ptr->AddLevel(order_ptr);
+            else if (container < SNAPSHOT_TRAILING_BUY_STOP)
+                level_ptr = order_book_ptr->AddStopLevel(order_ptr);
+            else
+                level_ptr = order_book_ptr->AddTrailingStopLevel(order_ptr);
+        }
+
+        // Link the order to the price level
+        order_book_ptr->LinkOrder(level_ptr, order_ptr);
+
+        // Register the trailing stop order repricing threshold
+        if (container >= SNAPSHOT_TRAILING_BUY_STOP)
+            order_book_ptr->AddTrailingThreshold(order_ptr);
+
+        // Update the volume index
+        if ((container < SNAPSHOT_BUY_STOP) && order_book_ptr->_volume_index)
+            (order_ptr->IsBuy() ? order_book_ptr->_bid_volume : order_book_ptr->_ask_volume).Add(level_ptr->Price, order_ptr->LeavesQuantity);
+    }
+
+    // Update the price level in the depth
+    if (container < SNAPSHOT_BUY_STOP)
+        order_book_ptr->UpdateDepthLevel(level_ptr);
+
+    return ErrorCode::OK;
+}
+
+template <class THandler>
+inline bool BasicMarketManager<THandler>::ReadSnapshotRecord(void* record, size_t size, const uint8_t*& data, const uint8_t* end) noexcept
+{
+    if ((size_t)(end - data) < size)
+        return false;
+
+    std::memcpy(record, data, size);
+    data += size;
+    return true;
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::ConflateLevel(OrderBook& order_book, const LevelUpdate& update)
+{
+    // Find the price level changed before during the current operation
+    auto it = _conflated_levels.find(ConflatedLevel{ &order_book, update.Update.Type, update.Update.Price });
+    if (it != _conflated_levels.end())
+    {
+        LevelUpdate& conflated = order_book._conflated_levels[it->second];
+
+        // Merge price level updates
+        switch (update.Type)
+        {
+            case UpdateType::ADD:
+                // Deleted price level was added again
+                conflated.Type = (conflated.Type == UpdateType::DELETE) ? UpdateType::UPDATE : UpdateType::ADD;
+                break;
+            case UpdateType::DELETE:
+                // Added price level was deleted again
+                conflated.Type = (conflated.Type == UpdateType::ADD) ? UpdateType::NONE : UpdateType::DELETE;
+                break;
+            default:
+                break;
+        }
+        conflated.Update = update.Update;
+        conflated.Top = conflated.Top || update.Top;
+        return;
+    }
+
+    // Remember the order book with conflated price levels
+    if (order_book._conflated_levels.empty())
+        _conflated_order_books.push_back(&order_book);
+
+    _conflated_levels.insert(std::make_pair(ConflatedLevel{ &order_book, update.Update.Type, update.Update.Price }, order_book._conflated_levels.size()));
+    order_book._conflated_levels.push_back(update);
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::PublishDepth(OrderBook& order_book)
+{
+    // Outside of market operations the depth is published immediately
+    if (_conflation_depth == 0)
+    {
+        order_book.PublishDepth();
+        return;
+    }
+
+    if (!order_book._depth_publish_pending)
+    {
+        order_book._depth_publish_pending = true;
+        _depth_order_books.push_back(&order_book);
+    }
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::PublishPendingDepth()
+{
+    for (auto order_book_ptr : _depth_order_books)
+    {
+        order_book_ptr->_depth_publish_pending = false;
+        order_book_ptr->PublishDepth();
+    }
+    _depth_order_books.clear();
+}
+
+template <class THandler>
+inline void BasicMarketManager<THandler>::FlushLevels()
+{
+    // Market handlers could modify the market during notifications, so their
+    // price level changes are conflated and notified by the same flush
+    ++_conflation_depth;
+
+    // Notify conflated price levels grouped by order books
+    for (size_t i = 0; i < _conflated_order_books.size(); ++i)
+    {
+        OrderBook* order_book_ptr = _conflated_order_books[i];
+
+        bool changed = false;
+        bool top = false;
+        for (size_t j = 0; j < order_book_ptr->_conflated_levels.size(); ++j)
+        {
+            const LevelUpdate update = order_book_ptr->_conflated_levels[j];
+
+            // Mark the price level as notified
+            _conflated_levels.erase(ConflatedLevel{ order_book_ptr, update.Update.Type, update.Update.Price });
+
+            switch (update.Type)
+            {
+                case UpdateType::ADD:
+                    _market_handler.onAddLevel(*order_book_ptr, update.Update, update.Top);
+                    break;
+                case UpdateType::UPDATE:
+                    _market_handler.onUpdateLevel(*order_book_ptr, update.Update, update.Top);
+                    break;
+                case UpdateType::DELETE:
+                    _market_handler.onDeleteLevel(*order_book_ptr, update.Update, update.Top);
+                    break;
+                default:
+                    break;
+            }
+
+            if (update.Type != UpdateType::NONE)
+            {
+                changed = true;
+                top = top || update.Top;
+            }
+        }
+        order_book_ptr->_conflated_levels.clear();
+
+        if (changed)
+            _market_handler.onUpdateOrderBook(*order_book_ptr, top);
+    }
+    _conflated_order_books.clear();
+
+    --_conflation_depth;
 }
 
 } // namespace Matching
@@ -0,0 +1,214 @@
+/*!
+    \file market_manager_optimized.h
+    \brief Optimized market manager definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_MANAGER_OPTIMIZED_H
+#define CPPTRADER_MATCHING_MARKET_MANAGER_OPTIMIZED_H
+
+#include "errors.h"
+#include "market_handler_optimized.h"
+
+#include "memory/allocator_pool.h"
+
+#include <cassert>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Optimized market manager
+/*!
+    Optimized market manager is used to build L2/L3 order books from market
+    data feeds. It supports only limit orders and has no matching, stop orders
+    and orders lists for price levels, so it is much faster than MarketManager.
+    Optimization tricks are the following:
+    \li Orders are stored in the array indexed by order Id instead of the hash map
+    \li Price levels are stored in sorted arrays with the best prices at the end
+    \li Price levels are taken from the pool with O(1) create and release
+
+    Orders container grows up to the maximal order Id, so the manager should be
+    used with dense order Ids like exchange order reference numbers.
+
+    Not thread-safe.
+*/
+class MarketManagerOptimized
+{
+public:
+    //! Symbols container
+    typedef std::vector<Symbol*> Symbols;
+    //! Order books container
+    typedef std::vector<OrderBookOptimized*> OrderBooks;
+    //! Orders container
+    typedef std::vector<OrderOptimized> Orders;
+
+    MarketManagerOptimized();
+    MarketManagerOptimized(MarketHandlerOptimized& market_handler);
+    MarketManagerOptimized(const MarketManagerOptimized&) = delete;
+    MarketManagerOptimized(MarketManagerOptimized&&) = delete;
+    ~MarketManagerOptimized();
+
+    MarketManagerOptimized& operator=(const MarketManagerOptimized&) = delete;
+    MarketManagerOptimized& operator=(MarketManagerOptimized&&) = delete;
+
+    //! Get the symbols container
+    const Symbols& symbols() const noexcept { return _symbols; }
+    //! Get the order books container
+    const OrderBooks& order_books() const noexcept { return _order_books; }
+    //! Get the price level pool
+    const LevelPool& levels() const noexcept { return _levels; }
+
+    //! Get the symbol with the given Id
+    /*!
+        \param id - Symbol Id
+        \return Pointer to the symobl with the given Id or nullptr
+    */
+    const Symbol* GetSymbol(uint32_t id) const noexcept;
+    //! Get the order book for the given symbol Id
+    /*!
+        \param id - Symbol Id of the order book
+        \return Pointer to the order book with the given symbol Id or nullptr
+    */
+    const OrderBookOptimized* GetOrderBook(uint32_t id) const noexcept;
+    //! Get the order with the given Id
+    /*!
+        \param id - Order Id
+        \return Pointer to the order with the given Id or nullptr
+    */
+    const OrderOptimized* GetOrder(uint64_t id) const noexcept;
+
+    //! Reserve containers capacity
+    /*!
+        Pre-allocates symbols, price levels and orders containers to avoid
+        re-allocations during market data processing.
+
+        \param symbols - Maximal symbol Id
+        \param levels - Maximal price levels count
+        \param orders - Maximal order Id
+    */
+    void Reserve(size_t symbols, size_t levels, size_t orders);
+
+    //! Add a new symbol
+    /*!
+        \param symbol - Symbol to add
+        \return Error code
+    */
+    ErrorCode AddSymbol(const Symbol& symbol);
+    //! Delete the symbol
+    /*!
+        \param id - Symbol Id
+        \return Error code
+    */
+    ErrorCode DeleteSymbol(uint32_t id);
+
+    //! Add a new order book
+    /*!
+        \param symbol - Symbol of the order book to add
+        \return Error code
+    */
+    ErrorCode AddOrderBook(const Symbol& symbol);
+    //! Delete the order book
+    /*!
+        \param id - Symbol Id of the order book
+        \return Error code
+    */
+    ErrorCode DeleteOrderBook(uint32_t id);
+
+    //! Add a new limit order
+    /*!
+        \param id - Order Id
+        \param symbol - Symbol Id
+        \param side - Order side
+        \param price - Order price
+        \param quantity - Order quantity
+        \return Error code
+    */
+    ErrorCode AddOrder(uint64_t id, uint32_t symbol, OrderSide side, uint64_t price, uint64_t quantity);
+    //! Reduce the order by the given quantity
+    /*!
+        \param id - Order Id
+        \param quantity - Order quantity to reduce
+        \return Error code
+    */
+    ErrorCode ReduceOrder(uint64_t id, uint64_t quantity);
+    //! Modify the order
+    /*!
+        The order with zero new quantity will be deleted.
+
+        \param id - Order Id
+        \param new_price - Order price to modify
+        \param new_quantity - Order quantity to modify
+        \return Error code
+    */
+    ErrorCode ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity);
+    //! Replace the order with a similar order but different Id, price and quantity
+    /*!
+        \param id - Order Id
+        \param new_id - Order Id to replace
+        \param new_price - Order price to replace
+        \param new_quantity - Order quantity to replace
+        \return Error code
+    */
+    ErrorCode ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity);
+    //! Delete the order
+    /*!
+        \param id - Order Id
+        \return Error code
+    */
+    ErrorCode DeleteOrder(uint64_t id);
+
+    //! Execute the order at its price
+    /*!
+        \param id - Order Id
+        \param quantity - Order executed quantity
+        \return Error code
+    */
+    ErrorCode ExecuteOrder(uint64_t id, uint64_t quantity);
+    //! Execute the order
+    /*!
+        \param id - Order Id
+        \param price - Order executed price
+        \param quantity - Order executed quantity
+        \return Error code
+    */
+    ErrorCode ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity);
+
+private:
+    // Market handler
+    static MarketHandlerOptimized _default;
+    MarketHandlerOptimized& _market_handler;
+
+    // Auxiliary memory manager
+    CppCommon::DefaultMemoryManager _auxiliary_memory_manager;
+
+    // Bid/Ask price levels
+    LevelPool _levels;
+
+    // Symbols
+    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _symbol_memory_manager;
+    CppCommon::PoolAllocator<Symbol, CppCommon::DefaultMemoryManager> _symbol_pool;
+    Symbols _symbols;
+
+    // Order books
+    CppCommon::PoolMemoryManager<CppCommon::DefaultMemoryManager> _order_book_memory_manager;
+    CppCommon::PoolAllocator<OrderBookOptimized, CppCommon::DefaultMemoryManager> _order_book_pool;
+    OrderBooks _order_books;
+
+    // Orders
+    Orders _orders;
+
+    OrderOptimized* FindOrder(uint64_t id) noexcept { return (OrderOptimized*)GetOrder(id); }
+    OrderOptimized* InsertOrder(uint64_t id);
+
+    void UpdateLevel(const OrderBookOptimized& order_book, const LevelUpdate& update) const;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_manager_optimized.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_MANAGER_OPTIMIZED_H
@@ -0,0 +1,48 @@
+/*!
+    \file market_manager_optimized.inl
+    \brief Optimized market manager inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline MarketManagerOptimized::MarketManagerOptimized()
+    : MarketManagerOptimized(_default)
+{
+}
+
+inline MarketManagerOptimized::MarketManagerOptimized(MarketHandlerOptimized& market_handler)
+    : _market_handler(market_handler),
+      _auxiliary_memory_manager(),
+      _symbol_memory_manager(_auxiliary_memory_manager),
+      _symbol_pool(_symbol_memory_manager),
+      _order_book_memory_manager(_auxiliary_memory_manager),
+      _order_book_pool(_order_book_memory_manager)
+{
+}
+
+inline const Symbol* MarketManagerOptimized::GetSymbol(uint32_t id) const noexcept
+{
+    return ((id < _symbols.size()) ? _symbols[id] : nullptr);
+}
+
+inline const OrderBookOptimized* MarketManagerOptimized::GetOrderBook(uint32_t id) const noexcept
+{
+    return ((id < _order_books.size()) ? _order_books[id] : nullptr);
+}
+
+inline const OrderOptimized* MarketManagerOptimized::GetOrder(uint64_t id) const noexcept
+{
+    assert((id > 0) && "Order Id must be greater than zero!");
+    if ((id == 0) || (id >= _orders.size()))
+        return nullptr;
+
+    const OrderOptimized* order_ptr = &_orders[id];
+    return ((order_ptr->Id == id) ? order_ptr : nullptr);
+}
+
+} // namespace Matching
+} // namespace CppTrader
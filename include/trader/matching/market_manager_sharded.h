@@ -0,0 +1,165 @@
+/*!
+    \file market_manager_sharded.h
+    \brief Sharded market manager definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_MANAGER_SHARDED_H
+#define CPPTRADER_MATCHING_MARKET_MANAGER_SHARDED_H
+
+#include "market_manager.h"
+
+#include "threads/spsc_ring_queue.h"
+#include "threads/thread.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Sharded market manager
+/*!
+    Sharded market manager partitions the market by symbol Id between several
+    worker threads. Each shard owns its own MarketManager with order books of
+    the symbols routed to it (symbol Id modulo shards count) and receives market
+    commands through the lock-free SPSC ring queue, so order books of different
+    symbols are processed in parallel while commands of the same symbol are
+    processed in the submission order.
+
+    Market handler of each shard is called from the shard worker thread.
+
+    Order commands take the symbol Id of the order explicitly, so they could be
+    routed without the shared orders lookup. Order Ids must be unique across all
+    symbols.
+
+    Matching commands are broadcast to all shards, so EnableMatching() on the
+    preloaded market uncrosses order books of all shards in parallel.
+
+    Commands are processed asynchronously, so errors are only counted. Use Wait()
+    method to wait until all submitted commands are processed before inspecting
+    shard market managers.
+
+    Commands must be submitted from the single producer thread.
+*/
+class MarketManagerSharded
+{
+public:
+    //! Initialize the sharded market manager
+    /*!
+        \param market_handlers - Market handlers for each shard (one shard per handler)
+        \param matching - Automatic matching flag (default is false)
+        \param queue_capacity - Command queue capacity of each shard, must be a power of two (default is 65536)
+        \throws std::invalid_argument if no market handlers are provided
+    */
+    explicit MarketManagerSharded(const std::vector<MarketHandler*>& market_handlers, bool matching = false, size_t queue_capacity = 65536);
+    MarketManagerSharded(const MarketManagerSharded&) = delete;
+    MarketManagerSharded(MarketManagerSharded&&) = delete;
+    ~MarketManagerSharded();
+
+    MarketManagerSharded& operator=(const MarketManagerSharded&) = delete;
+    MarketManagerSharded& operator=(MarketManagerSharded&&) = delete;
+
+    //! Get shards count
+    size_t shards() const noexcept { return _shards.size(); }
+    //! Get the market manager of the given shard
+    /*!
+        Shard market manager is modified from the shard worker thread, so it
+        could be inspected safely only after Wait() method call.
+
+        \param index - Shard index
+        \return Market manager of the shard
+    */
+    const MarketManager& shard(size_t index) const noexcept { return _shards[index]->Market; }
+
+    //! Get processed commands count
+    uint64_t processed() const noexcept;
+    //! Get failed commands count
+    uint64_t errors() const noexcept;
+
+    //! Get the shard index for the given symbol Id
+    size_t ShardOf(uint32_t symbol) const noexcept { return symbol % _shards.size(); }
+
+    //! Add a new symbol
+    void AddSymbol(const Symbol& symbol) { Submit(MarketCommand::AddSymbol(symbol)); }
+    //! Delete the symbol
+    void DeleteSymbol(uint32_t id) { Submit(MarketCommand::DeleteSymbol(id)); }
+
+    //! Add a new order book
+    void AddOrderBook(const Symbol& symbol) { Submit(MarketCommand::AddOrderBook(symbol)); }
+    //! Delete the order book
+    void DeleteOrderBook(uint32_t id) { Submit(MarketCommand::DeleteOrderBook(id)); }
+
+    //! Add a new order
+    void AddOrder(const Order& order) { Submit(MarketCommand::AddOrder(order)); }
+    //! Reduce the order by the given quantity
+    void ReduceOrder(uint32_t symbol, uint64_t id, uint64_t quantity) { Submit(MarketCommand::ReduceOrder(symbol, id, quantity)); }
+    //! Modify the order
+    void ModifyOrder(uint32_t symbol, uint64_t id, uint64_t new_price, uint64_t new_quantity) { Submit(MarketCommand::ModifyOrder(symbol, id, new_price, new_quantity)); }
+    //! Mitigate the order
+    void MitigateOrder(uint32_t symbol, uint64_t id, uint64_t new_price, uint64_t new_quantity) { Submit(MarketCommand::MitigateOrder(symbol, id, new_price, new_quantity)); }
+    //! Replace the order with a similar order but different Id, price and quantity
+    void ReplaceOrder(uint32_t symbol, uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity) { Submit(MarketCommand::ReplaceOrder(symbol, id, new_id, new_price, new_quantity)); }
+    //! Delete the order
+    void DeleteOrder(uint32_t symbol, uint64_t id) { Submit(MarketCommand::DeleteOrder(symbol, id)); }
+    //! Execute the order
+    void ExecuteOrder(uint32_t symbol, uint64_t id, uint64_t quantity) { Submit(MarketCommand::ExecuteOrder(symbol, id, quantity)); }
+    //! Execute the order at the given price
+    void ExecuteOrder(uint32_t symbol, uint64_t id, uint64_t price, uint64_t quantity) { Submit(MarketCommand::ExecuteOrder(symbol, id, price, quantity)); }
+
+    //! Enable automatic matching in all shards
+    void EnableMatching() { Broadcast(MarketCommand::EnableMatching()); }
+    //! Disable automatic matching in all shards
+    void DisableMatching() { Broadcast(MarketCommand::DisableMatching()); }
+    //! Match crossed orders in all shards
+    void Match() { Broadcast(MarketCommand::Match()); }
+
+    //! Submit the market command to the shard of its symbol
+    /*!
+        If the shard command queue is full the method will spin until the shard
+        worker thread processes some commands.
+
+        \param command - Market command to submit
+    */
+    void Submit(const MarketCommand& command);
+    //! Submit the market command to all shards
+    /*!
+        \param command - Market command to submit
+    */
+    void Broadcast(const MarketCommand& command);
+
+    //! Wait until all submitted commands are processed
+    void Wait() const;
+
+private:
+    struct Shard
+    {
+        MarketManager Market;
+        CppCommon::SPSCRingQueue<MarketCommand> Queue;
+        std::thread Thread;
+        uint64_t Submitted;
+        alignas(64) std::atomic<uint64_t> Processed;
+        std::atomic<uint64_t> Errors;
+
+        Shard(MarketHandler& market_handler, size_t queue_capacity)
+            : Market(market_handler), Queue(queue_capacity), Submitted(0), Processed(0), Errors(0)
+        {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic<bool> _stop;
+
+    void Worker(Shard& shard);
+    void Stop();
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_manager_sharded.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_MANAGER_SHARDED_H
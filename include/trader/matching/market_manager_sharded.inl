@@ -0,0 +1,52 @@
+/*!
+    \file market_manager_sharded.inl
+    \brief Sharded market manager inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline uint64_t MarketManagerSharded::processed() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& shard : _shards)
+        result += shard->Processed.load(std::memory_order_acquire);
+    return result;
+}
+
+inline uint64_t MarketManagerSharded::errors() const noexcept
+{
+    uint64_t result = 0;
+    for (const auto& shard : _shards)
+        result += shard->Errors.load(std::memory_order_relaxed);
+    return result;
+}
+
+inline void MarketManagerSharded::Submit(const MarketCommand& command)
+{
+    Shard& shard = *_shards[ShardOf(command.SymbolId)];
+
+    // Spin until the shard queue has a free slot
+    while (!shard.Queue.Enqueue(command))
+        CppCommon::Thread::Yield();
+
+    ++shard.Submitted;
+}
+
+inline void MarketManagerSharded::Broadcast(const MarketCommand& command)
+{
+    for (auto& shard : _shards)
+    {
+        // Spin until the shard queue has a free slot
+        while (!shard->Queue.Enqueue(command))
+            CppCommon::Thread::Yield();
+
+        ++shard->Submitted;
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
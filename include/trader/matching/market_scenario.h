@@ -0,0 +1,169 @@
+/*!
+    \file market_scenario.h
+    \brief Market scenario definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_MARKET_SCENARIO_H
+#define CPPTRADER_MATCHING_MARKET_SCENARIO_H
+
+#include "market_journal.h"
+
+#include "common/writer.h"
+
+#include <string>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market scenario
+/*!
+    Market scenario is a sequence of market commands stored in the binary
+    market journal format (see JournalHeader), so binary scenarios could be
+    replayed at memory speed and any market journal could be loaded as a
+    scenario.
+
+    Scenario could be built with market manager like methods or converted from
+    the text scenario format of the matching engine example (one command per
+    line, lines started with '#' are comments):
+    \li enable matching, disable matching
+    \li add symbol {Id} {Name}, delete symbol {Id}
+    \li add book {Id}, delete book {Id}
+    \li add market {Side} {Id} {SymbolId} {Quantity}
+    \li add slippage market {Side} {Id} {SymbolId} {Quantity} {Slippage}
+    \li add limit {Side} {Id} {SymbolId} {Price} {Quantity}
+    \li add ioc limit, add fok limit, add aon limit - the same as add limit
+    \li add stop {Side} {Id} {SymbolId} {StopPrice} {Quantity}
+    \li add stop-limit {Side} {Id} {SymbolId} {StopPrice} {Price} {Quantity}
+    \li add trailing stop {Side} {Id} {SymbolId} {StopPrice} {Quantity} {TrailingDistance} {TrailingStep}
+    \li add trailing stop-limit {Side} {Id} {SymbolId} {StopPrice} {Price} {Quantity} {TrailingDistance} {TrailingStep}
+    \li reduce order {Id} {Quantity}
+    \li modify order {Id} {NewPrice} {NewQuantity}
+    \li mitigate order {Id} {NewPrice} {NewQuantity}
+    \li replace order {Id} {NewId} {NewPrice} {NewQuantity}
+    \li delete order {Id}
+    \li execute order {Id} {Price} {Quantity} - zero price executes the order at its own price
+
+    Not thread-safe.
+*/
+class MarketScenario
+{
+public:
+    MarketScenario();
+    MarketScenario(const MarketScenario&) = default;
+    MarketScenario(MarketScenario&&) = default;
+    ~MarketScenario() = default;
+
+    MarketScenario& operator=(const MarketScenario&) = default;
+    MarketScenario& operator=(MarketScenario&&) = default;
+
+    //! Check if the scenario is empty
+    bool empty() const noexcept { return _commands == 0; }
+
+    //! Get the scenario commands count
+    uint64_t commands() const noexcept { return _commands; }
+    //! Get the scenario size in bytes (including the journal header)
+    size_t size() const noexcept { return _buffer.size(); }
+    //! Get the scenario buffer in the market journal format
+    const std::vector<uint8_t>& buffer() const noexcept { return _buffer; }
+
+    //! Get the first scenario record
+    /*!
+        Scenario records are stored one after another and the size of each
+        record is stored in its first byte, so records could be iterated with
+        'record += record[0]' until the end of the scenario.
+    */
+    const uint8_t* begin() const noexcept { return _buffer.data() + sizeof(JournalHeader); }
+    //! Get the end of scenario records
+    const uint8_t* end() const noexcept { return _buffer.data() + _buffer.size(); }
+
+    //! Add a new symbol
+    void AddSymbol(const Symbol& symbol) { Append(JournalRecordType::ADD_SYMBOL, symbol); }
+    //! Delete the symbol
+    void DeleteSymbol(uint32_t id) { Append(JournalRecordType::DELETE_SYMBOL, id); }
+
+    //! Add a new order book
+    void AddOrderBook(const Symbol& symbol) { Append(JournalRecordType::ADD_ORDER_BOOK, symbol); }
+    //! Delete the order book
+    void DeleteOrderBook(uint32_t id) { Append(JournalRecordType::DELETE_ORDER_BOOK, id); }
+
+    //! Add a new order
+    void AddOrder(const Order& order) { Append(JournalRecordType::ADD_ORDER, order); }
+    //! Reduce the order by the given quantity
+    void ReduceOrder(uint64_t id, uint64_t quantity) { Append(JournalRecordType::REDUCE_ORDER, id, quantity); }
+    //! Modify the order
+    void ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity) { Append(JournalRecordType::MODIFY_ORDER, id, new_price, new_quantity); }
+    //! Mitigate the order
+    void MitigateOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity) { Append(JournalRecordType::MITIGATE_ORDER, id, new_price, new_quantity); }
+    //! Replace the order with a similar order but different Id, price and quantity
+    void ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity) { Append(JournalRecordType::REPLACE_ORDER, id, new_id, new_price, new_quantity); }
+    //! Replace the order with a new one
+    void ReplaceOrder(uint64_t id, const Order& new_order) { Append(JournalRecordType::REPLACE_ORDER_WITH_ORDER, id, new_order); }
+    //! Delete the order
+    void DeleteOrder(uint64_t id) { Append(JournalRecordType::DELETE_ORDER, id); }
+    //! Execute the order
+    void ExecuteOrder(uint64_t id, uint64_t quantity) { Append(JournalRecordType::EXECUTE_ORDER, id, quantity); }
+    //! Execute the order at the given price
+    void ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity) { Append(JournalRecordType::EXECUTE_ORDER_AT_PRICE, id, price, quantity); }
+
+    //! Enable automatic matching
+    void EnableMatching() { Append(JournalRecordType::ENABLE_MATCHING); }
+    //! Disable automatic matching
+    void DisableMatching() { Append(JournalRecordType::DISABLE_MATCHING); }
+    //! Match crossed orders in all order books
+    void Match() { Append(JournalRecordType::MATCH); }
+
+    //! Parse the text scenario command and append it to the scenario
+    /*!
+        Empty lines and comments are skipped.
+
+        \param command - Text scenario command
+        \return Error code (SCENARIO_INVALID if the command cannot be parsed)
+    */
+    ErrorCode Parse(const std::string& command);
+
+    //! Load the binary scenario from the memory buffer
+    /*!
+        Scenario is loaded up to the end of the market journal (zero record
+        size, incomplete record or broken checksum), so a preallocated market
+        journal file could be loaded as well.
+
+        \param buffer - Scenario buffer
+        \param size - Scenario buffer size
+        \return Error code (JOURNAL_INVALID if the journal header is invalid)
+    */
+    ErrorCode Load(const void* buffer, size_t size);
+    //! Save the binary scenario
+    /*!
+        \param writer - Writer to save the scenario
+        \return Error code (JOURNAL_WRITE_FAILED if the scenario cannot be written)
+    */
+    ErrorCode Save(CppCommon::Writer& writer) const;
+
+    //! Replay the scenario into the given market manager
+    /*!
+        \param market - Market manager to replay the scenario into
+        \return Count of failed commands
+    */
+    uint64_t Replay(MarketManager& market) const;
+
+    //! Clear the scenario
+    void Clear();
+
+private:
+    std::vector<uint8_t> _buffer;
+    uint64_t _commands;
+
+    template <typename... TFields>
+    void Append(JournalRecordType type, const TFields&... fields);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "market_scenario.inl"
+
+#endif // CPPTRADER_MATCHING_MARKET_SCENARIO_H
@@ -0,0 +1,22 @@
+/*!
+    \file market_scenario.inl
+    \brief Market scenario inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+template <typename... TFields>
+inline void MarketScenario::Append(JournalRecordType type, const TFields&... fields)
+{
+    size_t offset = _buffer.size();
+    _buffer.resize(offset + JournalRecord::RecordSize<TFields...>());
+    JournalRecord::Encode(_buffer.data() + offset, type, fields...);
+    ++_commands;
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -126,29 +126,17 @@ TOutputStream& operator<<(TOutputStream& stream, OrderTimeInForce tif);
 */
 struct Order
 {
+    // Hot order fields are accessed on every add, reduce, delete and
+    // execute operation and fit into the first cache line of the order node.
+    // The line is full, so the executed quantity is kept with cold fields
+
     //! Order Id
     uint64_t Id;
-    //! Symbol Id
-    uint32_t SymbolId;
-    //! Order type
-    OrderType Type;
-    //! Order side
-    OrderSide Side;
     //! Order price
     uint64_t Price;
-    //! Order stop price
-    uint64_t StopPrice;
-
-    //! Order quantity
-    uint64_t Quantity;
-    //! Order executed quantity
-    uint64_t ExecutedQuantity;
     //! Order leaves quantity
     uint64_t LeavesQuantity;
 
-    //! Time in Force
-    OrderTimeInForce TimeInForce;
-
     //! Order max visible quantity
     /*!
         This property allows to prepare 'iceberg'/'hidden' orders with the
@@ -165,6 +153,26 @@ struct Order
     //! Order visible quantity
     uint64_t VisibleQuantity() const noexcept { return std::min(LeavesQuantity, MaxVisibleQuantity); }
 
+    //! Symbol Id
+    uint32_t SymbolId;
+    //! Order type
+    OrderType Type;
+    //! Order side
+    OrderSide Side;
+    //! Time in Force
+    OrderTimeInForce TimeInForce;
+
+    // Cold order fields are accessed by executions (executed quantity is
+    // updated on every fill) and by stop, trailing stop and market orders
+
+    //! Order quantity
+    uint64_t Quantity;
+    //! Order executed quantity
+    uint64_t ExecutedQuantity;
+
+    //! Order stop price
+    uint64_t StopPrice;
+
     //! Market order slippage
     /*!
         Slippage is useful to protect market order from executions at prices
@@ -296,12 +304,30 @@ struct Order
 };
 
 struct LevelNode;
+struct OrderNode;
 
-//! Order node
-struct OrderNode : public Order, public CppCommon::List<OrderNode>::Node
+//! Order node links
+/*!
+    Order node links are placed before the order fields in the order node,
+    so the list links, the price level and hot order fields share the same
+    cache line.
+*/
+struct OrderNodeLinks : public CppCommon::List<OrderNode>::Node
 {
+    //! Order price level
     LevelNode* Level;
+};
 
+//! Order node
+/*!
+    Order node is aligned to the cache line. The first cache line contains
+    list links, the price level and hot order fields, so adding, reducing and
+    deleting limit orders touches only this line. Executions also update the
+    executed quantity placed in the second cache line together with quantity,
+    stop, slippage and trailing fields.
+*/
+struct alignas(64) OrderNode : public OrderNodeLinks, public Order
+{
     OrderNode(const Order& order) noexcept;
     OrderNode(const OrderNode&) noexcept = default;
     OrderNode(OrderNode&&) noexcept = default;
@@ -83,16 +83,16 @@ inline TOutputStream& operator<<(TOutputStream& stream, OrderTimeInForce tif)
 
 inline Order::Order(uint64_t id, uint32_t symbol, OrderType type, OrderSide side, uint64_t price, uint64_t stop_price, uint64_t quantity, OrderTimeInForce tif, uint64_t max_visible_quantity, uint64_t slippage, int64_t trailing_distance, int64_t trailing_step) noexcept
     : Id(id),
+      Price(price),
+      LeavesQuantity(quantity),
+      MaxVisibleQuantity(max_visible_quantity),
       SymbolId(symbol),
       Type(type),
       Side(side),
-      Price(price),
-      StopPrice(stop_price),
+      TimeInForce(tif),
       Quantity(quantity),
       ExecutedQuantity(0),
-      LeavesQuantity(quantity),
-      TimeInForce(tif),
-      MaxVisibleQuantity(max_visible_quantity),
+      StopPrice(stop_price),
       Slippage(slippage),
       TrailingDistance(trailing_distance),
       TrailingStep(trailing_step)
@@ -215,8 +215,9 @@ inline Order Order::TrailingSellStopLimit(uint64_t id, uint32_t symbol, uint64_t
     return Order(id, symbol, OrderType::TRAILING_STOP_LIMIT, OrderSide::SELL, price, stop_price, quantity, tif, max_visible_quantity, std::numeric_limits<uint64_t>::max(), trailing_distance, trailing_step);
 }
 
-inline OrderNode::OrderNode(const Order& order) noexcept : Order(order), Level(nullptr)
+inline OrderNode::OrderNode(const Order& order) noexcept : Order(order)
 {
+    Level = nullptr;
 }
 
 inline OrderNode& OrderNode::operator=(const Order& order) noexcept
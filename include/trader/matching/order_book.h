@@ -9,31 +9,92 @@
 #ifndef CPPTRADER_MATCHING_ORDER_BOOK_H
 #define CPPTRADER_MATCHING_ORDER_BOOK_H
 
+#include "depth_publisher.h"
 #include "level.h"
+#include "price_ladder.h"
+#include "reserved_memory_manager.h"
 #include "symbol.h"
+#include "top_of_book.h"
+#include "volume_index.h"
 
 #include "memory/allocator_pool.h"
 
+#include <map>
+#include <vector>
+
 namespace CppTrader {
 namespace Matching {
 
-class MarketManager;
+template <class THandler>
+class BasicMarketManager;
+
+//! Order book options
+/*!
+    Order book options select optional order book data structures. Market
+    manager keeps options for new order books (see MarketManager::EnablePriceLadder(),
+    MarketManager::EnableDepth() and other methods).
+*/
+struct OrderBookOptions
+{
+    //! Price ladder tick size (0 to keep all price levels in AVL trees)
+    uint64_t LadderTickSize;
+    //! Price ladder window size in ticks
+    size_t LadderTicks;
+    //! Depth size in price levels (0 to disable the depth)
+    size_t Depth;
+    //! Depth publication flag
+    bool DepthPublication;
+    //! Volume index flag
+    bool VolumeIndex;
+    //! Top of the book publication flag
+    bool TopOfBook;
+
+    OrderBookOptions() noexcept : LadderTickSize(0), LadderTicks(0), Depth(0), DepthPublication(false), VolumeIndex(false), TopOfBook(false) {}
+};
 
 //! Order book
 /*!
     Order book is used to keep buy and sell orders in a price level order.
 
-    Not thread-safe.
+    Bid, ask and stop price levels are kept in AVL trees. Optionally (see
+    MarketManager::EnablePriceLadder() method) price levels near the best ones
+    are kept in flat tick-indexed price ladders and AVL trees keep only far away
+    or unaligned price levels.
+
+    Optionally (see MarketManager::EnableDepth() method) order book keeps a copy
+    of the top bid and ask price levels in contiguous arrays which are updated
+    incrementally with each order book change. Optionally (see MarketManager::EnableDepthPublication()
+    method) the depth is published once per market operation, so other threads
+    could read consistent depth snapshots without locks.
+
+    Optionally (see MarketManager::EnableVolumeIndex() method) order book keeps
+    bid and ask volumes in volume indexes, so the volume available up to the
+    given price is calculated without walking price levels.
+
+    Optionally (see MarketManager::EnableTopOfBook() method) order book publishes
+    its best bid and ask price levels and the last trade price with a seqlock,
+    so other threads could read them without locks (see top_of_book() method).
+
+    Not thread-safe except of the top of the book publisher.
 */
 class OrderBook
 {
-    friend class MarketManager;
+    template <class THandler>
+    friend class BasicMarketManager;
 
 public:
     //! Price level container
     typedef CppCommon::BinTreeAVL<LevelNode, std::less<LevelNode>> Levels;
+    //! Price level allocator
+    typedef CppCommon::PoolAllocator<LevelNode, ReservedMemoryManager> LevelAllocator;
 
-    OrderBook(MarketManager& manager, const Symbol& symbol);
+    //! Create a new order book
+    /*!
+        \param level_pool - Price level pool of the market manager
+        \param symbol - Order book symbol
+        \param options - Order book options
+    */
+    OrderBook(LevelAllocator& level_pool, const Symbol& symbol, const OrderBookOptions& options);
     OrderBook(const OrderBook&) = delete;
     OrderBook(OrderBook&&) = delete;
     ~OrderBook();
@@ -48,7 +109,19 @@ public:
     bool empty() const noexcept { return size() == 0; }
 
     //! Get the order book size
-    size_t size() const noexcept { return _bids.size() + _asks.size() + _buy_stop.size() + _sell_stop.size() + _trailing_buy_stop.size() + _trailing_sell_stop.size(); }
+    size_t size() const noexcept { return bids_size() + asks_size() + buy_stop_size() + sell_stop_size() + trailing_buy_stop_size() + trailing_sell_stop_size(); }
+    //! Get the order book bid price levels count
+    size_t bids_size() const noexcept { return _bids.size() + _bid_ladder.size(); }
+    //! Get the order book ask price levels count
+    size_t asks_size() const noexcept { return _asks.size() + _ask_ladder.size(); }
+    //! Get the order book buy stop price levels count
+    size_t buy_stop_size() const noexcept { return _buy_stop.size() + _buy_stop_ladder.size(); }
+    //! Get the order book sell stop price levels count
+    size_t sell_stop_size() const noexcept { return _sell_stop.size() + _sell_stop_ladder.size(); }
+    //! Get the order book trailing buy stop price levels count
+    size_t trailing_buy_stop_size() const noexcept { return _trailing_buy_stop.size() + _trailing_buy_stop_ladder.size(); }
+    //! Get the order book trailing sell stop price levels count
+    size_t trailing_sell_stop_size() const noexcept { return _trailing_sell_stop.size() + _trailing_sell_stop_ladder.size(); }
 
     //! Get the order book symbol
     const Symbol& symbol() const noexcept { return _symbol; }
@@ -59,30 +132,103 @@ public:
     const LevelNode* best_ask() const noexcept { return _best_ask; }
 
     //! Get the order book bids container
+    /*!
+        In the price ladder mode the container keeps only bid price levels outside
+        of the ladder window. Use best_bid() and GetNextLevel() to walk all of them.
+    */
     const Levels& bids() const noexcept { return _bids; }
     //! Get the order book asks container
+    /*!
+        In the price ladder mode the container keeps only ask price levels outside
+        of the ladder window. Use best_ask() and GetNextLevel() to walk all of them.
+    */
     const Levels& asks() const noexcept { return _asks; }
 
+    //! Get the order book depth size in price levels
+    size_t depth() const noexcept { return _depth; }
+    //! Get the order book bid depth
+    /*!
+        Bid depth keeps up to depth() best bid price levels ordered from the best
+        price. Price levels are stored contiguously, so the depth could be published
+        with a single memcpy instead of walking the price levels containers.
+    */
+    const std::vector<Level>& bid_depth() const noexcept { return _bid_depth; }
+    //! Get the order book ask depth
+    /*!
+        Ask depth keeps up to depth() best ask price levels ordered from the best
+        price. Price levels are stored contiguously, so the depth could be published
+        with a single memcpy instead of walking the price levels containers.
+    */
+    const std::vector<Level>& ask_depth() const noexcept { return _ask_depth; }
+    //! Get the order book depth publisher
+    /*!
+        Publisher keeps the bid and ask depth published by the market manager
+        thread at the end of each market operation which changed the depth.
+        Any other thread could read the consistent depth snapshot without locks.
+    */
+    const DepthPublisher& depth_publisher() const noexcept { return _depth_publisher; }
+
+    //! Is the top of the book publication enabled?
+    bool IsTopOfBookEnabled() const noexcept { return _top_of_book; }
+    //! Get the order book top of the book publisher
+    /*!
+        Publisher keeps the best bid and ask price levels and the last trade price
+        published by the market manager thread after each change of them. Any other
+        thread could read the consistent top of the book without locks.
+    */
+    const TopOfBookPublisher& top_of_book() const noexcept { return _top_publisher; }
+
+    //! Get the order book bid price ladder
+    const PriceLadder& bid_ladder() const noexcept { return _bid_ladder; }
+    //! Get the order book ask price ladder
+    const PriceLadder& ask_ladder() const noexcept { return _ask_ladder; }
+
     //! Get the order book best buy stop order price level
     const LevelNode* best_buy_stop() const noexcept { return _best_buy_stop; }
     //! Get the order book best sell stop order price level
     const LevelNode* best_sell_stop() const noexcept { return _best_sell_stop; }
 
     //! Get the order book buy stop orders container
+    /*!
+        In the price ladder mode the container keeps only buy stop price levels outside
+        of the ladder window. Use best_buy_stop() and GetNextStopLevel() to walk all of them.
+    */
     const Levels& buy_stop() const noexcept { return _buy_stop; }
     //! Get the order book sell stop orders container
+    /*!
+        In the price ladder mode the container keeps only sell stop price levels outside
+        of the ladder window. Use best_sell_stop() and GetNextStopLevel() to walk all of them.
+    */
     const Levels& sell_stop() const noexcept { return _sell_stop; }
 
+    //! Get the order book buy stop price ladder
+    const PriceLadder& buy_stop_ladder() const noexcept { return _buy_stop_ladder; }
+    //! Get the order book sell stop price ladder
+    const PriceLadder& sell_stop_ladder() const noexcept { return _sell_stop_ladder; }
+
     //! Get the order book best trailing buy stop order price level
     const LevelNode* best_trailing_buy_stop() const noexcept { return _best_trailing_buy_stop; }
     //! Get the order book best trailing sell stop order price level
     const LevelNode* best_trailing_sell_stop() const noexcept { return _best_trailing_sell_stop; }
 
     //! Get the order book trailing buy stop orders container
+    /*!
+        In the price ladder mode the container keeps only trailing buy stop price levels outside
+        of the ladder window. Use best_trailing_buy_stop() and GetNextTrailingStopLevel() to walk all of them.
+    */
     const Levels& trailing_buy_stop() const noexcept { return _trailing_buy_stop; }
     //! Get the order book trailing sell stop orders container
+    /*!
+        In the price ladder mode the container keeps only trailing sell stop price levels outside
+        of the ladder window. Use best_trailing_sell_stop() and GetNextTrailingStopLevel() to walk all of them.
+    */
     const Levels& trailing_sell_stop() const noexcept { return _trailing_sell_stop; }
 
+    //! Get the order book trailing buy stop price ladder
+    const PriceLadder& trailing_buy_stop_ladder() const noexcept { return _trailing_buy_stop_ladder; }
+    //! Get the order book trailing sell stop price ladder
+    const PriceLadder& trailing_sell_stop_ladder() const noexcept { return _trailing_sell_stop_ladder; }
+
     template <class TOutputStream>
     friend TOutputStream& operator<<(TOutputStream& stream, const OrderBook& order_book);
 
@@ -99,6 +245,39 @@ public:
     */
     const LevelNode* GetAsk(uint64_t price) const noexcept;
 
+    //! Is the volume index enabled?
+    bool IsVolumeIndexEnabled() const noexcept { return _volume_index; }
+
+    //! Get the total bid volume with prices higher or equal to the given one
+    /*!
+        It is the volume available to sell at the given price. The volume is
+        calculated with the volume index in O(log n) if it is enabled, otherwise
+        bid price levels are walked from the best one.
+
+        \param price - Price
+        \return Total bid volume with prices higher or equal to the given one
+    */
+    uint64_t GetBidVolume(uint64_t price) const noexcept;
+    //! Get the total ask volume with prices lower or equal to the given one
+    /*!
+        It is the volume available to buy at the given price. The volume is
+        calculated with the volume index in O(log n) if it is enabled, otherwise
+        ask price levels are walked from the best one.
+
+        \param price - Price
+        \return Total ask volume with prices lower or equal to the given one
+    */
+    uint64_t GetAskVolume(uint64_t price) const noexcept;
+
+    //! Get the next order book price level of the same side
+    /*!
+        Next bid price level has a lower price and next ask price level has a higher price.
+
+        \param level - Bid or ask price level of the order book
+        \return Pointer to the next order book price level or nullptr
+    */
+    const LevelNode* GetNextLevel(const LevelNode* level) const noexcept;
+
     //! Get the order book buy stop level with the given price
     /*!
         \param price - Price
@@ -125,9 +304,26 @@ public:
     */
     const LevelNode* GetTrailingSellStopLevel(uint64_t price) const noexcept;
 
+    //! Get the next order book stop price level of the same side
+    /*!
+        Next sell stop price level has a lower price and next buy stop price level has a higher price.
+
+        \param level - Buy or sell stop price level of the order book
+        \return Pointer to the next order book stop price level or nullptr
+    */
+    const LevelNode* GetNextStopLevel(const LevelNode* level) const noexcept;
+    //! Get the next order book trailing stop price level of the same side
+    /*!
+        Next trailing sell stop price level has a lower price and next trailing buy stop price level has a higher price.
+
+        \param level - Trailing buy or sell stop price level of the order book
+        \return Pointer to the next order book trailing stop price level or nullptr
+    */
+    const LevelNode* GetNextTrailingStopLevel(const LevelNode* level) const noexcept;
+
 private:
-    // Market manager
-    MarketManager& _manager;
+    // Price level pool
+    LevelAllocator& _level_pool;
 
     // Order book symbol
     Symbol _symbol;
@@ -137,12 +333,53 @@ private:
     LevelNode* _best_ask;
     Levels _bids;
     Levels _asks;
+    PriceLadder _bid_ladder;
+    PriceLadder _ask_ladder;
 
     // Price level management
     LevelNode* GetNextLevel(LevelNode* level) noexcept;
     LevelNode* AddLevel(OrderNode* order_ptr);
     LevelNode* DeleteLevel(OrderNode* order_ptr);
 
+    // Bid/Ask depth
+    size_t _depth;
+    std::vector<Level> _bid_depth;
+    std::vector<Level> _ask_depth;
+    std::vector<LevelNode*> _bid_depth_levels;
+    std::vector<LevelNode*> _ask_depth_levels;
+
+    // Bid/Ask depth publication
+    bool _depth_changed;
+    bool _depth_publish_pending;
+    DepthPublisher _depth_publisher;
+
+    // Publish the changed depth
+    void PublishDepth() noexcept;
+
+    // Conflated price level updates
+    std::vector<LevelUpdate> _conflated_levels;
+
+    // Bid/Ask volume index
+    bool _volume_index;
+    VolumeIndex _bid_volume;
+    VolumeIndex _ask_volume;
+
+    // Top of the book publication
+    bool _top_of_book;
+    uint64_t _last_trade_price;
+    TopOfBookPublisher _top_publisher;
+
+    // Publish the current top of the book
+    void PublishTopOfBook() noexcept;
+
+    // Depth management
+    void AddDepthLevel(LevelNode* level_ptr);
+    void UpdateDepthLevel(const LevelNode* level_ptr);
+    void DeleteDepthLevel(LevelNode* level_ptr);
+
+    // Link the order to the price level
+    void LinkOrder(LevelNode* level_ptr, OrderNode* order_ptr) noexcept;
+
     // Orders management
     LevelUpdate AddOrder(OrderNode* order_ptr);
     LevelUpdate ReduceOrder(OrderNode* order_ptr, uint64_t quantity, uint64_t hidden, uint64_t visible);
@@ -153,6 +390,8 @@ private:
     LevelNode* _best_sell_stop;
     Levels _buy_stop;
     Levels _sell_stop;
+    PriceLadder _buy_stop_ladder;
+    PriceLadder _sell_stop_ladder;
 
     // Stop orders price level management
     LevelNode* GetNextStopLevel(LevelNode* level) noexcept;
@@ -169,6 +408,8 @@ private:
     LevelNode* _best_trailing_sell_stop;
     Levels _trailing_buy_stop;
     Levels _trailing_sell_stop;
+    PriceLadder _trailing_buy_stop_ladder;
+    PriceLadder _trailing_sell_stop_ladder;
 
     // Trailing stop orders price level management
     LevelNode* GetNextTrailingStopLevel(LevelNode* level) noexcept;
@@ -176,18 +417,35 @@ private:
     LevelNode* DeleteTrailingStopLevel(OrderNode* order_ptr);
 
     // Trailing stop orders management
-    void AddTrailingStopOrder(OrderNode* order_ptr);
+    void AddTrailingStopOrder(OrderNode* order_ptr, bool reprice = false);
     void ReduceTrailingStopOrder(OrderNode* order_ptr, uint64_t quantity, uint64_t hidden, uint64_t visible);
-    void DeleteTrailingStopOrder(OrderNode* order_ptr);
+    void DeleteTrailingStopOrder(OrderNode* order_ptr, bool reprice = false);
 
     // Trailing stop price calculation
     uint64_t CalculateTrailingStopPrice(const Order& order) const noexcept;
 
+    // Trailing stop orders counts grouped by the repricing threshold (trailing distance + trailing step)
+    struct TrailingThresholds
+    {
+        std::map<uint64_t, size_t> Absolute;
+        std::map<uint64_t, size_t> Percentage;
+    };
+    TrailingThresholds _trailing_buy_thresholds;
+    TrailingThresholds _trailing_sell_thresholds;
+
+    // Trailing stop thresholds management
+    void AddTrailingThreshold(const OrderNode* order_ptr);
+    void DeleteTrailingThreshold(const OrderNode* order_ptr);
+    // Get the first trailing stop price level which orders could be repriced at the current market price
+    LevelNode* GetTrailingStopRepriceLevel(bool buy) noexcept;
+
     // Market last and trailing prices
     uint64_t _last_bid_price;
     uint64_t _last_ask_price;
     uint64_t _matching_bid_price;
     uint64_t _matching_ask_price;
+    uint64_t _batch_bid_price;
+    uint64_t _batch_ask_price;
     uint64_t _trailing_bid_price;
     uint64_t _trailing_ask_price;
 
@@ -199,6 +457,12 @@ private:
     void UpdateLastPrice(const Order& order, uint64_t price) noexcept;
     void UpdateMatchingPrice(const Order& order, uint64_t price) noexcept;
     void ResetMatchingPrice() noexcept;
+    // Keep the extreme market prices of the batch for deferred stop orders activation
+    void UpdateBatchPrice() noexcept;
+    void ApplyBatchPrice() noexcept;
+
+    // Deferred matching flag
+    bool _match_pending;
 };
 
 } // namespace Matching
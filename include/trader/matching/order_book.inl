@@ -13,94 +13,173 @@ template <class TOutputStream>
 inline TOutputStream& operator<<(TOutputStream& stream, const OrderBook& order_book)
 {
     stream << "OrderBook(Symbol=" << order_book._symbol
-        << "; Bids=" << order_book._bids.size()
-        << "; Asks=" << order_book._asks.size()
-        << "; BuyStop=" << order_book._buy_stop.size()
-        << "; SellStop=" << order_book._sell_stop.size()
-        << "; TrailingBuyStop=" << order_book._trailing_buy_stop.size()
-        << "; TrailingSellStop=" << order_book._trailing_sell_stop.size()
+        << "; Bids=" << order_book.bids_size()
+        << "; Asks=" << order_book.asks_size()
+        << "; BuyStop=" << order_book.buy_stop_size()
+        << "; SellStop=" << order_book.sell_stop_size()
+        << "; TrailingBuyStop=" << order_book.trailing_buy_stop_size()
+        << "; TrailingSellStop=" << order_book.trailing_sell_stop_size()
         << ")";
     return stream;
 }
 
 inline const LevelNode* OrderBook::GetBid(uint64_t price) const noexcept
 {
+    if (_bid_ladder.IsInWindow(price))
+        return _bid_ladder.Find(price);
+
     auto it = _bids.find(LevelNode(LevelType::BID, price));
     return (it != _bids.end()) ? it.operator->() : nullptr;
 }
 
 inline const LevelNode* OrderBook::GetAsk(uint64_t price) const noexcept
 {
+    if (_ask_ladder.IsInWindow(price))
+        return _ask_ladder.Find(price);
+
     auto it = _asks.find(LevelNode(LevelType::ASK, price));
     return (it != _asks.end()) ? it.operator->() : nullptr;
 }
 
 inline const LevelNode* OrderBook::GetBuyStopLevel(uint64_t price) const noexcept
 {
+    if (_buy_stop_ladder.IsInWindow(price))
+        return _buy_stop_ladder.Find(price);
+
     auto it = _buy_stop.find(LevelNode(LevelType::ASK, price));
     return (it != _buy_stop.end()) ? it.operator->() : nullptr;
 }
 
 inline const LevelNode* OrderBook::GetSellStopLevel(uint64_t price) const noexcept
 {
+    if (_sell_stop_ladder.IsInWindow(price))
+        return _sell_stop_ladder.Find(price);
+
     auto it = _sell_stop.find(LevelNode(LevelType::BID, price));
     return (it != _sell_stop.end()) ? it.operator->() : nullptr;
 }
 
 inline const LevelNode* OrderBook::GetTrailingBuyStopLevel(uint64_t price) const noexcept
 {
+    if (_trailing_buy_stop_ladder.IsInWindow(price))
+        return _trailing_buy_stop_ladder.Find(price);
+
     auto it = _trailing_buy_stop.find(LevelNode(LevelType::ASK, price));
     return (it != _trailing_buy_stop.end()) ? it.operator->() : nullptr;
 }
 
 inline const LevelNode* OrderBook::GetTrailingSellStopLevel(uint64_t price) const noexcept
 {
+    if (_trailing_sell_stop_ladder.IsInWindow(price))
+        return _trailing_sell_stop_ladder.Find(price);
+
     auto it = _trailing_sell_stop.find(LevelNode(LevelType::BID, price));
     return (it != _trailing_sell_stop.end()) ? it.operator->() : nullptr;
 }
 
+inline uint64_t OrderBook::GetBidVolume(uint64_t price) const noexcept
+{
+    if (_volume_index)
+        return _bid_volume.Above(price);
+
+    uint64_t volume = 0;
+    for (const LevelNode* level_ptr = _best_bid; (level_ptr != nullptr) && (level_ptr->Price >= price); level_ptr = GetNextLevel(level_ptr))
+        volume += level_ptr->TotalVolume;
+    return volume;
+}
+
+inline uint64_t OrderBook::GetAskVolume(uint64_t price) const noexcept
+{
+    if (_volume_index)
+        return _ask_volume.Below(price);
+
+    uint64_t volume = 0;
+    for (const LevelNode* level_ptr = _best_ask; (level_ptr != nullptr) && (level_ptr->Price <= price); level_ptr = GetNextLevel(level_ptr))
+        volume += level_ptr->TotalVolume;
+    return volume;
+}
+
+inline const LevelNode* OrderBook::GetNextLevel(const LevelNode* level) const noexcept
+{
+    return const_cast<OrderBook*>(this)->GetNextLevel(const_cast<LevelNode*>(level));
+}
+
 inline LevelNode* OrderBook::GetNextLevel(LevelNode* level) noexcept
 {
     if (level->IsBid())
     {
+        // Merge the price ladder with the overflow bid price levels
+        if (_bid_ladder.enabled())
+            return _bid_ladder.Lower(_bids, level->Price);
+
         Levels::reverse_iterator it(&_bids, level);
         ++it;
         return it.operator->();
     }
     else
     {
+        // Merge the price ladder with the overflow ask price levels
+        if (_ask_ladder.enabled())
+            return _ask_ladder.Higher(_asks, level->Price);
+
         Levels::iterator it(&_asks, level);
         ++it;
         return it.operator->();
     }
 }
 
+inline const LevelNode* OrderBook::GetNextStopLevel(const LevelNode* level) const noexcept
+{
+    return const_cast<OrderBook*>(this)->GetNextStopLevel(const_cast<LevelNode*>(level));
+}
+
 inline LevelNode* OrderBook::GetNextStopLevel(LevelNode* level) noexcept
 {
     if (level->IsBid())
     {
+        // Merge the price ladder with the overflow sell stop price levels
+        if (_sell_stop_ladder.enabled())
+            return _sell_stop_ladder.Lower(_sell_stop, level->Price);
+
         Levels::reverse_iterator it(&_sell_stop, level);
         ++it;
         return it.operator->();
     }
     else
     {
+        // Merge the price ladder with the overflow buy stop price levels
+        if (_buy_stop_ladder.enabled())
+            return _buy_stop_ladder.Higher(_buy_stop, level->Price);
+
         Levels::iterator it(&_buy_stop, level);
         ++it;
         return it.operator->();
     }
 }
 
+inline const LevelNode* OrderBook::GetNextTrailingStopLevel(const LevelNode* level) const noexcept
+{
+    return const_cast<OrderBook*>(this)->GetNextTrailingStopLevel(const_cast<LevelNode*>(level));
+}
+
 inline LevelNode* OrderBook::GetNextTrailingStopLevel(LevelNode* level) noexcept
 {
     if (level->IsBid())
     {
+        // Merge the price ladder with the overflow trailing sell stop price levels
+        if (_trailing_sell_stop_ladder.enabled())
+            return _trailing_sell_stop_ladder.Lower(_trailing_sell_stop, level->Price);
+
         Levels::reverse_iterator it(&_trailing_sell_stop, level);
         ++it;
         return it.operator->();
     }
     else
     {
+        // Merge the price ladder with the overflow trailing buy stop price levels
+        if (_trailing_buy_stop_ladder.enabled())
+            return _trailing_buy_stop_ladder.Higher(_trailing_buy_stop, level->Price);
+
         Levels::iterator it(&_trailing_buy_stop, level);
         ++it;
         return it.operator->();
@@ -141,6 +220,26 @@ inline void OrderBook::UpdateLastPrice(const Order& order, uint64_t price) noexc
         _last_bid_price = price;
     else
         _last_ask_price = price;
+    _last_trade_price = price;
+}
+
+inline void OrderBook::PublishTopOfBook() noexcept
+{
+    if (!_top_of_book)
+        return;
+
+    _top_publisher.Publish((_best_bid != nullptr) ? _best_bid->Price : 0, (_best_bid != nullptr) ? _best_bid->TotalVolume : 0,
+                           (_best_ask != nullptr) ? _best_ask->Price : 0, (_best_ask != nullptr) ? _best_ask->TotalVolume : 0,
+                           _last_trade_price);
+}
+
+inline void OrderBook::PublishDepth() noexcept
+{
+    if (!_depth_changed)
+        return;
+
+    _depth_publisher.Publish(_bid_depth, _ask_depth);
+    _depth_changed = false;
 }
 
 inline void OrderBook::UpdateMatchingPrice(const Order& order, uint64_t price) noexcept
@@ -157,5 +256,38 @@ inline void OrderBook::ResetMatchingPrice() noexcept
     _matching_ask_price = std::numeric_limits<uint64_t>::max();
 }
 
+inline void OrderBook::UpdateBatchPrice() noexcept
+{
+    // Keep the lowest market bid price and the highest market ask price of the batch
+    _batch_bid_price = std::min(_batch_bid_price, GetMarketPriceBid());
+    _batch_ask_price = std::max(_batch_ask_price, GetMarketPriceAsk());
+}
+
+inline void OrderBook::ApplyBatchPrice() noexcept
+{
+    // Order book without batch commands keeps the reset matching price
+    if (_batch_bid_price != std::numeric_limits<uint64_t>::max())
+        _matching_bid_price = _batch_bid_price;
+    if (_batch_ask_price != 0)
+        _matching_ask_price = _batch_ask_price;
+    _batch_bid_price = std::numeric_limits<uint64_t>::max();
+    _batch_ask_price = 0;
+}
+
+inline void OrderBook::LinkOrder(LevelNode* level_ptr, OrderNode* order_ptr) noexcept
+{
+    // Update the price level volume
+    level_ptr->TotalVolume += order_ptr->LeavesQuantity;
+    level_ptr->HiddenVolume += order_ptr->HiddenQuantity();
+    level_ptr->VisibleVolume += order_ptr->VisibleQuantity();
+
+    // Link the new order to the orders list of the price level
+    level_ptr->OrderList.push_back(*order_ptr);
+    ++level_ptr->Orders;
+
+    // Cache the price level in the given order
+    order_ptr->Level = level_ptr;
+}
+
 } // namespace Matching
 } // namespace CppTrader
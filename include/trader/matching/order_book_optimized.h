@@ -0,0 +1,175 @@
+/*!
+    \file order_book_optimized.h
+    \brief Optimized order book definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_ORDER_BOOK_OPTIMIZED_H
+#define CPPTRADER_MATCHING_ORDER_BOOK_OPTIMIZED_H
+
+#include "level_pool.h"
+#include "symbol.h"
+
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+class MarketManagerOptimized;
+
+//! Optimized order
+/*!
+    Market data order which keeps only fields required to maintain price
+    levels. Quantity is the order leaves quantity.
+*/
+struct OrderOptimized
+{
+    //! Order Id
+    uint64_t Id;
+    //! Order price
+    uint64_t Price;
+    //! Order quantity
+    uint64_t Quantity;
+    //! Price level index in the level pool
+    size_t Level;
+    //! Symbol Id
+    uint32_t SymbolId;
+    //! Order side
+    OrderSide Side;
+
+    OrderOptimized() noexcept;
+    OrderOptimized(uint64_t id, uint32_t symbol, OrderSide side, uint64_t price, uint64_t quantity) noexcept;
+    OrderOptimized(const OrderOptimized&) noexcept = default;
+    OrderOptimized(OrderOptimized&&) noexcept = default;
+    ~OrderOptimized() noexcept = default;
+
+    OrderOptimized& operator=(const OrderOptimized&) noexcept = default;
+    OrderOptimized& operator=(OrderOptimized&&) noexcept = default;
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const OrderOptimized& order);
+
+    //! Is the buy order?
+    bool IsBuy() const noexcept { return Side == OrderSide::BUY; }
+    //! Is the sell order?
+    bool IsSell() const noexcept { return Side == OrderSide::SELL; }
+};
+
+//! Price level reference
+struct PriceLevel
+{
+    //! Price level price
+    uint64_t Price;
+    //! Price level index in the level pool
+    size_t Level;
+};
+
+//! Optimized order book
+/*!
+    Market data order book which keeps only aggregated price levels without
+    orders lists, stop orders and matching support.
+
+    Price levels are taken from the shared level pool and referenced from two
+    sorted arrays. The sort order keeps the best prices (best bid / best ask)
+    at the end of arrays and all searches are performed from the end, which
+    gives good CPU cache locality and near O(1) search time for orders close
+    to the market prices, but has a penalty for orders far from the market!
+
+    Not thread-safe.
+*/
+class OrderBookOptimized
+{
+    friend class MarketManagerOptimized;
+
+public:
+    //! Price level container
+    typedef std::vector<PriceLevel> Levels;
+
+    OrderBookOptimized(LevelPool& levels, const Symbol& symbol);
+    OrderBookOptimized(const OrderBookOptimized&) = delete;
+    OrderBookOptimized(OrderBookOptimized&&) = delete;
+    ~OrderBookOptimized();
+
+    OrderBookOptimized& operator=(const OrderBookOptimized&) = delete;
+    OrderBookOptimized& operator=(OrderBookOptimized&&) = delete;
+
+    //! Check if the order book is not empty
+    explicit operator bool() const noexcept { return !empty(); }
+
+    //! Is the order book empty?
+    bool empty() const noexcept { return size() == 0; }
+
+    //! Get the order book size
+    size_t size() const noexcept { return bids_size() + asks_size(); }
+    //! Get the order book bid price levels count
+    size_t bids_size() const noexcept { return _bids.size(); }
+    //! Get the order book ask price levels count
+    size_t asks_size() const noexcept { return _asks.size(); }
+
+    //! Get the order book symbol
+    const Symbol& symbol() const noexcept { return _symbol; }
+
+    //! Get the order book best bid price level
+    const Level* best_bid() const noexcept { return _bids.empty() ? nullptr : &_levels[_bids.back().Level]; }
+    //! Get the order book best ask price level
+    const Level* best_ask() const noexcept { return _asks.empty() ? nullptr : &_levels[_asks.back().Level]; }
+
+    //! Get the order book bids container
+    /*!
+        Bids are sorted in ascending price order, so the best bid is the last one.
+    */
+    const Levels& bids() const noexcept { return _bids; }
+    //! Get the order book asks container
+    /*!
+        Asks are sorted in descending price order, so the best ask is the last one.
+    */
+    const Levels& asks() const noexcept { return _asks; }
+
+    template <class TOutputStream>
+    friend TOutputStream& operator<<(TOutputStream& stream, const OrderBookOptimized& order_book);
+
+    //! Get the price level referenced from the bids or asks container
+    const Level& GetLevel(const PriceLevel& price_level) const noexcept { return _levels[price_level.Level]; }
+
+    //! Get the order book bid price level with the given price
+    /*!
+        \param price - Price
+        \return Pointer to the order book bid price level with the given price or nullptr
+    */
+    const Level* GetBid(uint64_t price) const noexcept;
+    //! Get the order book ask price level with the given price
+    /*!
+        \param price - Price
+        \return Pointer to the order book ask price level with the given price or nullptr
+    */
+    const Level* GetAsk(uint64_t price) const noexcept;
+
+private:
+    // Price level pool
+    LevelPool& _levels;
+
+    // Order book symbol
+    Symbol _symbol;
+
+    // Bid/Ask price levels
+    Levels _bids;
+    Levels _asks;
+
+    size_t FindLevel(const OrderOptimized* order_ptr, UpdateType& update);
+    void DeleteLevel(const OrderOptimized* order_ptr);
+
+    bool IsTop(const OrderOptimized* order_ptr) const noexcept;
+
+    LevelUpdate AddOrder(OrderOptimized* order_ptr);
+    LevelUpdate ReduceOrder(OrderOptimized* order_ptr, uint64_t quantity);
+    LevelUpdate DeleteOrder(OrderOptimized* order_ptr);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "order_book_optimized.inl"
+
+#endif // CPPTRADER_MATCHING_ORDER_BOOK_OPTIMIZED_H
@@ -0,0 +1,85 @@
+/*!
+    \file order_book_optimized.inl
+    \brief Optimized order book inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline OrderOptimized::OrderOptimized() noexcept
+    : Id(0),
+      Price(0),
+      Quantity(0),
+      Level(0),
+      SymbolId(0),
+      Side(OrderSide::BUY)
+{
+}
+
+inline OrderOptimized::OrderOptimized(uint64_t id, uint32_t symbol, OrderSide side, uint64_t price, uint64_t quantity) noexcept
+    : Id(id),
+      Price(price),
+      Quantity(quantity),
+      Level(0),
+      SymbolId(symbol),
+      Side(side)
+{
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const OrderOptimized& order)
+{
+    stream << "OrderOptimized(Id=" << order.Id
+        << "; SymbolId=" << order.SymbolId
+        << "; Side=" << order.Side
+        << "; Price=" << order.Price
+        << "; Quantity=" << order.Quantity
+        << ")";
+    return stream;
+}
+
+template <class TOutputStream>
+inline TOutputStream& operator<<(TOutputStream& stream, const OrderBookOptimized& order_book)
+{
+    stream << "OrderBookOptimized(Symbol=" << order_book._symbol
+        << "; Bids=" << order_book.bids_size()
+        << "; Asks=" << order_book.asks_size()
+        << ")";
+    return stream;
+}
+
+inline const Level* OrderBookOptimized::GetBid(uint64_t price) const noexcept
+{
+    for (auto it = _bids.rbegin(); it != _bids.rend(); ++it)
+    {
+        if (it->Price == price)
+            return &_levels[it->Level];
+        if (it->Price < price)
+            break;
+    }
+    return nullptr;
+}
+
+inline const Level* OrderBookOptimized::GetAsk(uint64_t price) const noexcept
+{
+    for (auto it = _asks.rbegin(); it != _asks.rend(); ++it)
+    {
+        if (it->Price == price)
+            return &_levels[it->Level];
+        if (it->Price > price)
+            break;
+    }
+    return nullptr;
+}
+
+inline bool OrderBookOptimized::IsTop(const OrderOptimized* order_ptr) const noexcept
+{
+    const Levels& levels = order_ptr->IsBuy() ? _bids : _asks;
+    return (!levels.empty() && (levels.back().Level == order_ptr->Level));
+}
+
+} // namespace Matching
+} // namespace CppTrader
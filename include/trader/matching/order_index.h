@@ -0,0 +1,215 @@
+/*!
+    \file order_index.h
+    \brief Order index definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_ORDER_INDEX_H
+#define CPPTRADER_MATCHING_ORDER_INDEX_H
+
+#include "fast_hash.h"
+#include "order.h"
+
+#include "containers/hashmap.h"
+
+#include <cassert>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+namespace CppTrader {
+namespace Matching {
+
+//! Order index
+/*!
+    Order index maps order Ids to orders. Order Ids below the direct index limit
+    are stored in a paged table directly indexed by order Id, so finding,
+    inserting and erasing such orders is a simple index math without hashing
+    and probing. Pages are allocated on the first order and released when the
+    last order of the page is erased, so the table memory follows the live range
+    of dense and increasing order Ids like exchange order reference numbers.
+    Pages for the reserved orders capacity are pre-allocated and recycled, so
+    inserting orders does not allocate pages on the hot path (see Reserve()
+    method). Order Ids above the limit are kept in the overflow hash map.
+
+    Direct index is disabled by default, so all orders are kept in the hash map.
+
+    Not thread-safe.
+*/
+class OrderIndex
+{
+    struct Page;
+
+public:
+    //! Overflow orders container
+    typedef CppCommon::HashMap<uint64_t, OrderNode*, FastHash> Overflow;
+
+    //! Page size in orders
+    static const size_t PAGE_SIZE = 4096;
+
+    class const_iterator;
+
+    OrderIndex();
+    OrderIndex(const OrderIndex&) = delete;
+    OrderIndex(OrderIndex&&) = delete;
+    ~OrderIndex() = default;
+
+    OrderIndex& operator=(const OrderIndex&) = delete;
+    OrderIndex& operator=(OrderIndex&&) = delete;
+
+    //! Is the direct index enabled?
+    bool enabled() const noexcept { return _limit > 0; }
+    //! Is the order index empty?
+    bool empty() const noexcept { return size() == 0; }
+
+    //! Get the order index size
+    size_t size() const noexcept { return _size + _overflow.size(); }
+    //! Get the direct index limit
+    uint64_t limit() const noexcept { return _limit; }
+    //! Get the count of allocated direct index pages
+    size_t pages() const noexcept { return _pages; }
+    //! Get the count of pre-allocated spare direct index pages
+    size_t spare_pages() const noexcept { return _spares.size(); }
+    //! Get the overflow orders container
+    const Overflow& overflow() const noexcept { return _overflow; }
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+    //! Find the order with the given Id
+    /*!
+        \param id - Order Id
+        \return Pointer to the order with the given Id or nullptr
+    */
+    OrderNode* Find(uint64_t id) const noexcept;
+    //! Prefetch the order index slot of the given Id
+    /*!
+        Only the direct index page slot address is calculated and prefetched
+        without loading the slot itself. Overflow hash map orders are not
+        prefetched.
+
+        \param id - Order Id
+    */
+    void Prefetch(uint64_t id) const noexcept;
+
+    //! Insert the order into the order index
+    /*!
+        \param order_ptr - Order to insert
+        \return 'true' if the order was successfully inserted, 'false' if the order with the same Id already exists
+    */
+    bool Insert(OrderNode* order_ptr);
+    //! Erase the order with the given Id from the order index
+    /*!
+        \param id - Order Id
+        \return 'true' if the order was successfully erased, 'false' if the order was not found
+    */
+    bool Erase(uint64_t id);
+    //! Clear the order index
+    void Clear();
+
+    //! Reserve the order index capacity
+    /*!
+        Reserve the overflow hash map for the given count of orders. Direct index
+        pages for the given count of orders (but not more than the direct index
+        limit) are pre-allocated as spare pages, so they are taken on inserts
+        without allocations and kept on erases instead of being released.
+
+        \param capacity - Orders capacity
+    */
+    void Reserve(size_t capacity);
+
+    //! Set the direct index limit
+    /*!
+        Orders already stored in the order index are moved between the direct
+        index and the overflow hash map according to the new limit.
+
+        \param limit - Direct index limit (zero limit disables the direct index)
+    */
+    void SetLimit(uint64_t limit);
+
+private:
+    struct Page
+    {
+        size_t Count;
+        OrderNode* Orders[PAGE_SIZE];
+    };
+
+    uint64_t _limit;
+    size_t _size;
+    size_t _pages;
+    size_t _capacity;
+    std::vector<std::unique_ptr<Page>> _directory;
+    std::vector<std::unique_ptr<Page>> _spares;
+    Overflow _overflow;
+
+    // Direct index math
+    static size_t PageIndex(uint64_t id) noexcept { return (size_t)(id / PAGE_SIZE); }
+    static size_t SlotIndex(uint64_t id) noexcept { return (size_t)(id % PAGE_SIZE); }
+
+    // Pages management
+    size_t ReservedPages() const noexcept;
+    void ReservePages();
+    Page* AllocatePage();
+    void ReleasePage(size_t index);
+};
+
+//! Order index constant iterator
+/*!
+    Iterates orders in the direct index in order Id order and then orders in
+    the overflow hash map. Each item is a pair of the order Id and the order.
+*/
+class OrderIndex::const_iterator
+{
+    friend class OrderIndex;
+
+public:
+    // Standard iterator type definitions
+    typedef std::pair<uint64_t, OrderNode*> value_type;
+    typedef const value_type& reference;
+    typedef const value_type* pointer;
+    typedef ptrdiff_t difference_type;
+    typedef std::forward_iterator_tag iterator_category;
+
+    const_iterator() noexcept : _index(nullptr), _position(0) {}
+    const_iterator(const const_iterator&) noexcept = default;
+    const_iterator(const_iterator&&) noexcept = default;
+    ~const_iterator() noexcept = default;
+
+    const_iterator& operator=(const const_iterator&) noexcept = default;
+    const_iterator& operator=(const_iterator&&) noexcept = default;
+
+    friend bool operator==(const const_iterator& it1, const const_iterator& it2) noexcept
+    { return (it1._index == it2._index) && (it1._position == it2._position) && (it1._it == it2._it); }
+    friend bool operator!=(const const_iterator& it1, const const_iterator& it2) noexcept
+    { return !(it1 == it2); }
+
+    const_iterator& operator++() noexcept;
+    const_iterator operator++(int) noexcept;
+
+    reference operator*() const noexcept { return _value; }
+    pointer operator->() const noexcept { return &_value; }
+
+private:
+    const OrderIndex* _index;
+    uint64_t _position;
+    Overflow::const_iterator _it;
+    value_type _value;
+
+    const_iterator(const OrderIndex* index, uint64_t position, Overflow::const_iterator it) noexcept;
+
+    void Next() noexcept;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "order_index.inl"
+
+#endif // CPPTRADER_MATCHING_ORDER_INDEX_H
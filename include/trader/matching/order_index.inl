@@ -0,0 +1,167 @@
+/*!
+    \file order_index.inl
+    \brief Order index inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline OrderIndex::const_iterator OrderIndex::begin() const noexcept
+{
+    return const_iterator(this, 0, _overflow.begin());
+}
+
+inline OrderIndex::const_iterator OrderIndex::end() const noexcept
+{
+    return const_iterator(this, _directory.size() * PAGE_SIZE, _overflow.end());
+}
+
+inline OrderNode* OrderIndex::Find(uint64_t id) const noexcept
+{
+    if (id < _limit)
+    {
+        size_t index = PageIndex(id);
+        if (index >= _directory.size())
+            return nullptr;
+        const Page* page_ptr = _directory[index].get();
+        return (page_ptr != nullptr) ? page_ptr->Orders[SlotIndex(id)] : nullptr;
+    }
+
+    auto it = _overflow.find(id);
+    return (it != _overflow.end()) ? it->second : nullptr;
+}
+
+inline void OrderIndex::Prefetch(uint64_t id) const noexcept
+{
+    if (id >= _limit)
+        return;
+
+    size_t index = PageIndex(id);
+    if (index >= _directory.size())
+        return;
+    const Page* page_ptr = _directory[index].get();
+    if (page_ptr == nullptr)
+        return;
+
+#if defined(_MSC_VER)
+    _mm_prefetch((const char*)&page_ptr->Orders[SlotIndex(id)], _MM_HINT_T0);
+#else
+    __builtin_prefetch(&page_ptr->Orders[SlotIndex(id)]);
+#endif
+}
+
+inline bool OrderIndex::Insert(OrderNode* order_ptr)
+{
+    uint64_t id = order_ptr->Id;
+    if (id < _limit)
+    {
+        size_t index = PageIndex(id);
+        if (index >= _directory.size())
+            _directory.resize(index + 1);
+
+        Page* page_ptr = _directory[index].get();
+        if (page_ptr == nullptr)
+        {
+            page_ptr = AllocatePage();
+            _directory[index].reset(page_ptr);
+        }
+
+        OrderNode*& slot = page_ptr->Orders[SlotIndex(id)];
+        if (slot != nullptr)
+            return false;
+
+        slot = order_ptr;
+        ++page_ptr->Count;
+        ++_size;
+        return true;
+    }
+
+    return _overflow.insert(std::make_pair(id, order_ptr)).second;
+}
+
+inline bool OrderIndex::Erase(uint64_t id)
+{
+    if (id < _limit)
+    {
+        size_t index = PageIndex(id);
+        if (index >= _directory.size())
+            return false;
+
+        Page* page_ptr = _directory[index].get();
+        if (page_ptr == nullptr)
+            return false;
+
+        OrderNode*& slot = page_ptr->Orders[SlotIndex(id)];
+        if (slot == nullptr)
+            return false;
+
+        slot = nullptr;
+        --_size;
+
+        // Release the empty page
+        if (--page_ptr->Count == 0)
+            ReleasePage(index);
+
+        return true;
+    }
+
+    return _overflow.erase(id) > 0;
+}
+
+inline OrderIndex::const_iterator::const_iterator(const OrderIndex* index, uint64_t position, Overflow::const_iterator it) noexcept
+    : _index(index), _position(position), _it(it), _value(0, nullptr)
+{
+    Next();
+}
+
+inline OrderIndex::const_iterator& OrderIndex::const_iterator::operator++() noexcept
+{
+    if (_position < (_index->_directory.size() * PAGE_SIZE))
+        ++_position;
+    else
+        ++_it;
+    Next();
+    return *this;
+}
+
+inline OrderIndex::const_iterator OrderIndex::const_iterator::operator++(int) noexcept
+{
+    const_iterator result(*this);
+    operator++();
+    return result;
+}
+
+inline void OrderIndex::const_iterator::Next() noexcept
+{
+    // Find the next order in the direct index
+    uint64_t end = _index->_directory.size() * PAGE_SIZE;
+    while (_position < end)
+    {
+        const Page* page_ptr = _index->_directory[PageIndex(_position)].get();
+        if (page_ptr == nullptr)
+        {
+            // Skip the whole empty page
+            _position = (PageIndex(_position) + 1) * PAGE_SIZE;
+            continue;
+        }
+
+        OrderNode* order_ptr = page_ptr->Orders[SlotIndex(_position)];
+        if (order_ptr != nullptr)
+        {
+            _value = std::make_pair(_position, order_ptr);
+            return;
+        }
+
+        ++_position;
+    }
+
+    // Take the next order from the overflow hash map
+    if (_it != _index->_overflow.end())
+        _value = std::make_pair(_it->first, _it->second);
+}
+
+} // namespace Matching
+} // namespace CppTrader
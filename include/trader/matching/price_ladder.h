@@ -0,0 +1,157 @@
+/*!
+    \file price_ladder.h
+    \brief Price ladder definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_PRICE_LADDER_H
+#define CPPTRADER_MATCHING_PRICE_LADDER_H
+
+#include "level.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace CppTrader {
+namespace Matching {
+
+//! Price ladder
+/*!
+    Price ladder is a flat tick-indexed container of price levels. It covers a window
+    of consecutive ticks stored in a power of two ring, so finding, inserting and erasing
+    a price level inside the window is a simple index math. Occupied ticks are tracked
+    in a two level bitmap: each bit of the summary bitmap marks a non-empty 64-bit word
+    of the occupancy bitmap. So the nearest non-empty price level is found with a couple
+    of bit scans no matter how sparse the window is.
+
+    Prices outside the window or not aligned to the tick size are not handled by the
+    ladder and should be kept by the owner in an overflow price levels container. The
+    window could be moved with Rebase() method which exchanges price levels with the
+    overflow container.
+
+    Not thread-safe.
+*/
+class PriceLadder
+{
+public:
+    //! Overflow price levels container
+    typedef CppCommon::BinTreeAVL<LevelNode, std::less<LevelNode>> Levels;
+
+    //! Initialize the price ladder
+    /*!
+        Price ladder with zero tick size or zero capacity is disabled and does not
+        accept any price.
+
+        \param tick_size - Tick size
+        \param capacity - Window capacity in ticks (will be rounded up to the power of two, minimum 64)
+    */
+    PriceLadder(uint64_t tick_size, size_t capacity);
+    PriceLadder(const PriceLadder&) = delete;
+    PriceLadder(PriceLadder&&) = delete;
+    ~PriceLadder() = default;
+
+    PriceLadder& operator=(const PriceLadder&) = delete;
+    PriceLadder& operator=(PriceLadder&&) = delete;
+
+    //! Is the price ladder enabled?
+    bool enabled() const noexcept { return _capacity > 0; }
+    //! Is the price ladder empty?
+    bool empty() const noexcept { return _size == 0; }
+
+    //! Get the price ladder size
+    size_t size() const noexcept { return _size; }
+    //! Get the price ladder tick size
+    uint64_t tick_size() const noexcept { return _tick_size; }
+    //! Get the price ladder window capacity in ticks
+    size_t capacity() const noexcept { return _capacity; }
+
+    //! Is the given price aligned to the tick size?
+    bool IsAligned(uint64_t price) const noexcept;
+    //! Is the given price inside the price ladder window?
+    bool IsInWindow(uint64_t price) const noexcept;
+
+    //! Find the price level with the given price
+    /*!
+        \param price - Price inside the price ladder window
+        \return Pointer to the price level with the given price or nullptr
+    */
+    LevelNode* Find(uint64_t price) const noexcept;
+
+    //! Insert the price level into the price ladder
+    /*!
+        \param level_ptr - Price level with the price inside the price ladder window
+    */
+    void Insert(LevelNode* level_ptr);
+    //! Erase the price level from the price ladder
+    /*!
+        \param level_ptr - Price level stored in the price ladder
+    */
+    void Erase(LevelNode* level_ptr) noexcept;
+
+    //! Get the lowest price level
+    LevelNode* Lowest() const noexcept;
+    //! Get the highest price level
+    LevelNode* Highest() const noexcept;
+    //! Get the nearest price level with a higher price than the given one
+    LevelNode* Higher(uint64_t price) const noexcept;
+    //! Get the nearest price level with a lower price than the given one
+    LevelNode* Lower(uint64_t price) const noexcept;
+
+    //! Get the nearest price level with a higher price from the price ladder or the overflow container
+    LevelNode* Higher(const Levels& overflow, uint64_t price) const noexcept;
+    //! Get the nearest price level with a lower price from the price ladder or the overflow container
+    LevelNode* Lower(const Levels& overflow, uint64_t price) const noexcept;
+
+    //! Move the price ladder window to be centered at the given price
+    /*!
+        Price levels leaving the window are moved into the overflow container and
+        aligned overflow price levels entering the window are moved into the ladder.
+
+        \param price - New window center price
+        \param overflow - Overflow price levels container
+    */
+    void Rebase(uint64_t price, Levels& overflow);
+
+private:
+    static const size_t npos = std::numeric_limits<size_t>::max();
+
+    uint64_t _tick_size;
+    size_t _capacity;
+    size_t _mask;
+    size_t _size;
+    uint64_t _base;
+    std::vector<LevelNode*> _slots;
+    std::vector<uint64_t> _bitmap;
+    std::vector<uint64_t> _summary;
+
+    // Slots management
+    void Allocate();
+    size_t Index(uint64_t tick) const noexcept { return (size_t)(tick & _mask); }
+
+    // Bitmap search in the given range of summary words, slots or window offsets
+    size_t FindFirstWord(size_t from, size_t to) const noexcept;
+    size_t FindLastWord(size_t from, size_t to) const noexcept;
+    size_t FindFirstSlot(size_t from, size_t to) const noexcept;
+    size_t FindLastSlot(size_t from, size_t to) const noexcept;
+    LevelNode* FindFirst(size_t from, size_t to) const noexcept;
+    LevelNode* FindLast(size_t from, size_t to) const noexcept;
+
+    // Bit scan utilities
+    static size_t LowestBit(uint64_t value) noexcept;
+    static size_t HighestBit(uint64_t value) noexcept;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "price_ladder.inl"
+
+#endif // CPPTRADER_MATCHING_PRICE_LADDER_H
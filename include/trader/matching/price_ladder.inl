@@ -0,0 +1,283 @@
+/*!
+    \file price_ladder.inl
+    \brief Price ladder inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline bool PriceLadder::IsAligned(uint64_t price) const noexcept
+{
+    return (_tick_size > 0) && ((price % _tick_size) == 0);
+}
+
+inline bool PriceLadder::IsInWindow(uint64_t price) const noexcept
+{
+    if (_capacity == 0)
+        return false;
+
+    uint64_t tick = price / _tick_size;
+    return ((tick * _tick_size) == price) && ((tick - _base) < _capacity);
+}
+
+inline LevelNode* PriceLadder::Find(uint64_t price) const noexcept
+{
+    assert(IsInWindow(price) && "Price is out of the price ladder window!");
+    return _slots.empty() ? nullptr : _slots[Index(price / _tick_size)];
+}
+
+inline void PriceLadder::Insert(LevelNode* level_ptr)
+{
+    assert(IsInWindow(level_ptr->Price) && "Price is out of the price ladder window!");
+
+    // Allocate slots on the first insert
+    if (_slots.empty())
+        Allocate();
+
+    size_t index = Index(level_ptr->Price / _tick_size);
+    assert((_slots[index] == nullptr) && "Price level duplicate!");
+
+    _slots[index] = level_ptr;
+    _bitmap[index >> 6] |= (uint64_t)1 << (index & 63);
+    _summary[index >> 12] |= (uint64_t)1 << ((index >> 6) & 63);
+    ++_size;
+}
+
+inline void PriceLadder::Erase(LevelNode* level_ptr) noexcept
+{
+    size_t index = Index(level_ptr->Price / _tick_size);
+    assert((_slots[index] == level_ptr) && "Price level not found!");
+
+    _slots[index] = nullptr;
+    _bitmap[index >> 6] &= ~((uint64_t)1 << (index & 63));
+    if (_bitmap[index >> 6] == 0)
+        _summary[index >> 12] &= ~((uint64_t)1 << ((index >> 6) & 63));
+    --_size;
+}
+
+inline LevelNode* PriceLadder::Lowest() const noexcept
+{
+    return FindFirst(0, _capacity);
+}
+
+inline LevelNode* PriceLadder::Highest() const noexcept
+{
+    return FindLast(0, _capacity);
+}
+
+inline LevelNode* PriceLadder::Higher(uint64_t price) const noexcept
+{
+    if (_size == 0)
+        return nullptr;
+
+    // Higher price levels start from the next tick
+    uint64_t tick = price / _tick_size;
+    if (tick >= (_base + _capacity - 1))
+        return nullptr;
+
+    return FindFirst((tick >= _base) ? (size_t)(tick + 1 - _base) : 0, _capacity);
+}
+
+inline LevelNode* PriceLadder::Lower(uint64_t price) const noexcept
+{
+    if (_size == 0)
+        return nullptr;
+
+    // Lower price levels end at the price tick (exclusive) or include it for unaligned price
+    uint64_t tick = price / _tick_size;
+    uint64_t bound = ((tick * _tick_size) == price) ? tick : (tick + 1);
+    if (bound <= _base)
+        return nullptr;
+
+    return FindLast(0, (size_t)std::min<uint64_t>(bound - _base, _capacity));
+}
+
+inline LevelNode* PriceLadder::Higher(const Levels& overflow, uint64_t price) const noexcept
+{
+    LevelNode* result = Higher(price);
+
+    if (!overflow.empty())
+    {
+        auto it = overflow.upper_bound(LevelNode(LevelType::BID, price));
+        if ((it != overflow.end()) && ((result == nullptr) || (it->Price < result->Price)))
+            result = (LevelNode*)it.operator->();
+    }
+
+    return result;
+}
+
+inline LevelNode* PriceLadder::Lower(const Levels& overflow, uint64_t price) const noexcept
+{
+    LevelNode* result = Lower(price);
+
+    if (!overflow.empty())
+    {
+        const LevelNode* candidate = nullptr;
+        auto it = overflow.lower_bound(LevelNode(LevelType::BID, price));
+        if (it != overflow.end())
+        {
+            Levels::const_reverse_iterator prev(&overflow, it.operator->());
+            ++prev;
+            candidate = prev.operator->();
+        }
+        else
+            candidate = overflow.highest();
+
+        if ((candidate != nullptr) && ((result == nullptr) || (candidate->Price > result->Price)))
+            result = (LevelNode*)candidate;
+    }
+
+    return result;
+}
+
+inline size_t PriceLadder::FindFirstWord(size_t from, size_t to) const noexcept
+{
+    size_t index = from;
+    while (index < to)
+    {
+        size_t word = index >> 6;
+        uint64_t bits = _summary[word] & (~(uint64_t)0 << (index & 63));
+        if (bits != 0)
+        {
+            size_t result = (word << 6) + LowestBit(bits);
+            return (result < to) ? result : npos;
+        }
+        index = (word + 1) << 6;
+    }
+    return npos;
+}
+
+inline size_t PriceLadder::FindLastWord(size_t from, size_t to) const noexcept
+{
+    if (from >= to)
+        return npos;
+
+    size_t index = to - 1;
+    for (;;)
+    {
+        size_t word = index >> 6;
+        uint64_t bits = _summary[word] & (~(uint64_t)0 >> (63 - (index & 63)));
+        if (bits != 0)
+        {
+            size_t result = (word << 6) + HighestBit(bits);
+            return (result >= from) ? result : npos;
+        }
+        if ((word << 6) <= from)
+            return npos;
+        index = (word << 6) - 1;
+    }
+}
+
+inline size_t PriceLadder::FindFirstSlot(size_t from, size_t to) const noexcept
+{
+    if (from >= to)
+        return npos;
+
+    // Check the rest of the first bitmap word
+    size_t word = from >> 6;
+    uint64_t bits = _bitmap[word] & (~(uint64_t)0 << (from & 63));
+
+    // Find the next non-empty bitmap word with the summary bitmap
+    if (bits == 0)
+    {
+        word = FindFirstWord(word + 1, ((to - 1) >> 6) + 1);
+        if (word == npos)
+            return npos;
+        bits = _bitmap[word];
+    }
+
+    size_t result = (word << 6) + LowestBit(bits);
+    return (result < to) ? result : npos;
+}
+
+inline size_t PriceLadder::FindLastSlot(size_t from, size_t to) const noexcept
+{
+    if (from >= to)
+        return npos;
+
+    // Check the rest of the last bitmap word
+    size_t word = (to - 1) >> 6;
+    uint64_t bits = _bitmap[word] & (~(uint64_t)0 >> (63 - ((to - 1) & 63)));
+
+    // Find the previous non-empty bitmap word with the summary bitmap
+    if (bits == 0)
+    {
+        word = FindLastWord(from >> 6, word);
+        if (word == npos)
+            return npos;
+        bits = _bitmap[word];
+    }
+
+    size_t result = (word << 6) + HighestBit(bits);
+    return (result >= from) ? result : npos;
+}
+
+inline LevelNode* PriceLadder::FindFirst(size_t from, size_t to) const noexcept
+{
+    if ((_size == 0) || (from >= to))
+        return nullptr;
+
+    // Window offsets are mapped to the ring slots with a possible wrap around
+    size_t start = Index(_base + from);
+    size_t finish = start + (to - from);
+    size_t slot;
+    if (finish <= _capacity)
+        slot = FindFirstSlot(start, finish);
+    else
+    {
+        slot = FindFirstSlot(start, _capacity);
+        if (slot == npos)
+            slot = FindFirstSlot(0, finish - _capacity);
+    }
+
+    return (slot != npos) ? _slots[slot] : nullptr;
+}
+
+inline LevelNode* PriceLadder::FindLast(size_t from, size_t to) const noexcept
+{
+    if ((_size == 0) || (from >= to))
+        return nullptr;
+
+    // Window offsets are mapped to the ring slots with a possible wrap around
+    size_t start = Index(_base + from);
+    size_t finish = start + (to - from);
+    size_t slot;
+    if (finish <= _capacity)
+        slot = FindLastSlot(start, finish);
+    else
+    {
+        slot = FindLastSlot(0, finish - _capacity);
+        if (slot == npos)
+            slot = FindLastSlot(start, _capacity);
+    }
+
+    return (slot != npos) ? _slots[slot] : nullptr;
+}
+
+inline size_t PriceLadder::LowestBit(uint64_t value) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (size_t)index;
+#else
+    return (size_t)__builtin_ctzll(value);
+#endif
+}
+
+inline size_t PriceLadder::HighestBit(uint64_t value) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (size_t)index;
+#else
+    return (size_t)(63 - __builtin_clzll(value));
+#endif
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,111 @@
+/*!
+    \file reserved_memory_manager.h
+    \brief Reserved memory manager definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_RESERVED_MEMORY_MANAGER_H
+#define CPPTRADER_MATCHING_RESERVED_MEMORY_MANAGER_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Reserved memory manager
+/*!
+    Reserved memory manager is an auxiliary memory manager of market manager
+    memory pools. Memory blocks are allocated sequentially from the reserved
+    memory region which is mapped and prefaulted once, so pools grow without
+    system allocator calls and page faults. Memory region could be backed by
+    huge pages to reduce TLB misses.
+
+    Blocks allocated from the reserved memory region are released together with
+    the region, because memory pools keep their released blocks for the reuse.
+    When the reserved memory region is exhausted or not reserved at all blocks
+    are allocated from the heap.
+
+    Not thread-safe.
+*/
+class ReservedMemoryManager
+{
+public:
+    ReservedMemoryManager() noexcept;
+    ReservedMemoryManager(const ReservedMemoryManager&) = delete;
+    ReservedMemoryManager(ReservedMemoryManager&&) = delete;
+    ~ReservedMemoryManager();
+
+    ReservedMemoryManager& operator=(const ReservedMemoryManager&) = delete;
+    ReservedMemoryManager& operator=(ReservedMemoryManager&&) = delete;
+
+    //! Allocated memory in bytes
+    size_t allocated() const noexcept { return _allocated; }
+    //! Count of active memory allocations
+    size_t allocations() const noexcept { return _allocations; }
+
+    //! Reserved memory region capacity in bytes
+    size_t capacity() const noexcept { return _capacity; }
+    //! Used bytes of the reserved memory region
+    size_t size() const noexcept { return _size; }
+    //! Is the reserved memory region backed by huge pages?
+    bool huge_pages() const noexcept { return _huge_pages; }
+
+    //! Maximum memory block size, that could be allocated by the memory manager
+    size_t max_size() const noexcept { return ~(size_t)0; }
+
+    //! Is the given memory block allocated from the reserved memory region?
+    bool owns(const void* ptr) const noexcept
+    { return (_buffer != nullptr) && ((const uint8_t*)ptr >= _buffer) && ((const uint8_t*)ptr < (_buffer + _capacity)); }
+
+    //! Allocate a new memory block of the given size
+    /*!
+        \param size - Block size
+        \param alignment - Block alignment (default is alignof(std::max_align_t))
+        \return A pointer to the allocated memory block or nullptr in case of allocation failed
+    */
+    void* malloc(size_t size, size_t alignment = alignof(std::max_align_t));
+    //! Free the previously allocated memory block
+    /*!
+        \param ptr - Pointer to the memory block
+        \param size - Block size
+    */
+    void free(void* ptr, size_t size);
+
+    //! Reserve the memory region
+    /*!
+        Memory region is mapped and all its pages are touched, so the following
+        allocations will not cause page faults. With huge pages flag the region is
+        mapped with explicit huge pages if the system has them available, otherwise
+        transparent huge pages are requested for the region.
+
+        Memory region could be reserved only once.
+
+        \param capacity - Memory region capacity in bytes
+        \param huge_pages - Huge pages flag (default is false)
+        \return 'true' if the memory region was successfully reserved, 'false' otherwise
+    */
+    bool Reserve(size_t capacity, bool huge_pages = false);
+
+    //! Reset the memory manager
+    void reset() noexcept {}
+
+private:
+    uint8_t* _buffer;
+    size_t _capacity;
+    size_t _size;
+    bool _huge_pages;
+    size_t _allocated;
+    size_t _allocations;
+
+    static void* MapRegion(size_t& capacity, bool huge_pages, bool& mapped_huge_pages);
+    static void UnmapRegion(void* buffer, size_t capacity);
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#endif // CPPTRADER_MATCHING_RESERVED_MEMORY_MANAGER_H
@@ -0,0 +1,125 @@
+/*!
+    \file snapshot.h
+    \brief Market snapshot definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_SNAPSHOT_H
+#define CPPTRADER_MATCHING_SNAPSHOT_H
+
+#include "order.h"
+#include "symbol.h"
+
+#include <cstdint>
+#include <type_traits>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Market snapshot header
+/*!
+    Market snapshot is a flat sequence of fixed size records aligned to 8 bytes:
+    \li Snapshot header
+    \li Symbol records
+    \li Order book records. Each order book record is followed by its price levels
+        in the SnapshotLevels order. Each price level record is followed by its
+        orders in the price level queue order.
+
+    Price levels of each container are stored from the best one. All records are
+    stored in the host byte order, so the snapshot could be restored directly from
+    a memory mapped file on the same platform.
+*/
+struct SnapshotHeader
+{
+    //! Snapshot signature
+    uint32_t Signature;
+    //! Snapshot format version
+    uint32_t Version;
+    //! Symbols count
+    uint64_t Symbols;
+    //! Order books count
+    uint64_t OrderBooks;
+    //! Price levels count
+    uint64_t Levels;
+    //! Orders count
+    uint64_t Orders;
+    //! Automatic matching flag
+    uint8_t Matching;
+    //! Reserved
+    uint8_t Reserved[7];
+
+    //! Snapshot signature ("CTMS")
+    static const uint32_t SIGNATURE = 0x534D5443;
+    //! Snapshot format version
+    static const uint32_t VERSION = 1;
+};
+
+//! Market snapshot symbol
+struct SnapshotSymbol
+{
+    //! Symbol
+    Symbol Value;
+    //! Reserved
+    uint32_t Reserved;
+
+    //! Maximal symbol Id (symbols are indexed by Id, so a corrupted Id must not allocate the huge index)
+    static const uint32_t MAX_ID = 0xFFFFFF;
+};
+
+//! Market snapshot price levels containers
+enum SnapshotLevels
+{
+    SNAPSHOT_BIDS,
+    SNAPSHOT_ASKS,
+    SNAPSHOT_BUY_STOP,
+    SNAPSHOT_SELL_STOP,
+    SNAPSHOT_TRAILING_BUY_STOP,
+    SNAPSHOT_TRAILING_SELL_STOP,
+    SNAPSHOT_LEVELS
+};
+
+//! Market snapshot order book
+struct SnapshotOrderBook
+{
+    //! Symbol Id
+    uint32_t SymbolId;
+    //! Reserved
+    uint32_t Reserved;
+    //! Last bid price
+    uint64_t LastBidPrice;
+    //! Last ask price
+    uint64_t LastAskPrice;
+    //! Matching bid price
+    uint64_t MatchingBidPrice;
+    //! Matching ask price
+    uint64_t MatchingAskPrice;
+    //! Trailing bid price
+    uint64_t TrailingBidPrice;
+    //! Trailing ask price
+    uint64_t TrailingAskPrice;
+    //! Price levels count of each container
+    uint64_t Levels[SNAPSHOT_LEVELS];
+};
+
+//! Market snapshot price level
+struct SnapshotLevel
+{
+    //! Level price
+    uint64_t Price;
+    //! Level orders count
+    uint64_t Orders;
+};
+
+static_assert(std::is_trivially_copyable<Order>::value, "Order must be trivially copyable to be stored in the market snapshot!");
+static_assert((sizeof(SnapshotHeader) % 8) == 0, "Market snapshot header must be aligned to 8 bytes!");
+static_assert((sizeof(SnapshotSymbol) % 8) == 0, "Market snapshot symbol must be aligned to 8 bytes!");
+static_assert((sizeof(SnapshotOrderBook) % 8) == 0, "Market snapshot order book must be aligned to 8 bytes!");
+static_assert((sizeof(SnapshotLevel) % 8) == 0, "Market snapshot price level must be aligned to 8 bytes!");
+static_assert((sizeof(Order) % 8) == 0, "Market snapshot order must be aligned to 8 bytes!");
+
+} // namespace Matching
+} // namespace CppTrader
+
+#endif // CPPTRADER_MATCHING_SNAPSHOT_H
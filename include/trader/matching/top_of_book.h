@@ -0,0 +1,106 @@
+/*!
+    \file top_of_book.h
+    \brief Top of the book publisher definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_TOP_OF_BOOK_H
+#define CPPTRADER_MATCHING_TOP_OF_BOOK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Top of the book
+struct TopOfBook
+{
+    //! Best bid price (0 if there are no bids)
+    uint64_t BidPrice;
+    //! Best bid price level volume
+    uint64_t BidVolume;
+    //! Best ask price (0 if there are no asks)
+    uint64_t AskPrice;
+    //! Best ask price level volume
+    uint64_t AskVolume;
+    //! Last trade price (0 if there were no trades)
+    uint64_t LastPrice;
+    //! Publication sequence number (incremented with each publication)
+    uint64_t Sequence;
+
+    TopOfBook() noexcept : BidPrice(0), BidVolume(0), AskPrice(0), AskVolume(0), LastPrice(0), Sequence(0) {}
+};
+
+//! Top of the book publisher
+/*!
+    Top of the book publisher is a seqlock which allows a single writer thread
+    to publish the top of the book and any count of reader threads to read it
+    without locks. The writer never waits for readers. Readers detect torn reads
+    by the sequence number which is odd while the publication is in progress and
+    changes with each publication.
+
+    Publisher occupies a separate cache line, so readers do not share it with
+    other order book fields modified by the writer thread.
+
+    Single writer, multiple readers thread-safe.
+*/
+class alignas(64) TopOfBookPublisher
+{
+public:
+    TopOfBookPublisher() noexcept;
+    TopOfBookPublisher(const TopOfBookPublisher&) = delete;
+    TopOfBookPublisher(TopOfBookPublisher&&) = delete;
+    ~TopOfBookPublisher() noexcept = default;
+
+    TopOfBookPublisher& operator=(const TopOfBookPublisher&) = delete;
+    TopOfBookPublisher& operator=(TopOfBookPublisher&&) = delete;
+
+    //! Get the last published sequence number
+    uint64_t sequence() const noexcept { return _sequence.load(std::memory_order_acquire) >> 1; }
+
+    //! Publish the top of the book (writer thread only)
+    /*!
+        \param bid_price - Best bid price
+        \param bid_volume - Best bid price level volume
+        \param ask_price - Best ask price
+        \param ask_volume - Best ask price level volume
+        \param last_price - Last trade price
+    */
+    void Publish(uint64_t bid_price, uint64_t bid_volume, uint64_t ask_price, uint64_t ask_volume, uint64_t last_price) noexcept;
+
+    //! Try to read the consistent top of the book
+    /*!
+        Wait-free single attempt to read the top of the book. It fails if the
+        writer thread publishes the top of the book at the same time.
+
+        \param top - Top of the book to fill
+        \return 'true' if the consistent top of the book was read, 'false' otherwise
+    */
+    bool TryRead(TopOfBook& top) const noexcept;
+    //! Read the consistent top of the book
+    /*!
+        Repeats read attempts until the consistent top of the book is read.
+
+        \return Top of the book
+    */
+    TopOfBook Read() const noexcept;
+
+private:
+    std::atomic<uint64_t> _sequence;
+    std::atomic<uint64_t> _bid_price;
+    std::atomic<uint64_t> _bid_volume;
+    std::atomic<uint64_t> _ask_price;
+    std::atomic<uint64_t> _ask_volume;
+    std::atomic<uint64_t> _last_price;
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "top_of_book.inl"
+
+#endif // CPPTRADER_MATCHING_TOP_OF_BOOK_H
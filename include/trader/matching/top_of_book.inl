@@ -0,0 +1,69 @@
+/*!
+    \file top_of_book.inl
+    \brief Top of the book publisher inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline TopOfBookPublisher::TopOfBookPublisher() noexcept
+    : _sequence(0),
+      _bid_price(0),
+      _bid_volume(0),
+      _ask_price(0),
+      _ask_volume(0),
+      _last_price(0)
+{
+}
+
+inline void TopOfBookPublisher::Publish(uint64_t bid_price, uint64_t bid_volume, uint64_t ask_price, uint64_t ask_volume, uint64_t last_price) noexcept
+{
+    // Only the writer thread modifies the sequence number
+    uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+
+    // Mark the publication in progress before any field is modified
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    _bid_price.store(bid_price, std::memory_order_relaxed);
+    _bid_volume.store(bid_volume, std::memory_order_relaxed);
+    _ask_price.store(ask_price, std::memory_order_relaxed);
+    _ask_volume.store(ask_volume, std::memory_order_relaxed);
+    _last_price.store(last_price, std::memory_order_relaxed);
+
+    // Complete the publication after all fields are modified
+    _sequence.store(sequence + 2, std::memory_order_release);
+}
+
+inline bool TopOfBookPublisher::TryRead(TopOfBook& top) const noexcept
+{
+    uint64_t sequence = _sequence.load(std::memory_order_acquire);
+    if ((sequence & 1) != 0)
+        return false;
+
+    top.BidPrice = _bid_price.load(std::memory_order_relaxed);
+    top.BidVolume = _bid_volume.load(std::memory_order_relaxed);
+    top.AskPrice = _ask_price.load(std::memory_order_relaxed);
+    top.AskVolume = _ask_volume.load(std::memory_order_relaxed);
+    top.LastPrice = _last_price.load(std::memory_order_relaxed);
+    top.Sequence = sequence >> 1;
+
+    // Fields must be read before the sequence number is checked again
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (_sequence.load(std::memory_order_relaxed) == sequence);
+}
+
+inline TopOfBook TopOfBookPublisher::Read() const noexcept
+{
+    TopOfBook top;
+    while (!TryRead(top))
+    {
+    }
+    return top;
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,99 @@
+/*!
+    \file volume_index.h
+    \brief Volume index definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_MATCHING_VOLUME_INDEX_H
+#define CPPTRADER_MATCHING_VOLUME_INDEX_H
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace CppTrader {
+namespace Matching {
+
+//! Volume index
+/*!
+    Volume index keeps volumes by price in a sparse 16-ary segment tree over the
+    whole 64-bit price range. Each node covers sixteen equal price sub-ranges and
+    keeps the total volume of each of them, so the total volume of all prices
+    below or above the given one is calculated with a single root-to-leaf walk
+    of 16 nodes regardless of the price levels count. Volume updates take the
+    same walk.
+
+    Nodes are created on demand for non-empty price ranges and reused when their
+    price ranges become empty.
+
+    Not thread-safe.
+*/
+class VolumeIndex
+{
+public:
+    VolumeIndex();
+    VolumeIndex(const VolumeIndex&) = delete;
+    VolumeIndex(VolumeIndex&&) = delete;
+    ~VolumeIndex() = default;
+
+    VolumeIndex& operator=(const VolumeIndex&) = delete;
+    VolumeIndex& operator=(VolumeIndex&&) = delete;
+
+    //! Is the volume index empty?
+    bool empty() const noexcept { return _total == 0; }
+
+    //! Get the total volume of all prices
+    uint64_t total() const noexcept { return _total; }
+
+    //! Add the volume at the given price
+    /*!
+        \param price - Price
+        \param volume - Volume to add
+    */
+    void Add(uint64_t price, uint64_t volume);
+    //! Subtract the volume at the given price
+    /*!
+        \param price - Price
+        \param volume - Volume to subtract (must not be greater than the volume at the given price)
+    */
+    void Subtract(uint64_t price, uint64_t volume) noexcept;
+
+    //! Get the total volume of prices lower or equal to the given one
+    uint64_t Below(uint64_t price) const noexcept;
+    //! Get the total volume of prices higher or equal to the given one
+    uint64_t Above(uint64_t price) const noexcept;
+
+    //! Clear the volume index
+    void Clear();
+
+private:
+    static const size_t BITS = 4;
+    static const size_t FANOUT = 1 << BITS;
+    static const size_t LEVELS = 64 / BITS;
+
+    // Node keeps volumes of its price sub-ranges and indexes of child nodes
+    // (zero for no child, because the root node is never a child)
+    struct Node
+    {
+        uint64_t Volumes[FANOUT];
+        uint32_t Children[FANOUT];
+    };
+
+    uint64_t _total;
+    std::vector<Node> _nodes;
+    std::vector<uint32_t> _free;
+
+    static size_t Slot(uint64_t price, size_t level) noexcept { return (size_t)((price >> (64 - BITS * (level + 1))) & (FANOUT - 1)); }
+
+    uint32_t CreateNode();
+};
+
+} // namespace Matching
+} // namespace CppTrader
+
+#include "volume_index.inl"
+
+#endif // CPPTRADER_MATCHING_VOLUME_INDEX_H
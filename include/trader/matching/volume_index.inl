@@ -0,0 +1,112 @@
+/*!
+    \file volume_index.inl
+    \brief Volume index inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace Matching {
+
+inline void VolumeIndex::Add(uint64_t price, uint64_t volume)
+{
+    if (volume == 0)
+        return;
+
+    _total += volume;
+
+    uint32_t node = 0;
+    for (size_t level = 0; level < LEVELS; ++level)
+    {
+        size_t slot = Slot(price, level);
+        _nodes[node].Volumes[slot] += volume;
+
+        // Leaf nodes keep price volumes without children
+        if (level == (LEVELS - 1))
+            break;
+
+        uint32_t child = _nodes[node].Children[slot];
+        if (child == 0)
+        {
+            // Node storage could be reallocated here
+            child = CreateNode();
+            _nodes[node].Children[slot] = child;
+        }
+        node = child;
+    }
+}
+
+inline void VolumeIndex::Subtract(uint64_t price, uint64_t volume) noexcept
+{
+    if (volume == 0)
+        return;
+
+    assert((volume <= _total) && "Volume index underflow!");
+    _total -= volume;
+
+    uint32_t node = 0;
+    for (size_t level = 0; level < LEVELS; ++level)
+    {
+        size_t slot = Slot(price, level);
+        assert((volume <= _nodes[node].Volumes[slot]) && "Volume index underflow!");
+        _nodes[node].Volumes[slot] -= volume;
+
+        // Leaf nodes keep price volumes without children
+        if (level == (LEVELS - 1))
+            break;
+
+        uint32_t child = _nodes[node].Children[slot];
+
+        // Release the emptied price range. Other price sub-ranges of its nodes
+        // are already empty and released, so only the rest of the path remains.
+        if (_nodes[node].Volumes[slot] == 0)
+        {
+            _nodes[node].Children[slot] = 0;
+            for (++level; level < LEVELS; ++level)
+            {
+                uint32_t next = (level < (LEVELS - 1)) ? _nodes[child].Children[Slot(price, level)] : 0;
+                _nodes[child] = Node();
+                _free.push_back(child);
+                child = next;
+            }
+            break;
+        }
+
+        node = child;
+    }
+}
+
+inline uint64_t VolumeIndex::Below(uint64_t price) const noexcept
+{
+    uint64_t result = 0;
+
+    uint32_t node = 0;
+    for (size_t level = 0; level < LEVELS; ++level)
+    {
+        size_t slot = Slot(price, level);
+        const Node& current = _nodes[node];
+
+        // Sum volumes of lower price sub-ranges
+        for (size_t i = 0; i < slot; ++i)
+            result += current.Volumes[i];
+
+        // Leaf nodes keep price volumes, so the given price is included
+        if (level == (LEVELS - 1))
+            return result + current.Volumes[slot];
+
+        node = current.Children[slot];
+        if (node == 0)
+            break;
+    }
+
+    return result;
+}
+
+inline uint64_t VolumeIndex::Above(uint64_t price) const noexcept
+{
+    return (price > 0) ? (_total - Below(price - 1)) : _total;
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -9,9 +9,12 @@
 #ifndef CPPTRADER_ITCH_HANDLER_H
 #define CPPTRADER_ITCH_HANDLER_H
 
+#include "itch_message_view.h"
+
 #include "utility/endian.h"
 #include "utility/iostream.h"
 
+#include <cassert>
 #include <vector>
 
 namespace CppTrader {
@@ -371,6 +374,91 @@ struct UnknownMessage
     friend TOutputStream& operator<<(TOutputStream& stream, const UnknownMessage& message);
 };
 
+//! NASDAQ ITCH message decoder
+/*!
+    ITCH message decoder is used to validate the size of the ITCH message and
+    decode all its fields.
+
+    Thread-safe.
+*/
+class ITCHDecoder
+{
+public:
+    ITCHDecoder() = delete;
+
+    //! Decode the ITCH message from the given buffer
+    /*!
+        \param buffer - Buffer with a single message
+        \param size - Message size
+        \param message - Message to decode
+        \return 'true' if the message was successfully decoded, 'false' if the message size is invalid
+    */
+    static bool Decode(const void* buffer, size_t size, SystemEventMessage& message);
+    static bool Decode(const void* buffer, size_t size, StockDirectoryMessage& message);
+    static bool Decode(const void* buffer, size_t size, StockTradingActionMessage& message);
+    static bool Decode(const void* buffer, size_t size, RegSHOMessage& message);
+    static bool Decode(const void* buffer, size_t size, MarketParticipantPositionMessage& message);
+    static bool Decode(const void* buffer, size_t size, MWCBDeclineMessage& message);
+    static bool Decode(const void* buffer, size_t size, MWCBStatusMessage& message);
+    static bool Decode(const void* buffer, size_t size, IPOQuotingMessage& message);
+    static bool Decode(const void* buffer, size_t size, AddOrderMessage& message);
+    static bool Decode(const void* buffer, size_t size, AddOrderMPIDMessage& message);
+    static bool Decode(const void* buffer, size_t size, OrderExecutedMessage& message);
+    static bool Decode(const void* buffer, size_t size, OrderExecutedWithPriceMessage& message);
+    static bool Decode(const void* buffer, size_t size, OrderCancelMessage& message);
+    static bool Decode(const void* buffer, size_t size, OrderDeleteMessage& message);
+    static bool Decode(const void* buffer, size_t size, OrderReplaceMessage& message);
+    static bool Decode(const void* buffer, size_t size, TradeMessage& message);
+    static bool Decode(const void* buffer, size_t size, CrossTradeMessage& message);
+    static bool Decode(const void* buffer, size_t size, BrokenTradeMessage& message);
+    static bool Decode(const void* buffer, size_t size, NOIIMessage& message);
+    static bool Decode(const void* buffer, size_t size, RPIIMessage& message);
+    static bool Decode(const void* buffer, size_t size, LULDAuctionCollarMessage& message);
+    static bool Decode(const void* buffer, size_t size, UnknownMessage& message);
+
+private:
+    template <size_t N>
+    static size_t ReadString(const void* buffer, char (&str)[N]);
+    static size_t ReadTimestamp(const void* buffer, uint64_t& value);
+};
+
+//! NASDAQ ITCH framer
+/*!
+    ITCH framer splits the stream of length prefixed ITCH messages into single
+    messages. Messages which are split between input buffers are collected in
+    the internal cache.
+
+    Not thread-safe.
+*/
+class ITCHFramer
+{
+public:
+    ITCHFramer() { Reset(); }
+    ITCHFramer(const ITCHFramer&) = delete;
+    ITCHFramer(ITCHFramer&&) = delete;
+    ~ITCHFramer() = default;
+
+    ITCHFramer& operator=(const ITCHFramer&) = delete;
+    ITCHFramer& operator=(ITCHFramer&&) = delete;
+
+    //! Split the given buffer into ITCH messages and process each of them
+    /*!
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \param processor - Message processor with the signature bool(void* message, size_t size)
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    template <class TProcessor>
+    bool Process(void* buffer, size_t size, TProcessor&& processor);
+
+    //! Reset ITCH framer
+    void Reset();
+
+private:
+    size_t _size;
+    std::vector<uint8_t> _cache;
+};
+
 //! NASDAQ ITCH handler class
 /*!
     NASDAQ ITCH handler is used to parse NASDAQ ITCH protocol and handle its
@@ -382,12 +470,18 @@ struct UnknownMessage
     NASDAQ ITCH protocol examples:
     https://emi.nasdaq.com/ITCH
 
+    Optionally (see EnableMessageViews() method) stock directory, order and
+    trade messages are not decoded, but passed to message view handlers as
+    views over the input buffer.
+
     Not thread-safe.
 */
 class ITCHHandler
 {
+    friend class ITCHParallelDecoder;
+
 public:
-    ITCHHandler() { Reset(); }
+    ITCHHandler() : _views(false) { Reset(); }
     ITCHHandler(const ITCHHandler&) = delete;
     ITCHHandler(ITCHHandler&&) = delete;
     virtual ~ITCHHandler() = default;
@@ -401,7 +495,7 @@ public:
         \param size - Buffer size
         \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
     */
-    bool Process(void* buffer, size_t size);
+    bool Process(void* buffer, size_t size) { return _framer.Process(buffer, size, [this](void* message, size_t message_size) { return ProcessMessage(message, message_size); }); }
     //! Process a single message from the given buffer in ITCH format and call corresponding handlers
     /*!
         \param buffer - Buffer to process
@@ -411,7 +505,22 @@ public:
     bool ProcessMessage(void* buffer, size_t size);
 
     //! Reset ITCH handler
-    void Reset();
+    void Reset() { _framer.Reset(); }
+
+    //! Is the message views mode enabled?
+    bool IsMessageViewsEnabled() const noexcept { return _views; }
+    //! Enable the message views mode
+    /*!
+        Stock directory, add order, order executed, order cancel, order delete,
+        order replace and trade messages are passed to onMessageView() handlers
+        as lightweight views over the input buffer instead of decoded messages.
+        Fields are read from the buffer only when the handler accesses them.
+        Default view handlers decode the message and call the corresponding
+        onMessage() handler.
+    */
+    void EnableMessageViews() noexcept { _views = true; }
+    //! Disable the message views mode
+    void DisableMessageViews() noexcept { _views = false; }
 
 protected:
     // Message handlers
@@ -438,36 +547,27 @@ protected:
     virtual bool onMessage(const LULDAuctionCollarMessage& message) { return true; }
     virtual bool onMessage(const UnknownMessage& message) { return true; }
 
+    // Message view handlers
+    virtual bool onMessageView(const StockDirectoryView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const AddOrderView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const AddOrderMPIDView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const OrderExecutedView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const OrderExecutedWithPriceView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const OrderCancelView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const OrderDeleteView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const OrderReplaceView& view) { return onMessage(view.Decode()); }
+    virtual bool onMessageView(const TradeView& view) { return onMessage(view.Decode()); }
+
 private:
-    size_t _size;
-    std::vector<uint8_t> _cache;
+    bool _views;
+    ITCHFramer _framer;
 
-    bool ProcessSystemEventMessage(void* buffer, size_t size);
-    bool ProcessStockDirectoryMessage(void* buffer, size_t size);
-    bool ProcessStockTradingActionMessage(void* buffer, size_t size);
-    bool ProcessRegSHOMessage(void* buffer, size_t size);
-    bool ProcessMarketParticipantPositionMessage(void* buffer, size_t size);
-    bool ProcessMWCBDeclineMessage(void* buffer, size_t size);
-    bool ProcessMWCBStatusMessage(void* buffer, size_t size);
-    bool ProcessIPOQuotingMessage(void* buffer, size_t size);
-    bool ProcessAddOrderMessage(void* buffer, size_t size);
-    bool ProcessAddOrderMPIDMessage(void* buffer, size_t size);
-    bool ProcessOrderExecutedMessage(void* buffer, size_t size);
-    bool ProcessOrderExecutedWithPriceMessage(void* buffer, size_t size);
-    bool ProcessOrderCancelMessage(void* buffer, size_t size);
-    bool ProcessOrderDeleteMessage(void* buffer, size_t size);
-    bool ProcessOrderReplaceMessage(void* buffer, size_t size);
-    bool ProcessTradeMessage(void* buffer, size_t size);
-    bool ProcessCrossTradeMessage(void* buffer, size_t size);
-    bool ProcessBrokenTradeMessage(void* buffer, size_t size);
-    bool ProcessNOIIMessage(void* buffer, size_t size);
-    bool ProcessRPIIMessage(void* buffer, size_t size);
-    bool ProcessLULDAuctionCollarMessage(void* buffer, size_t size);
-    bool ProcessUnknownMessage(void* buffer, size_t size);
+    bool ProcessMessageView(void* buffer, size_t size);
+    template <class TView>
+    bool ProcessView(void* buffer, size_t size);
 
-    template <size_t N>
-    size_t ReadString(const void* buffer, char (&str)[N]);
-    size_t ReadTimestamp(const void* buffer, uint64_t& value);
+    template <class TMessage>
+    bool DecodeMessage(void* buffer, size_t size);
 };
 
 /*! \example itch_handler.cpp NASDAQ ITCH handler example */
@@ -335,15 +335,122 @@ inline TOutputStream& operator<<(TOutputStream& stream, const UnknownMessage& me
     return stream;
 }
 
+template <class TProcessor>
+inline bool ITCHFramer::Process(void* buffer, size_t size, TProcessor&& processor)
+{
+    size_t index = 0;
+    uint8_t* data = (uint8_t*)buffer;
+
+    while (index < size)
+    {
+        if (_size == 0)
+        {
+            size_t remaining = size - index;
+
+            // Collect message size into the cache
+            if (((_cache.size() == 0) && (remaining < 3)) || (_cache.size() == 1))
+            {
+                _cache.push_back(data[index++]);
+                continue;
+            }
+
+            // Read a new message size
+            uint16_t message_size;
+            if (_cache.empty())
+            {
+                // Read the message size directly from the input buffer
+                index += CppCommon::Endian::ReadBigEndian(&data[index], message_size);
+            }
+            else
+            {
+                // Read the message size from the cache
+                CppCommon::Endian::ReadBigEndian(_cache.data(), message_size);
+
+                // Clear the cache
+                _cache.clear();
+            }
+            _size = message_size;
+        }
+
+        // Read a new message
+        if (_size > 0)
+        {
+            size_t remaining = size - index;
+
+            // Complete or place the message into the cache
+            if (!_cache.empty())
+            {
+                size_t tail = _size - _cache.size();
+                if (tail > remaining)
+                    tail = remaining;
+                _cache.insert(_cache.end(), &data[index], &data[index + tail]);
+                index += tail;
+                if (_cache.size() < _size)
+                    continue;
+            }
+            else if (_size > remaining)
+            {
+                _cache.reserve(_size);
+                _cache.insert(_cache.end(), &data[index], &data[index + remaining]);
+                index += remaining;
+                continue;
+            }
+
+            // Process the current message
+            if (_cache.empty())
+            {
+                // Process the current message size directly from the input buffer
+                if (!processor(&data[index], _size))
+                    return false;
+                index += _size;
+            }
+            else
+            {
+                // Process the current message size directly from the cache
+                if (!processor(_cache.data(), _size))
+                    return false;
+
+                // Clear the cache
+                _cache.clear();
+            }
+
+            // Process the next message
+            _size = 0;
+        }
+    }
+
+    return true;
+}
+
+template <class TMessage>
+inline bool ITCHHandler::DecodeMessage(void* buffer, size_t size)
+{
+    TMessage message;
+    if (!ITCHDecoder::Decode(buffer, size, message))
+        return false;
+
+    return onMessage(message);
+}
+
+template <class TView>
+inline bool ITCHHandler::ProcessView(void* buffer, size_t size)
+{
+    assert((size == TView::SIZE) && "Invalid size of the ITCH message view!");
+    if (size != TView::SIZE)
+        return false;
+
+    return onMessageView(TView(buffer));
+}
+
 template <size_t N>
-inline size_t ITCHHandler::ReadString(const void* buffer, char (&str)[N])
+inline size_t ITCHDecoder::ReadString(const void* buffer, char (&str)[N])
 {
     std::memcpy(str, buffer, N);
 
     return N;
 }
 
-inline size_t ITCHHandler::ReadTimestamp(const void* buffer, uint64_t& value)
+inline size_t ITCHDecoder::ReadTimestamp(const void* buffer, uint64_t& value)
 {
     if (CppCommon::Endian::IsBigEndian())
     {
@@ -0,0 +1,85 @@
+/*!
+    \file itch_handler_static.h
+    \brief NASDAQ ITCH static handler definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_HANDLER_STATIC_H
+#define CPPTRADER_ITCH_HANDLER_STATIC_H
+
+#include "itch_handler.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! NASDAQ ITCH static handler class
+/*!
+    NASDAQ ITCH static handler parses NASDAQ ITCH protocol and calls message
+    handlers of TDerived type (CRTP) directly without virtual calls.
+
+    Message types handled by TDerived are detected at compile time. TDerived
+    handles a message type if it has onMessage() handler for its message view
+    (e.g. onMessage(const AddOrderView&)) or for its decoded message (e.g.
+    onMessage(const AddOrderMessage&)). View handlers are preferred over
+    decoded message handlers. Messages of unhandled types are skipped by their
+    length without parsing, so handlers which are interested in a few message
+    types do not pay for others.
+
+    Handlers are public in order to be called by the static handler directly.
+
+    Not thread-safe.
+*/
+template <class TDerived>
+class BasicITCHHandler
+{
+public:
+    BasicITCHHandler() = default;
+    BasicITCHHandler(const BasicITCHHandler&) = delete;
+    BasicITCHHandler(BasicITCHHandler&&) = delete;
+
+    BasicITCHHandler& operator=(const BasicITCHHandler&) = delete;
+    BasicITCHHandler& operator=(BasicITCHHandler&&) = delete;
+
+    //! Is the given message or message view type handled by TDerived?
+    template <class TMessage>
+    static constexpr bool IsHandled() noexcept;
+
+    //! Process all messages from the given buffer in ITCH format and call corresponding handlers
+    /*!
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    bool Process(void* buffer, size_t size) { return _framer.Process(buffer, size, [this](void* message, size_t message_size) { return ProcessMessage(message, message_size); }); }
+    //! Process a single message from the given buffer in ITCH format and call corresponding handlers
+    /*!
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    bool ProcessMessage(void* buffer, size_t size);
+
+    //! Reset ITCH handler
+    void Reset() { _framer.Reset(); }
+
+protected:
+    ~BasicITCHHandler() = default;
+
+private:
+    ITCHFramer _framer;
+
+    template <class TMessage, class TView = void>
+    bool DecodeMessage(void* buffer, size_t size);
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#include "itch_handler_static.inl"
+
+#endif // CPPTRADER_ITCH_HANDLER_STATIC_H
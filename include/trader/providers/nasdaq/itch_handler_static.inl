@@ -0,0 +1,115 @@
+/*!
+    \file itch_handler_static.inl
+    \brief NASDAQ ITCH static handler inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace ITCH {
+
+namespace Internal {
+
+template <class THandler, class TMessage, class = void>
+struct IsITCHHandled : std::false_type {};
+
+template <class THandler, class TMessage>
+struct IsITCHHandled<THandler, TMessage, std::void_t<decltype(std::declval<THandler&>().onMessage(std::declval<const TMessage&>()))>> : std::true_type {};
+
+} // namespace Internal
+
+template <class TDerived>
+template <class TMessage>
+inline constexpr bool BasicITCHHandler<TDerived>::IsHandled() noexcept
+{
+    return Internal::IsITCHHandled<TDerived, TMessage>::value;
+}
+
+template <class TDerived>
+inline bool BasicITCHHandler<TDerived>::ProcessMessage(void* buffer, size_t size)
+{
+    // Message is empty
+    if (size == 0)
+        return false;
+
+    uint8_t* data = (uint8_t*)buffer;
+
+    switch (*data)
+    {
+        case 'S':
+            return DecodeMessage<SystemEventMessage>(data, size);
+        case 'R':
+            return DecodeMessage<StockDirectoryMessage, StockDirectoryView>(data, size);
+        case 'H':
+            return DecodeMessage<StockTradingActionMessage>(data, size);
+        case 'Y':
+            return DecodeMessage<RegSHOMessage>(data, size);
+        case 'L':
+            return DecodeMessage<MarketParticipantPositionMessage>(data, size);
+        case 'V':
+            return DecodeMessage<MWCBDeclineMessage>(data, size);
+        case 'W':
+            return DecodeMessage<MWCBStatusMessage>(data, size);
+        case 'K':
+            return DecodeMessage<IPOQuotingMessage>(data, size);
+        case 'A':
+            return DecodeMessage<AddOrderMessage, AddOrderView>(data, size);
+        case 'F':
+            return DecodeMessage<AddOrderMPIDMessage, AddOrderMPIDView>(data, size);
+        case 'E':
+            return DecodeMessage<OrderExecutedMessage, OrderExecutedView>(data, size);
+        case 'C':
+            return DecodeMessage<OrderExecutedWithPriceMessage, OrderExecutedWithPriceView>(data, size);
+        case 'X':
+            return DecodeMessage<OrderCancelMessage, OrderCancelView>(data, size);
+        case 'D':
+            return DecodeMessage<OrderDeleteMessage, OrderDeleteView>(data, size);
+        case 'U':
+            return DecodeMessage<OrderReplaceMessage, OrderReplaceView>(data, size);
+        case 'P':
+            return DecodeMessage<TradeMessage, TradeView>(data, size);
+        case 'Q':
+            return DecodeMessage<CrossTradeMessage>(data, size);
+        case 'B':
+            return DecodeMessage<BrokenTradeMessage>(data, size);
+        case 'I':
+            return DecodeMessage<NOIIMessage>(data, size);
+        case 'N':
+            return DecodeMessage<RPIIMessage>(data, size);
+        case 'J':
+            return DecodeMessage<LULDAuctionCollarMessage>(data, size);
+        default:
+            return DecodeMessage<UnknownMessage>(data, size);
+    }
+}
+
+template <class TDerived>
+template <class TMessage, class TView>
+inline bool BasicITCHHandler<TDerived>::DecodeMessage(void* buffer, size_t size)
+{
+    if constexpr (!std::is_void<TView>::value && IsHandled<TView>())
+    {
+        assert((size == TView::SIZE) && "Invalid size of the ITCH message view!");
+        if (size != TView::SIZE)
+            return false;
+
+        return static_cast<TDerived&>(*this).onMessage(TView(buffer));
+    }
+    else if constexpr (IsHandled<TMessage>())
+    {
+        TMessage message;
+        if (!ITCHDecoder::Decode(buffer, size, message))
+            return false;
+
+        return static_cast<TDerived&>(*this).onMessage(message);
+    }
+    else
+    {
+        // Skip the unhandled message without parsing
+        return true;
+    }
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -0,0 +1,87 @@
+/*!
+    \file itch_mapped_file.h
+    \brief NASDAQ ITCH memory-mapped file definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_MAPPED_FILE_H
+#define CPPTRADER_ITCH_MAPPED_FILE_H
+
+#include "filesystem/path.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! NASDAQ ITCH memory-mapped file
+/*!
+    ITCH memory-mapped file maps the whole ITCH file into the memory with the
+    sequential access hint, so the system reads ahead the file while it is
+    processed. Optionally the mapping is advised to be backed by transparent
+    huge pages to reduce TLB misses.
+
+    The whole file is passed to the ITCH handler as a single buffer, so ITCH
+    messages are processed directly from the mapping and are never copied into
+    the ITCH handler cache.
+
+    The mapping is private, so writes into the mapped file (if any) are not
+    visible to other processes and are never written back into the file.
+
+    Not thread-safe.
+*/
+class ITCHMappedFile
+{
+public:
+    ITCHMappedFile() noexcept;
+    ITCHMappedFile(const ITCHMappedFile&) = delete;
+    ITCHMappedFile(ITCHMappedFile&&) = delete;
+    ~ITCHMappedFile();
+
+    ITCHMappedFile& operator=(const ITCHMappedFile&) = delete;
+    ITCHMappedFile& operator=(ITCHMappedFile&&) = delete;
+
+    //! Is the file opened?
+    bool IsOpened() const noexcept { return _opened; }
+
+    //! Get the mapped file data
+    void* data() noexcept { return _data; }
+    const void* data() const noexcept { return _data; }
+    //! Get the mapped file size in bytes
+    size_t size() const noexcept { return _size; }
+
+    //! Open and map the given ITCH file
+    /*!
+        \param path - ITCH file path
+        \param huge_pages - Advise the mapping to be backed by huge pages (default is false)
+        \return 'true' if the file was successfully opened and mapped, 'false' otherwise
+    */
+    bool Open(const CppCommon::Path& path, bool huge_pages = false);
+    //! Unmap and close the file
+    void Close();
+
+    //! Process the whole mapped file with the given ITCH handler
+    /*!
+        \param handler - ITCH handler (ITCHHandler or BasicITCHHandler based)
+        \return 'true' if the mapped file was successfully processed, 'false' if the mapped file process was failed
+    */
+    template <class THandler>
+    bool Process(THandler& handler) { return (_size == 0) || handler.Process(_data, _size); }
+
+private:
+    bool _opened;
+    void* _data;
+    size_t _size;
+#if defined(_WIN32) || defined(_WIN64)
+    void* _file;
+    void* _mapping;
+#endif
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#endif // CPPTRADER_ITCH_MAPPED_FILE_H
@@ -0,0 +1,87 @@
+/*!
+    \file itch_market_adapter.h
+    \brief NASDAQ ITCH market adapter definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_MARKET_ADAPTER_H
+#define CPPTRADER_ITCH_MARKET_ADAPTER_H
+
+#include "itch_handler.h"
+
+#include "trader/matching/market_manager_optimized.h"
+
+namespace CppTrader {
+namespace ITCH {
+
+//! NASDAQ ITCH market adapter
+/*!
+    ITCH market adapter is an ITCH handler which builds L2/L3 order books
+    from the NASDAQ ITCH feed in the given optimized market manager:
+    \li Stock directory messages add symbols and order books
+    \li Add order messages add limit orders
+    \li Order executed, cancel, delete and replace messages update orders
+
+    Messages which fail to be applied to the market manager are counted as
+    errors, but do not interrupt the ITCH processing.
+
+    Not thread-safe.
+*/
+class ITCHMarketAdapter : public ITCHHandler
+{
+public:
+    explicit ITCHMarketAdapter(Matching::MarketManagerOptimized& market);
+    ITCHMarketAdapter(const ITCHMarketAdapter&) = delete;
+    ITCHMarketAdapter(ITCHMarketAdapter&&) = delete;
+    virtual ~ITCHMarketAdapter() = default;
+
+    ITCHMarketAdapter& operator=(const ITCHMarketAdapter&) = delete;
+    ITCHMarketAdapter& operator=(ITCHMarketAdapter&&) = delete;
+
+    //! Get the market manager
+    Matching::MarketManagerOptimized& market() noexcept { return _market; }
+
+    //! Get the count of processed messages
+    size_t messages() const noexcept { return _messages; }
+    //! Get the count of failed messages
+    size_t errors() const noexcept { return _errors; }
+
+protected:
+    // Message handlers
+    bool onMessage(const SystemEventMessage& message) override { ++_messages; return true; }
+    bool onMessage(const StockDirectoryMessage& message) override;
+    bool onMessage(const StockTradingActionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RegSHOMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MarketParticipantPositionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBDeclineMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBStatusMessage& message) override { ++_messages; return true; }
+    bool onMessage(const IPOQuotingMessage& message) override { ++_messages; return true; }
+    bool onMessage(const AddOrderMessage& message) override;
+    bool onMessage(const AddOrderMPIDMessage& message) override;
+    bool onMessage(const OrderExecutedMessage& message) override;
+    bool onMessage(const OrderExecutedWithPriceMessage& message) override;
+    bool onMessage(const OrderCancelMessage& message) override;
+    bool onMessage(const OrderDeleteMessage& message) override;
+    bool onMessage(const OrderReplaceMessage& message) override;
+    bool onMessage(const TradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const CrossTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const BrokenTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const NOIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RPIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const LULDAuctionCollarMessage& message) override { ++_messages; return true; }
+    bool onMessage(const UnknownMessage& message) override { ++_messages; ++_errors; return true; }
+
+private:
+    Matching::MarketManagerOptimized& _market;
+    size_t _messages;
+    size_t _errors;
+
+    bool Apply(Matching::ErrorCode result) noexcept;
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#endif // CPPTRADER_ITCH_MARKET_ADAPTER_H
@@ -0,0 +1,110 @@
+/*!
+    \file itch_market_pipeline.h
+    \brief NASDAQ ITCH market pipeline definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_MARKET_PIPELINE_H
+#define CPPTRADER_ITCH_MARKET_PIPELINE_H
+
+#include "itch_handler_static.h"
+
+#include "trader/matching/market_manager_sharded.h"
+
+namespace CppTrader {
+namespace ITCH {
+
+//! NASDAQ ITCH market pipeline
+/*!
+    ITCH market pipeline builds order books from the NASDAQ ITCH feed in
+    several book worker threads. The thread which calls Process() method is the
+    decode thread. It parses stock directory and order messages with message
+    views (other messages are skipped without parsing), converts them into
+    market commands with the stock locate as the symbol Id and submits them
+    to the sharded market manager (see Matching::MarketManagerSharded). Each
+    book worker is a shard which owns its own MarketManager with order books
+    of the stock locates routed to it (stock locate modulo workers count), so
+    order books of different stocks are updated in parallel while messages of
+    the same stock are applied in the feed order. Stock directory message is
+    routed as two commands which add the symbol and its order book.
+
+    Order executed, cancel, delete and replace messages identify the order by
+    its reference number only, but their header carries the stock locate of
+    the order book, so they are routed without the shared order reference map.
+    The replaced order keeps the book worker of the original one.
+
+    Market handler of each book worker is called from the book worker thread.
+
+    Commands are processed asynchronously, so errors are only counted. Use Wait()
+    method to wait until all routed commands are processed before inspecting
+    book worker market managers.
+
+    Messages must be processed from the single decode thread.
+*/
+class ITCHMarketPipeline : public BasicITCHHandler<ITCHMarketPipeline>
+{
+public:
+    //! Initialize the ITCH market pipeline
+    /*!
+        \param market_handlers - Market handlers for each book worker (one book worker per handler)
+        \param queue_capacity - Command queue capacity of each book worker, must be a power of two (default is 65536)
+        \throws std::invalid_argument if no market handlers are provided
+    */
+    explicit ITCHMarketPipeline(const std::vector<Matching::MarketHandler*>& market_handlers, size_t queue_capacity = 65536);
+    ITCHMarketPipeline(const ITCHMarketPipeline&) = delete;
+    ITCHMarketPipeline(ITCHMarketPipeline&&) = delete;
+    ~ITCHMarketPipeline() = default;
+
+    ITCHMarketPipeline& operator=(const ITCHMarketPipeline&) = delete;
+    ITCHMarketPipeline& operator=(ITCHMarketPipeline&&) = delete;
+
+    //! Get book workers count
+    size_t workers() const noexcept { return _market.shards(); }
+    //! Get the market manager of the given book worker
+    /*!
+        Book worker market manager is modified from the book worker thread, so
+        it could be inspected safely only after Wait() method call.
+
+        \param index - Book worker index
+        \return Market manager of the book worker
+    */
+    const Matching::MarketManager& market(size_t index) const noexcept { return _market.shard(index); }
+
+    //! Get routed commands count
+    uint64_t routed() const noexcept { return _routed; }
+    //! Get processed commands count
+    uint64_t processed() const noexcept { return _market.processed(); }
+    //! Get failed commands count
+    uint64_t errors() const noexcept { return _market.errors(); }
+
+    //! Get the book worker index for the given stock locate
+    size_t WorkerOf(uint16_t stock_locate) const noexcept { return _market.ShardOf(stock_locate); }
+
+    //! Wait until all routed commands are processed
+    void Wait() const { _market.Wait(); }
+
+    // Message handlers
+    bool onMessage(const StockDirectoryView& view);
+    bool onMessage(const AddOrderView& view);
+    bool onMessage(const AddOrderMPIDView& view);
+    bool onMessage(const OrderExecutedView& view);
+    bool onMessage(const OrderExecutedWithPriceView& view);
+    bool onMessage(const OrderCancelView& view);
+    bool onMessage(const OrderDeleteView& view);
+    bool onMessage(const OrderReplaceView& view);
+
+private:
+    Matching::MarketManagerSharded _market;
+    uint64_t _routed;
+
+    void Route(const Matching::MarketCommand& command);
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#include "itch_market_pipeline.inl"
+
+#endif // CPPTRADER_ITCH_MARKET_PIPELINE_H
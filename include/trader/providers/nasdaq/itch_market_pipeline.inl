@@ -0,0 +1,70 @@
+/*!
+    \file itch_market_pipeline.inl
+    \brief NASDAQ ITCH market pipeline inline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+namespace CppTrader {
+namespace ITCH {
+
+inline bool ITCHMarketPipeline::onMessage(const StockDirectoryView& view)
+{
+    Matching::Symbol symbol(view.StockLocate(), view.Stock());
+    Route(Matching::MarketCommand::AddSymbol(symbol));
+    Route(Matching::MarketCommand::AddOrderBook(symbol));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const AddOrderView& view)
+{
+    Route(Matching::MarketCommand::AddOrder(Matching::Order::Limit(view.OrderReferenceNumber(), view.StockLocate(), (view.BuySellIndicator() == 'B') ? Matching::OrderSide::BUY : Matching::OrderSide::SELL, view.Price(), view.Shares())));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const AddOrderMPIDView& view)
+{
+    Route(Matching::MarketCommand::AddOrder(Matching::Order::Limit(view.OrderReferenceNumber(), view.StockLocate(), (view.BuySellIndicator() == 'B') ? Matching::OrderSide::BUY : Matching::OrderSide::SELL, view.Price(), view.Shares())));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const OrderExecutedView& view)
+{
+    Route(Matching::MarketCommand::ExecuteOrder(view.StockLocate(), view.OrderReferenceNumber(), view.ExecutedShares()));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const OrderExecutedWithPriceView& view)
+{
+    Route(Matching::MarketCommand::ExecuteOrder(view.StockLocate(), view.OrderReferenceNumber(), view.ExecutionPrice(), view.ExecutedShares()));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const OrderCancelView& view)
+{
+    Route(Matching::MarketCommand::ReduceOrder(view.StockLocate(), view.OrderReferenceNumber(), view.CanceledShares()));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const OrderDeleteView& view)
+{
+    Route(Matching::MarketCommand::DeleteOrder(view.StockLocate(), view.OrderReferenceNumber()));
+    return true;
+}
+
+inline bool ITCHMarketPipeline::onMessage(const OrderReplaceView& view)
+{
+    Route(Matching::MarketCommand::ReplaceOrder(view.StockLocate(), view.OriginalOrderReferenceNumber(), view.NewOrderReferenceNumber(), view.Price(), view.Shares()));
+    return true;
+}
+
+inline void ITCHMarketPipeline::Route(const Matching::MarketCommand& command)
+{
+    // Spin in the sharded market manager until the book worker queue has a free slot
+    _market.Submit(command);
+    ++_routed;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -0,0 +1,241 @@
+/*!
+    \file itch_message_view.h
+    \brief NASDAQ ITCH message views definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_MESSAGE_VIEW_H
+#define CPPTRADER_ITCH_MESSAGE_VIEW_H
+
+#include "utility/endian.h"
+
+#include <cstring>
+
+namespace CppTrader {
+namespace ITCH {
+
+struct StockDirectoryMessage;
+struct AddOrderMessage;
+struct AddOrderMPIDMessage;
+struct OrderExecutedMessage;
+struct OrderExecutedWithPriceMessage;
+struct OrderCancelMessage;
+struct OrderDeleteMessage;
+struct OrderReplaceMessage;
+struct TradeMessage;
+
+//! ITCH message view
+/*!
+    Message view is a lightweight read-only view over the raw ITCH message in
+    the input buffer. Fields are not decoded in advance, each accessor reads
+    its big-endian field directly from the buffer, so handlers pay only for
+    fields they touch.
+
+    Message view is valid only during the handler call, because the input
+    buffer could be reused after it.
+*/
+class MessageView
+{
+public:
+    explicit MessageView(const void* data) noexcept : _data((const uint8_t*)data) {}
+    MessageView(const MessageView&) noexcept = default;
+    MessageView(MessageView&&) noexcept = default;
+    ~MessageView() noexcept = default;
+
+    MessageView& operator=(const MessageView&) noexcept = default;
+    MessageView& operator=(MessageView&&) noexcept = default;
+
+    //! Get the raw message data
+    const uint8_t* data() const noexcept { return _data; }
+
+    char Type() const noexcept { return (char)_data[0]; }
+    uint16_t StockLocate() const noexcept { return ReadBigEndian<uint16_t>(1); }
+    uint16_t TrackingNumber() const noexcept { return ReadBigEndian<uint16_t>(3); }
+    //! Timestamp (decoded the same way as ITCHHandler decodes it)
+    uint64_t Timestamp() const noexcept { return ((uint64_t)_data[5] << 16) | ((uint64_t)_data[6] << 8) | (uint64_t)_data[7]; }
+
+protected:
+    const uint8_t* _data;
+
+    template <typename T>
+    T ReadBigEndian(size_t offset) const noexcept
+    { T value; CppCommon::Endian::ReadBigEndian(_data + offset, value); return value; }
+    const char* ReadString(size_t offset) const noexcept { return (const char*)(_data + offset); }
+    template <size_t N>
+    void CopyString(size_t offset, char (&str)[N]) const noexcept { std::memcpy(str, _data + offset, N); }
+};
+
+//! Stock Directory Message view
+class StockDirectoryView : public MessageView
+{
+public:
+    static const size_t SIZE = 39;
+
+    using MessageView::MessageView;
+
+    //! Stock (8 characters without the trailing zero)
+    const char* Stock() const noexcept { return ReadString(11); }
+    char MarketCategory() const noexcept { return (char)_data[19]; }
+    char FinancialStatusIndicator() const noexcept { return (char)_data[20]; }
+    uint32_t RoundLotSize() const noexcept { return ReadBigEndian<uint32_t>(21); }
+    char RoundLotsOnly() const noexcept { return (char)_data[25]; }
+    char IssueClassification() const noexcept { return (char)_data[26]; }
+    //! Issue sub type (2 characters without the trailing zero)
+    const char* IssueSubType() const noexcept { return ReadString(27); }
+    char Authenticity() const noexcept { return (char)_data[29]; }
+    char ShortSaleThresholdIndicator() const noexcept { return (char)_data[30]; }
+    char IPOFlag() const noexcept { return (char)_data[31]; }
+    char LULDReferencePriceTier() const noexcept { return (char)_data[32]; }
+    char ETPFlag() const noexcept { return (char)_data[33]; }
+    uint32_t ETPLeverageFactor() const noexcept { return ReadBigEndian<uint32_t>(34); }
+    char InverseIndicator() const noexcept { return (char)_data[38]; }
+
+    //! Decode all message fields
+    StockDirectoryMessage Decode() const noexcept;
+};
+
+//! Add Order Message view
+class AddOrderView : public MessageView
+{
+public:
+    static const size_t SIZE = 36;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    char BuySellIndicator() const noexcept { return (char)_data[19]; }
+    uint32_t Shares() const noexcept { return ReadBigEndian<uint32_t>(20); }
+    //! Stock (8 characters without the trailing zero)
+    const char* Stock() const noexcept { return ReadString(24); }
+    uint32_t Price() const noexcept { return ReadBigEndian<uint32_t>(32); }
+
+    //! Decode all message fields
+    AddOrderMessage Decode() const noexcept;
+};
+
+//! Add Order with MPID Attribution Message view
+class AddOrderMPIDView : public MessageView
+{
+public:
+    static const size_t SIZE = 40;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    char BuySellIndicator() const noexcept { return (char)_data[19]; }
+    uint32_t Shares() const noexcept { return ReadBigEndian<uint32_t>(20); }
+    //! Stock (8 characters without the trailing zero)
+    const char* Stock() const noexcept { return ReadString(24); }
+    uint32_t Price() const noexcept { return ReadBigEndian<uint32_t>(32); }
+    char Attribution() const noexcept { return (char)_data[36]; }
+
+    //! Decode all message fields
+    AddOrderMPIDMessage Decode() const noexcept;
+};
+
+//! Order Executed Message view
+class OrderExecutedView : public MessageView
+{
+public:
+    static const size_t SIZE = 31;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    uint32_t ExecutedShares() const noexcept { return ReadBigEndian<uint32_t>(19); }
+    uint64_t MatchNumber() const noexcept { return ReadBigEndian<uint64_t>(23); }
+
+    //! Decode all message fields
+    OrderExecutedMessage Decode() const noexcept;
+};
+
+//! Order Executed With Price Message view
+class OrderExecutedWithPriceView : public MessageView
+{
+public:
+    static const size_t SIZE = 36;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    uint32_t ExecutedShares() const noexcept { return ReadBigEndian<uint32_t>(19); }
+    uint64_t MatchNumber() const noexcept { return ReadBigEndian<uint64_t>(23); }
+    char Printable() const noexcept { return (char)_data[31]; }
+    uint32_t ExecutionPrice() const noexcept { return ReadBigEndian<uint32_t>(32); }
+
+    //! Decode all message fields
+    OrderExecutedWithPriceMessage Decode() const noexcept;
+};
+
+//! Order Cancel Message view
+class OrderCancelView : public MessageView
+{
+public:
+    static const size_t SIZE = 23;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    uint32_t CanceledShares() const noexcept { return ReadBigEndian<uint32_t>(19); }
+
+    //! Decode all message fields
+    OrderCancelMessage Decode() const noexcept;
+};
+
+//! Order Delete Message view
+class OrderDeleteView : public MessageView
+{
+public:
+    static const size_t SIZE = 19;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+
+    //! Decode all message fields
+    OrderDeleteMessage Decode() const noexcept;
+};
+
+//! Order Replace Message view
+class OrderReplaceView : public MessageView
+{
+public:
+    static const size_t SIZE = 35;
+
+    using MessageView::MessageView;
+
+    uint64_t OriginalOrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    uint64_t NewOrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(19); }
+    uint32_t Shares() const noexcept { return ReadBigEndian<uint32_t>(27); }
+    uint32_t Price() const noexcept { return ReadBigEndian<uint32_t>(31); }
+
+    //! Decode all message fields
+    OrderReplaceMessage Decode() const noexcept;
+};
+
+//! Trade Message view
+class TradeView : public MessageView
+{
+public:
+    static const size_t SIZE = 44;
+
+    using MessageView::MessageView;
+
+    uint64_t OrderReferenceNumber() const noexcept { return ReadBigEndian<uint64_t>(11); }
+    char BuySellIndicator() const noexcept { return (char)_data[19]; }
+    uint32_t Shares() const noexcept { return ReadBigEndian<uint32_t>(20); }
+    //! Stock (8 characters without the trailing zero)
+    const char* Stock() const noexcept { return ReadString(24); }
+    uint32_t Price() const noexcept { return ReadBigEndian<uint32_t>(32); }
+    uint64_t MatchNumber() const noexcept { return ReadBigEndian<uint64_t>(36); }
+
+    //! Decode all message fields
+    TradeMessage Decode() const noexcept;
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#endif // CPPTRADER_ITCH_MESSAGE_VIEW_H
@@ -0,0 +1,152 @@
+/*!
+    \file itch_parallel_decoder.h
+    \brief NASDAQ ITCH parallel decoder definition
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#ifndef CPPTRADER_ITCH_PARALLEL_DECODER_H
+#define CPPTRADER_ITCH_PARALLEL_DECODER_H
+
+#include "itch_handler.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace CppTrader {
+namespace ITCH {
+
+//! NASDAQ ITCH parallel decoder
+/*!
+    ITCH parallel decoder decodes ITCH messages of the given buffer in several
+    worker threads and delivers decoded messages to the ITCH handler in their
+    original order.
+
+    The buffer is processed in the following steps:
+    \li The calling thread indexes message boundaries by their length prefixes
+        and splits the buffer into chunks of whole messages
+    \li Worker threads decode chunks concurrently into per-chunk message buffers
+    \li The calling thread delivers decoded messages of each chunk to the ITCH
+        handler in the chunk order
+
+    Only a limited window of chunks is decoded ahead of the delivered one, so
+    the memory used by message buffers does not depend on the buffer size.
+
+    Worker threads are started once by the decoder and wait for the next
+    buffer between Process() calls, so streaming callers do not pay for the
+    thread creation per buffer. Message buffers keep their capacity between
+    calls as well. If the ITCH handler throws an exception, the decoding of
+    the buffer is stopped before the exception is propagated, and the decoder
+    could be used for the next buffer.
+
+    Decoded messages are delivered to onMessage() handlers from the calling
+    thread. ITCH handlers with the message views mode enabled process the
+    buffer sequentially, because message views are not decoded at all.
+
+    Not thread-safe.
+*/
+class ITCHParallelDecoder
+{
+public:
+    //! Decoded ITCH message
+    typedef std::variant<SystemEventMessage, StockDirectoryMessage, StockTradingActionMessage, RegSHOMessage,
+                         MarketParticipantPositionMessage, MWCBDeclineMessage, MWCBStatusMessage, IPOQuotingMessage,
+                         AddOrderMessage, AddOrderMPIDMessage, OrderExecutedMessage, OrderExecutedWithPriceMessage,
+                         OrderCancelMessage, OrderDeleteMessage, OrderReplaceMessage, TradeMessage, CrossTradeMessage,
+                         BrokenTradeMessage, NOIIMessage, RPIIMessage, LULDAuctionCollarMessage, UnknownMessage> Message;
+
+    //! Default chunk size in bytes
+    static const size_t DEFAULT_CHUNK_SIZE = 1024 * 1024;
+
+    //! Initialize the parallel decoder with the given count of worker threads and chunk size
+    /*!
+        \param threads - Count of worker threads (default is 0 to use the hardware concurrency)
+        \param chunk_size - Chunk size in bytes (default is DEFAULT_CHUNK_SIZE)
+    */
+    explicit ITCHParallelDecoder(size_t threads = 0, size_t chunk_size = DEFAULT_CHUNK_SIZE);
+    ITCHParallelDecoder(const ITCHParallelDecoder&) = delete;
+    ITCHParallelDecoder(ITCHParallelDecoder&&) = delete;
+    ~ITCHParallelDecoder();
+
+    ITCHParallelDecoder& operator=(const ITCHParallelDecoder&) = delete;
+    ITCHParallelDecoder& operator=(ITCHParallelDecoder&&) = delete;
+
+    //! Get the count of worker threads
+    size_t threads() const noexcept { return _threads; }
+    //! Get the chunk size in bytes
+    size_t chunk_size() const noexcept { return _chunk_size; }
+
+    //! Decode all messages from the given buffer in parallel and call corresponding handlers in the original order
+    /*!
+        The buffer must start from the message boundary, so the ITCH handler
+        must not have a partial message from the previous buffer. The partial
+        message at the end of the buffer is passed to the ITCH handler and is
+        completed by its next Process() call.
+
+        \param buffer - Buffer to process
+        \param size - Buffer size
+        \param handler - ITCH handler
+        \return 'true' if the given buffer was successfully processed, 'false' if the given buffer process was failed
+    */
+    bool Process(void* buffer, size_t size, ITCHHandler& handler);
+
+    //! Decode a single ITCH message
+    /*!
+        \param buffer - Buffer with a single message
+        \param size - Message size
+        \param message - Message to decode
+        \return 'true' if the message was successfully decoded, 'false' if the message size is invalid
+    */
+    static bool Decode(const void* buffer, size_t size, Message& message);
+
+private:
+    size_t _threads;
+    size_t _chunk_size;
+
+    struct Chunk
+    {
+        size_t Offset;
+        size_t Size;
+    };
+
+    struct Slot
+    {
+        std::vector<Message> Messages;
+        size_t Index;
+        bool Ready;
+        bool Failed;
+
+        Slot() : Index(0), Ready(false), Failed(false) {}
+    };
+
+    // Worker threads pool
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _chunk_decoded;
+    std::condition_variable _chunk_delivered;
+    bool _shutdown;
+
+    // Buffer being processed
+    const uint8_t* _data;
+    std::vector<Chunk> _chunks;
+    std::vector<Slot> _slots;
+    size_t _next;
+    size_t _delivered;
+    size_t _decoding;
+    bool _stop;
+
+    void Worker();
+    void Shutdown();
+    void StopBuffer();
+
+    static void DecodeChunk(const uint8_t* data, size_t size, Slot& slot);
+};
+
+} // namespace ITCH
+} // namespace CppTrader
+
+#endif // CPPTRADER_ITCH_PARALLEL_DECODER_H
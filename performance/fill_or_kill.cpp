@@ -0,0 +1,123 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "trader/matching/market_manager.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _executions(0)
+    {}
+
+    size_t executions() const { return _executions; }
+
+protected:
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_executions; }
+
+private:
+    size_t _executions;
+};
+
+// Send 'Fill-Or-Kill' orders into the deep order book and measure their latency
+void Benchmark(const std::string& name, bool volume_index, size_t levels, size_t orders, uint64_t quantity)
+{
+    MyMarketHandler market_handler;
+    MarketManager market(market_handler);
+    if (volume_index)
+        market.EnableVolumeIndex();
+
+    Symbol symbol(0, "FOK");
+    market.AddSymbol(symbol);
+    market.AddOrderBook(symbol);
+    market.EnableMatching();
+
+    // Fill the deep order book with one order per price level
+    const uint64_t middle = 2 * levels + 1000;
+    uint64_t next_id = 1;
+    for (size_t i = 0; i < levels; ++i)
+    {
+        market.AddOrder(Order::BuyLimit(next_id++, 0, middle - 1 - i, quantity));
+        market.AddOrder(Order::SellLimit(next_id++, 0, middle + 1 + i, quantity));
+    }
+
+    // Most 'Fill-Or-Kill' orders cross the whole book, but require a bit more
+    // volume than available, so they are rejected after checking the whole side.
+    // Each tenth order is a small one which is filled at the top of the book.
+    std::mt19937 random(42);
+    std::vector<uint64_t> latencies;
+    latencies.reserve(orders);
+    uint64_t total_time = 0;
+    for (size_t i = 0; i < orders; ++i)
+    {
+        bool buy = (random() % 2) != 0;
+        bool small = (i % 10) == 0;
+        uint64_t volume = small ? quantity : (levels * quantity + 1);
+        uint64_t price = buy ? (middle + levels + 1) : (middle - levels - 1);
+        Order order = Order::Limit(next_id++, 0, buy ? OrderSide::BUY : OrderSide::SELL, price, volume, OrderTimeInForce::FOK);
+        uint64_t top = buy ? market.GetOrderBook(0)->best_ask()->Price : market.GetOrderBook(0)->best_bid()->Price;
+
+        uint64_t timestamp_start = Timestamp::nano();
+        market.AddOrder(order);
+        uint64_t timestamp_stop = Timestamp::nano();
+
+        // Restore the filled top of the book
+        if (small)
+            market.AddOrder(buy ? Order::SellLimit(next_id++, 0, top, quantity) : Order::BuyLimit(next_id++, 0, top, quantity));
+
+        latencies.push_back(timestamp_stop - timestamp_start);
+        total_time += timestamp_stop - timestamp_start;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) { return latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))]; };
+
+    std::cout << name << std::endl;
+    std::cout << "Executions: " << market_handler.executions() << std::endl;
+    std::cout << "Order latency (average): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_time / std::max<size_t>(orders, 1)) << std::endl;
+    std::cout << "Order latency (50%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.5)) << std::endl;
+    std::cout << "Order latency (99%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.99)) << std::endl;
+    std::cout << "Order throughput: " << orders * 1000000000 / std::max(total_time, (uint64_t)1) << " ops/s" << std::endl;
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-l", "--levels").dest("levels").help("Order book depth in price levels for each side").set_default("10000");
+    parser.add_option("-o", "--orders").dest("orders").help("'Fill-Or-Kill' orders count").set_default("10000");
+    parser.add_option("-q", "--quantity").dest("quantity").help("Price level quantity").set_default("100");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    size_t levels = std::max<size_t>(std::stoull(options["levels"]), 1);
+    size_t orders = std::max<size_t>(std::stoull(options["orders"]), 1);
+    uint64_t quantity = std::max<uint64_t>(std::stoull(options["quantity"]), 1);
+
+    Benchmark("Price levels walk", false, levels, orders, quantity);
+    Benchmark("Volume index", true, levels, orders, quantity);
+
+    return 0;
+}
@@ -3,6 +3,9 @@
 //
 
 #include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_handler_static.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
+#include "trader/providers/nasdaq/itch_parallel_decoder.h"
 
 #include "benchmark/reporter_console.h"
 #include "filesystem/file.h"
@@ -19,11 +22,13 @@ class MyITCHHandler : public ITCHHandler
 public:
     MyITCHHandler()
         : _messages(0),
-          _errors(0)
+          _errors(0),
+          _checksum(0)
     {}
 
     size_t messages() const { return _messages; }
     size_t errors() const { return _errors; }
+    uint64_t checksum() const { return _checksum; }
 
 protected:
     bool onMessage(const SystemEventMessage& message) override { ++_messages; return true; }
@@ -34,14 +39,14 @@ protected:
     bool onMessage(const MWCBDeclineMessage& message) override { ++_messages; return true; }
     bool onMessage(const MWCBStatusMessage& message) override { ++_messages; return true; }
     bool onMessage(const IPOQuotingMessage& message) override { ++_messages; return true; }
-    bool onMessage(const AddOrderMessage& message) override { ++_messages; return true; }
-    bool onMessage(const AddOrderMPIDMessage& message) override { ++_messages; return true; }
-    bool onMessage(const OrderExecutedMessage& message) override { ++_messages; return true; }
-    bool onMessage(const OrderExecutedWithPriceMessage& message) override { ++_messages; return true; }
-    bool onMessage(const OrderCancelMessage& message) override { ++_messages; return true; }
-    bool onMessage(const OrderDeleteMessage& message) override { ++_messages; return true; }
-    bool onMessage(const OrderReplaceMessage& message) override { ++_messages; return true; }
-    bool onMessage(const TradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const AddOrderMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber + message.Shares; return true; }
+    bool onMessage(const AddOrderMPIDMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber + message.Shares; return true; }
+    bool onMessage(const OrderExecutedMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber + message.ExecutedShares; return true; }
+    bool onMessage(const OrderExecutedWithPriceMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber + message.ExecutedShares; return true; }
+    bool onMessage(const OrderCancelMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber + message.CanceledShares; return true; }
+    bool onMessage(const OrderDeleteMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber; return true; }
+    bool onMessage(const OrderReplaceMessage& message) override { ++_messages; _checksum += message.NewOrderReferenceNumber + message.Shares; return true; }
+    bool onMessage(const TradeMessage& message) override { ++_messages; _checksum += message.OrderReferenceNumber + message.Shares; return true; }
     bool onMessage(const CrossTradeMessage& message) override { ++_messages; return true; }
     bool onMessage(const BrokenTradeMessage& message) override { ++_messages; return true; }
     bool onMessage(const NOIIMessage& message) override { ++_messages; return true; }
@@ -49,53 +54,88 @@ protected:
     bool onMessage(const LULDAuctionCollarMessage& message) override { ++_messages; return true; }
     bool onMessage(const UnknownMessage& message) override { ++_errors; return true; }
 
+    // Message views read only fields used by the handler
+    bool onMessageView(const StockDirectoryView& view) override { ++_messages; return true; }
+    bool onMessageView(const AddOrderView& view) override { ++_messages; _checksum += view.OrderReferenceNumber() + view.Shares(); return true; }
+    bool onMessageView(const AddOrderMPIDView& view) override { ++_messages; _checksum += view.OrderReferenceNumber() + view.Shares(); return true; }
+    bool onMessageView(const OrderExecutedView& view) override { ++_messages; _checksum += view.OrderReferenceNumber() + view.ExecutedShares(); return true; }
+    bool onMessageView(const OrderExecutedWithPriceView& view) override { ++_messages; _checksum += view.OrderReferenceNumber() + view.ExecutedShares(); return true; }
+    bool onMessageView(const OrderCancelView& view) override { ++_messages; _checksum += view.OrderReferenceNumber() + view.CanceledShares(); return true; }
+    bool onMessageView(const OrderDeleteView& view) override { ++_messages; _checksum += view.OrderReferenceNumber(); return true; }
+    bool onMessageView(const OrderReplaceView& view) override { ++_messages; _checksum += view.NewOrderReferenceNumber() + view.Shares(); return true; }
+    bool onMessageView(const TradeView& view) override { ++_messages; _checksum += view.OrderReferenceNumber() + view.Shares(); return true; }
+
 private:
     size_t _messages;
     size_t _errors;
+    uint64_t _checksum;
 };
 
-int main(int argc, char** argv)
+// Order book builder handles only order messages, others are skipped without parsing
+class MyStaticITCHHandler : public BasicITCHHandler<MyStaticITCHHandler>
 {
-    auto parser = optparse::OptionParser().version("1.0.0.0");
+public:
+    MyStaticITCHHandler()
+        : _messages(0),
+          _checksum(0)
+    {}
 
-    parser.add_option("-i", "--input").dest("input").help("Input file name");
+    size_t messages() const { return _messages; }
+    size_t errors() const { return 0; }
+    uint64_t checksum() const { return _checksum; }
 
-    optparse::Values options = parser.parse_args(argc, argv);
+    bool onMessage(const AddOrderView& view) { ++_messages; _checksum += view.OrderReferenceNumber() + view.Shares(); return true; }
+    bool onMessage(const AddOrderMPIDView& view) { ++_messages; _checksum += view.OrderReferenceNumber() + view.Shares(); return true; }
+    bool onMessage(const OrderExecutedView& view) { ++_messages; _checksum += view.OrderReferenceNumber() + view.ExecutedShares(); return true; }
+    bool onMessage(const OrderExecutedWithPriceView& view) { ++_messages; _checksum += view.OrderReferenceNumber() + view.ExecutedShares(); return true; }
+    bool onMessage(const OrderCancelView& view) { ++_messages; _checksum += view.OrderReferenceNumber() + view.CanceledShares(); return true; }
+    bool onMessage(const OrderDeleteView& view) { ++_messages; _checksum += view.OrderReferenceNumber(); return true; }
+    bool onMessage(const OrderReplaceView& view) { ++_messages; _checksum += view.NewOrderReferenceNumber() + view.Shares(); return true; }
 
-    // Print help
-    if (options.get("help"))
-    {
-        parser.print_help();
-        return 0;
-    }
+private:
+    size_t _messages;
+    uint64_t _checksum;
+};
 
-    MyITCHHandler itch_handler;
+bool ProcessMapped(MyITCHHandler& itch_handler, ITCHMappedFile& mapped_file, ITCHParallelDecoder* decoder)
+{
+    return (decoder != nullptr) ? decoder->Process(mapped_file.data(), mapped_file.size(), itch_handler) : mapped_file.Process(itch_handler);
+}
 
-    // Open the input file or stdin
-    std::unique_ptr<Reader> input(new StdInput());
-    if (options.is_set("input"))
-    {
-        File* file = new File(Path(options.get("input")));
-        file->Open(true, false);
-        input.reset(file);
-    }
+bool ProcessMapped(MyStaticITCHHandler& itch_handler, ITCHMappedFile& mapped_file, ITCHParallelDecoder* decoder)
+{
+    return mapped_file.Process(itch_handler);
+}
 
+template <class THandler>
+void ProcessInput(THandler& itch_handler, ITCHMappedFile& mapped_file, Reader& input, ITCHParallelDecoder* decoder, const std::string& mode)
+{
     // Perform input
     size_t size;
     uint8_t buffer[8192];
     std::cout << "ITCH processing...";
     uint64_t timestamp_start = Timestamp::nano();
-    while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+    if (mapped_file.IsOpened())
     {
-        // Process the buffer
-        itch_handler.Process(buffer, size);
+        // Process the whole mapped file
+        ProcessMapped(itch_handler, mapped_file, decoder);
+    }
+    else
+    {
+        while ((size = input.Read(buffer, sizeof(buffer))) > 0)
+        {
+            // Process the buffer
+            itch_handler.Process(buffer, size);
+        }
     }
     uint64_t timestamp_stop = Timestamp::nano();
     std::cout << "Done!" << std::endl;
 
     std::cout << std::endl;
 
+    std::cout << "Mode: " << mode << std::endl;
     std::cout << "Errors: " << itch_handler.errors() << std::endl;
+    std::cout << "Checksum: " << itch_handler.checksum() << std::endl;
 
     std::cout << std::endl;
 
@@ -105,6 +145,54 @@ int main(int argc, char** argv)
     std::cout << "Total ITCH messages: " << total_messages << std::endl;
     std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_messages) << std::endl;
     std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-v", "--views").dest("views").action("store_true").help("Process messages with message views instead of decoded messages");
+    parser.add_option("-p", "--huge-pages").dest("huge").action("store_true").help("Advise huge pages for the memory-mapped input file");
+    parser.add_option("-t", "--threads").dest("threads").help("Decode the memory-mapped input file in parallel with the given count of threads (0 for all cores)");
+    parser.add_option("-s", "--static").dest("static").action("store_true").help("Process only order messages with the static ITCH handler");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Map the input file or read stdin
+    ITCHMappedFile mapped_file;
+    std::unique_ptr<Reader> input(new StdInput());
+    if (options.is_set("input") && !mapped_file.Open(Path(options.get("input")), (bool)options.get("huge")))
+    {
+        std::cerr << "Cannot map the input file: " << options.get("input") << std::endl;
+        return -1;
+    }
+
+    if (options.get("static"))
+    {
+        MyStaticITCHHandler itch_handler;
+        ProcessInput(itch_handler, mapped_file, *input, nullptr, "static order messages");
+    }
+    else
+    {
+        MyITCHHandler itch_handler;
+        if (options.get("views"))
+            itch_handler.EnableMessageViews();
+        if (options.is_set("threads"))
+        {
+            ITCHParallelDecoder decoder(std::stoull(options["threads"]));
+            ProcessInput(itch_handler, mapped_file, *input, &decoder, "parallel decoded messages (" + std::to_string(decoder.threads()) + " threads)");
+        }
+        else
+            ProcessInput(itch_handler, mapped_file, *input, nullptr, itch_handler.IsMessageViewsEnabled() ? "message views" : "decoded messages");
+    }
 
     return 0;
 }
@@ -0,0 +1,207 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "trader/matching/market_journal.h"
+#include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
+
+#include "benchmark/reporter_console.h"
+#include "filesystem/file.h"
+#include "system/stream.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+using namespace CppTrader::Matching;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _updates(0)
+    {}
+
+    size_t updates() const { return _updates; }
+
+protected:
+    void onAddOrder(const Order& order) override { ++_updates; }
+    void onUpdateOrder(const Order& order) override { ++_updates; }
+    void onDeleteOrder(const Order& order) override { ++_updates; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; }
+
+private:
+    size_t _updates;
+};
+
+// Market could be the market manager itself or the market journal around it
+template <class TMarket>
+class MyITCHHandler : public ITCHHandler
+{
+public:
+    explicit MyITCHHandler(TMarket& market)
+        : _market(market),
+          _messages(0),
+          _errors(0)
+    {}
+
+    size_t messages() const { return _messages; }
+    size_t errors() const { return _errors; }
+
+protected:
+    bool onMessage(const SystemEventMessage& message) override { ++_messages; return true; }
+    bool onMessage(const StockDirectoryMessage& message) override { ++_messages; Symbol symbol(message.StockLocate, message.Stock); _market.AddSymbol(symbol); _market.AddOrderBook(symbol); return true; }
+    bool onMessage(const StockTradingActionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RegSHOMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MarketParticipantPositionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBDeclineMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBStatusMessage& message) override { ++_messages; return true; }
+    bool onMessage(const IPOQuotingMessage& message) override { ++_messages; return true; }
+    bool onMessage(const AddOrderMessage& message) override { ++_messages; _market.AddOrder(Order::Limit(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares)); return true; }
+    bool onMessage(const AddOrderMPIDMessage& message) override { ++_messages; _market.AddOrder(Order::Limit(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares)); return true; }
+    bool onMessage(const OrderExecutedMessage& message) override { ++_messages; _market.ExecuteOrder(message.OrderReferenceNumber, message.ExecutedShares); return true; }
+    bool onMessage(const OrderExecutedWithPriceMessage& message) override { ++_messages; _market.ExecuteOrder(message.OrderReferenceNumber, message.ExecutionPrice, message.ExecutedShares); return true; }
+    bool onMessage(const OrderCancelMessage& message) override { ++_messages; _market.ReduceOrder(message.OrderReferenceNumber, message.CanceledShares); return true; }
+    bool onMessage(const OrderDeleteMessage& message) override { ++_messages; _market.DeleteOrder(message.OrderReferenceNumber); return true; }
+    bool onMessage(const OrderReplaceMessage& message) override { ++_messages; _market.ReplaceOrder(message.OriginalOrderReferenceNumber, message.NewOrderReferenceNumber, message.Price, message.Shares); return true; }
+    bool onMessage(const TradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const CrossTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const BrokenTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const NOIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RPIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const LULDAuctionCollarMessage& message) override { ++_messages; return true; }
+    bool onMessage(const UnknownMessage& message) override { ++_errors; return true; }
+
+private:
+    TMarket& _market;
+    size_t _messages;
+    size_t _errors;
+};
+
+template <class TMarket>
+uint64_t Process(TMarket& market, void* data, size_t size, size_t& messages)
+{
+    MyITCHHandler<TMarket> itch_handler(market);
+
+    uint64_t timestamp_start = Timestamp::nano();
+    itch_handler.Process(data, size);
+    uint64_t timestamp_stop = Timestamp::nano();
+
+    messages = itch_handler.messages();
+    return timestamp_stop - timestamp_start;
+}
+
+void Report(const std::string& title, uint64_t time, size_t messages)
+{
+    std::cout << title << " time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(time) << std::endl;
+    std::cout << title << " message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(time / std::max(messages, (size_t)1)) << std::endl;
+    std::cout << title << " message throughput: " << messages * 1000000000 / std::max(time, (uint64_t)1) << " msg/s" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-j", "--journal").dest("journal").help("Journal file name").set_default("market.journal");
+    parser.add_option("-g", "--group").dest("group").help("Group commit interval in microseconds").set_default("1000");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Map the input file or load stdin into memory to process it with and without the journal
+    ITCHMappedFile mapped_file;
+    std::vector<uint8_t> input_data;
+    if (options.is_set("input"))
+    {
+        if (!mapped_file.Open(Path(options.get("input"))))
+        {
+            std::cerr << "Cannot map the input file: " << options.get("input") << std::endl;
+            return -1;
+        }
+    }
+    else
+    {
+        size_t size;
+        uint8_t buffer[8192];
+        StdInput input;
+        std::cout << "ITCH loading...";
+        while ((size = input.Read(buffer, sizeof(buffer))) > 0)
+            input_data.insert(input_data.end(), buffer, buffer + size);
+        std::cout << "Done!" << std::endl;
+    }
+    void* data = mapped_file.IsOpened() ? mapped_file.data() : input_data.data();
+    size_t size = mapped_file.IsOpened() ? mapped_file.size() : input_data.size();
+
+    std::cout << std::endl;
+
+    Path path(options.get("journal"));
+    uint64_t interval = std::stoull(options["group"]) * 1000;
+    size_t messages;
+
+    // Baseline processing without the journal
+    MyMarketHandler market_handler;
+    MarketManager market(market_handler);
+    std::cout << "ITCH processing without the journal...";
+    uint64_t baseline = Process(market, data, size, messages);
+    std::cout << "Done!" << std::endl;
+    Report("Baseline", baseline, messages);
+    std::cout << std::endl;
+
+    // Steady state processing with the journal
+    MyMarketHandler journaled_handler;
+    MarketManager journaled(journaled_handler);
+    uint64_t records;
+    uint64_t journal_size;
+    uint64_t commit;
+    {
+        MarketJournal journal(journaled, path, MarketJournal::DEFAULT_PREALLOCATE, interval);
+        std::cout << "ITCH processing with the journal...";
+        uint64_t steady = Process(journal, data, size, messages);
+        uint64_t timestamp_start = Timestamp::nano();
+        if (journal.Commit() != ErrorCode::OK)
+            std::cerr << "Journal commit failed!" << std::endl;
+        commit = Timestamp::nano() - timestamp_start;
+        std::cout << "Done!" << std::endl;
+        records = journal.appended();
+        journal_size = journal.size();
+        Report("Journaled", steady, messages);
+        std::cout << "Journal overhead: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((steady > baseline) ? (steady - baseline) / std::max(messages, (size_t)1) : 0) << " per message" << std::endl;
+        std::cout << "Final commit time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(commit) << std::endl;
+        std::cout << "Journal records: " << records << std::endl;
+        std::cout << "Journal size: " << journal_size << " bytes" << std::endl;
+        std::cout << "Journal record size: " << journal_size / std::max(records, (uint64_t)1) << " bytes" << std::endl;
+    }
+    std::cout << std::endl;
+
+    // Recovery from the journal file
+    MyMarketHandler recovered_handler;
+    MarketManager recovered(recovered_handler);
+    uint64_t replayed;
+    std::cout << "Journal replay...";
+    uint64_t timestamp_start = Timestamp::nano();
+    ErrorCode result = MarketJournal::Replay(path, recovered, replayed);
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+    std::cout << "Replay result: " << result << std::endl;
+    std::cout << "Recovery time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Replayed records: " << replayed << std::endl;
+    std::cout << "Record replay latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / std::max(replayed, (uint64_t)1)) << std::endl;
+    std::cout << "Record replay throughput: " << replayed * 1000000000 / std::max(timestamp_stop - timestamp_start, (uint64_t)1) << " rec/s" << std::endl;
+    std::cout << "Recovered orders: " << recovered.orders().size() << " (expected " << journaled.orders().size() << ")" << std::endl;
+
+    File::Remove(path);
+
+    return 0;
+}
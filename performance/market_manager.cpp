@@ -4,6 +4,7 @@
 
 #include "trader/matching/market_manager.h"
 #include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
 
 #include "benchmark/reporter_console.h"
 #include "filesystem/file.h"
@@ -12,10 +13,75 @@
 
 #include <OptionParser.h>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 using namespace CppCommon;
 using namespace CppTrader::ITCH;
 using namespace CppTrader::Matching;
 
+class CacheMissCounter
+{
+public:
+    CacheMissCounter() : _fd(-1)
+    {
+#if defined(__linux__)
+        // Count hardware cache misses of the current thread in user space
+        perf_event_attr attr = {};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        _fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#endif
+    }
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+    ~CacheMissCounter()
+    {
+#if defined(__linux__)
+        if (_fd >= 0)
+            close(_fd);
+#endif
+    }
+
+    bool available() const { return _fd >= 0; }
+
+    void Start()
+    {
+#if defined(__linux__)
+        if (_fd >= 0)
+        {
+            ioctl(_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    uint64_t Stop()
+    {
+        uint64_t result = 0;
+#if defined(__linux__)
+        if (_fd >= 0)
+        {
+            ioctl(_fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(_fd, &result, sizeof(result)) != sizeof(result))
+                result = 0;
+        }
+#endif
+        return result;
+    }
+
+private:
+    int _fd;
+};
+
 class MyMarketHandler : public MarketHandler
 {
 public:
@@ -50,7 +116,7 @@ protected:
     void onAddSymbol(const Symbol& symbol) override { ++_updates; ++_symbols; _max_symbols = std::max(_symbols, _max_symbols); }
     void onDeleteSymbol(const Symbol& symbol) override { ++_updates; --_symbols; }
     void onAddOrderBook(const OrderBook& order_book) override { ++_updates; ++_order_books; _max_order_books = std::max(_order_books, _max_order_books); }
-    void onUpdateOrderBook(const OrderBook& order_book, bool top) override { _max_order_book_levels = std::max(std::max(order_book.bids().size(), order_book.asks().size()), _max_order_book_levels); }
+    void onUpdateOrderBook(const OrderBook& order_book, bool top) override { _max_order_book_levels = std::max(std::max(order_book.bids_size(), order_book.asks_size()), _max_order_book_levels); }
     void onDeleteOrderBook(const OrderBook& order_book) override { ++_updates; --_order_books; }
     void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
     void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; _max_order_book_orders = std::max(level.Orders, _max_order_book_orders); }
@@ -123,6 +189,10 @@ int main(int argc, char** argv)
     auto parser = optparse::OptionParser().version("1.0.0.0");
 
     parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-t", "--tick").dest("tick").help("Price ladder tick size (price levels are kept in AVL trees if not set)");
+    parser.add_option("-w", "--window").dest("window").help("Price ladder window size in ticks").set_default("1024");
+    parser.add_option("-d", "--direct").dest("direct").help("Direct order index limit (orders are kept in the hash map if not set)");
+    parser.add_option("-s", "--snapshot").dest("snapshot").help("Market snapshot file name to save and restore the final market state");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -137,25 +207,47 @@ int main(int argc, char** argv)
     MarketManager market(market_handler);
     MyITCHHandler itch_handler(market);
 
-    // Open the input file or stdin
+    // Enable the price ladder mode
+    if (options.is_set("tick"))
+        market.EnablePriceLadder(std::stoull(options["tick"]), std::stoull(options["window"]));
+
+    // Enable the direct order index
+    if (options.is_set("direct"))
+    {
+        market.EnableDirectOrderIndex(std::stoull(options["direct"]));
+        market.ReserveOrders(1000000);
+    }
+
+    // Map the input file or read stdin
+    ITCHMappedFile mapped_file;
     std::unique_ptr<Reader> input(new StdInput());
-    if (options.is_set("input"))
+    if (options.is_set("input") && !mapped_file.Open(Path(options.get("input"))))
     {
-        File* file = new File(Path(options.get("input")));
-        file->Open(true, false);
-        input.reset(file);
+        std::cerr << "Cannot map the input file: " << options.get("input") << std::endl;
+        return -1;
     }
 
     // Perform input
     size_t size;
     uint8_t buffer[8192];
+    CacheMissCounter cache_misses;
     std::cout << "ITCH processing...";
     uint64_t timestamp_start = Timestamp::nano();
-    while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+    cache_misses.Start();
+    if (mapped_file.IsOpened())
+    {
+        // Process the whole mapped file
+        mapped_file.Process(itch_handler);
+    }
+    else
     {
-        // Process the buffer
-        itch_handler.Process(buffer, size);
+        while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+        {
+            // Process the buffer
+            itch_handler.Process(buffer, size);
+        }
     }
+    uint64_t total_cache_misses = cache_misses.Stop();
     uint64_t timestamp_stop = Timestamp::nano();
     std::cout << "Done!" << std::endl;
 
@@ -165,6 +257,20 @@ int main(int argc, char** argv)
 
     std::cout << std::endl;
 
+    if (market.IsPriceLadderEnabled())
+        std::cout << "Price levels container: price ladder (tick size " << options["tick"] << ", window " << options["window"] << " ticks)" << std::endl;
+    else
+        std::cout << "Price levels container: AVL tree" << std::endl;
+
+    if (market.IsDirectOrderIndexEnabled())
+        std::cout << "Orders container: direct order index (limit " << options["direct"] << ")" << std::endl;
+    else
+        std::cout << "Orders container: hash map" << std::endl;
+
+    std::cout << "Order node size: " << sizeof(OrderNode) << " bytes" << std::endl;
+
+    std::cout << std::endl;
+
     size_t total_messages = itch_handler.messages();
     size_t total_updates = market_handler.updates();
 
@@ -172,6 +278,13 @@ int main(int argc, char** argv)
     std::cout << "Total ITCH messages: " << total_messages << std::endl;
     std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_messages) << std::endl;
     std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+    if (cache_misses.available())
+    {
+        std::cout << "Total cache misses: " << total_cache_misses << std::endl;
+        std::cout << "Cache misses per ITCH message: " << (double)total_cache_misses / total_messages << std::endl;
+    }
+    else
+        std::cout << "Cache misses: not available" << std::endl;
     std::cout << "Total market updates: " << total_updates << std::endl;
     std::cout << "Market update latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_updates) << std::endl;
     std::cout << "Market update throughput: " << total_updates * 1000000000 / (timestamp_stop - timestamp_start) << " upd/s" << std::endl;
@@ -193,5 +306,42 @@ int main(int argc, char** argv)
     std::cout << "Delete order operations: " << market_handler.delete_orders() << std::endl;
     std::cout << "Execute order operations: " << market_handler.execute_orders() << std::endl;
 
+    // Save and restore the market snapshot
+    if (options.is_set("snapshot"))
+    {
+        Path path(options.get("snapshot"));
+
+        std::cout << std::endl;
+
+        File output(path);
+        output.Open(false, true, true);
+        uint64_t timestamp_save = Timestamp::nano();
+        ErrorCode result = market.SaveSnapshot(output);
+        output.Close();
+        uint64_t timestamp_saved = Timestamp::nano();
+        if (result != ErrorCode::OK)
+        {
+            std::cerr << "Failed to save the market snapshot: " << result << std::endl;
+            return -1;
+        }
+
+        std::vector<uint8_t> snapshot = File::ReadAllBytes(path);
+        MarketManager restored;
+        uint64_t timestamp_restore = Timestamp::nano();
+        result = restored.LoadSnapshot(snapshot.data(), snapshot.size());
+        uint64_t timestamp_restored = Timestamp::nano();
+        if (result != ErrorCode::OK)
+        {
+            std::cerr << "Failed to restore the market snapshot: " << result << std::endl;
+            return -1;
+        }
+
+        std::cout << "Snapshot statistics: " << std::endl;
+        std::cout << "Snapshot size: " << snapshot.size() << " bytes" << std::endl;
+        std::cout << "Snapshot save time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_saved - timestamp_save) << std::endl;
+        std::cout << "Snapshot restore time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_restored - timestamp_restore) << std::endl;
+        std::cout << "Restored orders: " << restored.orders().size() << std::endl;
+    }
+
     return 0;
 }
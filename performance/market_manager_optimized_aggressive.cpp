@@ -3,6 +3,7 @@
 //
 
 #include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
 
 #include "benchmark/reporter_console.h"
 #include "filesystem/file.h"
@@ -420,13 +421,13 @@ int main(int argc, char** argv)
     MarketManagerOptimized market;
     MyITCHHandler itch_handler(market);
 
-    // Open the input file or stdin
+    // Map the input file or read stdin
+    ITCHMappedFile mapped_file;
     std::unique_ptr<Reader> input(new StdInput());
-    if (options.is_set("input"))
+    if (options.is_set("input") && !mapped_file.Open(Path(options.get("input"))))
     {
-        File* file = new File(Path(options.get("input")));
-        file->Open(true, false);
-        input.reset(file);
+        std::cerr << "Cannot map the input file: " << options.get("input") << std::endl;
+        return -1;
     }
 
     // Perform input
@@ -434,10 +435,18 @@ int main(int argc, char** argv)
     uint8_t buffer[8192];
     std::cout << "ITCH processing...";
     uint64_t timestamp_start = Timestamp::nano();
-    while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+    if (mapped_file.IsOpened())
     {
-        // Process the buffer
-        itch_handler.Process(buffer, size);
+        // Process the whole mapped file
+        mapped_file.Process(itch_handler);
+    }
+    else
+    {
+        while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+        {
+            // Process the buffer
+            itch_handler.Process(buffer, size);
+        }
     }
     uint64_t timestamp_stop = Timestamp::nano();
     std::cout << "Done!" << std::endl;
@@ -0,0 +1,220 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "trader/matching/market_manager_sharded.h"
+#include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
+#include "trader/providers/nasdaq/itch_market_pipeline.h"
+
+#include "benchmark/reporter_console.h"
+#include "filesystem/file.h"
+#include "system/stream.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+using namespace CppTrader::Matching;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _updates(0),
+          _orders(0),
+          _max_orders(0)
+    {}
+
+    size_t updates() const { return _updates; }
+    size_t max_orders() const { return _max_orders; }
+
+protected:
+    void onAddSymbol(const Symbol& symbol) override { ++_updates; }
+    void onDeleteSymbol(const Symbol& symbol) override { ++_updates; }
+    void onAddOrderBook(const OrderBook& order_book) override { ++_updates; }
+    void onDeleteOrderBook(const OrderBook& order_book) override { ++_updates; }
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onAddOrder(const Order& order) override { ++_updates; ++_orders; _max_orders = std::max(_orders, _max_orders); }
+    void onUpdateOrder(const Order& order) override { ++_updates; }
+    void onDeleteOrder(const Order& order) override { ++_updates; --_orders; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; }
+
+private:
+    size_t _updates;
+    size_t _orders;
+    size_t _max_orders;
+};
+
+class MyITCHHandler : public ITCHHandler
+{
+public:
+    explicit MyITCHHandler(MarketManagerSharded& market)
+        : _market(market),
+          _messages(0),
+          _errors(0)
+    {}
+
+    size_t messages() const { return _messages; }
+    size_t errors() const { return _errors; }
+
+protected:
+    bool onMessage(const SystemEventMessage& message) override { ++_messages; return true; }
+    bool onMessage(const StockDirectoryMessage& message) override { ++_messages; Symbol symbol(message.StockLocate, message.Stock); _market.AddSymbol(symbol); _market.AddOrderBook(symbol); return true; }
+    bool onMessage(const StockTradingActionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RegSHOMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MarketParticipantPositionMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBDeclineMessage& message) override { ++_messages; return true; }
+    bool onMessage(const MWCBStatusMessage& message) override { ++_messages; return true; }
+    bool onMessage(const IPOQuotingMessage& message) override { ++_messages; return true; }
+    bool onMessage(const AddOrderMessage& message) override { ++_messages; _market.AddOrder(Order::Limit(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares)); return true; }
+    bool onMessage(const AddOrderMPIDMessage& message) override { ++_messages; _market.AddOrder(Order::Limit(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares)); return true; }
+    bool onMessage(const OrderExecutedMessage& message) override { ++_messages; _market.ExecuteOrder(message.StockLocate, message.OrderReferenceNumber, message.ExecutedShares); return true; }
+    bool onMessage(const OrderExecutedWithPriceMessage& message) override { ++_messages; _market.ExecuteOrder(message.StockLocate, message.OrderReferenceNumber, message.ExecutionPrice, message.ExecutedShares); return true; }
+    bool onMessage(const OrderCancelMessage& message) override { ++_messages; _market.ReduceOrder(message.StockLocate, message.OrderReferenceNumber, message.CanceledShares); return true; }
+    bool onMessage(const OrderDeleteMessage& message) override { ++_messages; _market.DeleteOrder(message.StockLocate, message.OrderReferenceNumber); return true; }
+    bool onMessage(const OrderReplaceMessage& message) override { ++_messages; _market.ReplaceOrder(message.StockLocate, message.OriginalOrderReferenceNumber, message.NewOrderReferenceNumber, message.Price, message.Shares); return true; }
+    bool onMessage(const TradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const CrossTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const BrokenTradeMessage& message) override { ++_messages; return true; }
+    bool onMessage(const NOIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const RPIIMessage& message) override { ++_messages; return true; }
+    bool onMessage(const LULDAuctionCollarMessage& message) override { ++_messages; return true; }
+    bool onMessage(const UnknownMessage& message) override { ++_errors; return true; }
+
+private:
+    MarketManagerSharded& _market;
+    size_t _messages;
+    size_t _errors;
+};
+
+void Replay(size_t shards, void* data, size_t size)
+{
+    std::vector<MyMarketHandler> market_handlers(shards);
+    std::vector<MarketHandler*> market_handler_ptrs;
+    for (auto& market_handler : market_handlers)
+        market_handler_ptrs.push_back(&market_handler);
+
+    MarketManagerSharded market(market_handler_ptrs);
+    MyITCHHandler itch_handler(market);
+
+    std::cout << "ITCH processing with " << shards << " shard(s)...";
+    uint64_t timestamp_start = Timestamp::nano();
+    itch_handler.Process(data, size);
+    market.Wait();
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    size_t total_messages = itch_handler.messages();
+    size_t total_updates = 0;
+    size_t max_orders = 0;
+    for (const auto& market_handler : market_handlers)
+    {
+        total_updates += market_handler.updates();
+        max_orders += market_handler.max_orders();
+    }
+
+    std::cout << "Errors: " << itch_handler.errors() + market.errors() << std::endl;
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total ITCH messages: " << total_messages << std::endl;
+    std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_messages) << std::endl;
+    std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+    std::cout << "Total market updates: " << total_updates << std::endl;
+    std::cout << "Market update latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_updates) << std::endl;
+    std::cout << "Market update throughput: " << total_updates * 1000000000 / (timestamp_stop - timestamp_start) << " upd/s" << std::endl;
+    std::cout << "Max orders: " << max_orders << std::endl;
+    std::cout << std::endl;
+}
+
+void ReplayPipeline(size_t workers, void* data, size_t size)
+{
+    std::vector<MyMarketHandler> market_handlers(workers);
+    std::vector<MarketHandler*> market_handler_ptrs;
+    for (auto& market_handler : market_handlers)
+        market_handler_ptrs.push_back(&market_handler);
+
+    ITCHMarketPipeline pipeline(market_handler_ptrs);
+
+    std::cout << "ITCH pipeline processing with " << workers << " book worker(s)...";
+    uint64_t timestamp_start = Timestamp::nano();
+    pipeline.Process(data, size);
+    pipeline.Wait();
+    uint64_t timestamp_stop = Timestamp::nano();
+    std::cout << "Done!" << std::endl;
+
+    size_t total_messages = pipeline.routed();
+    size_t total_updates = 0;
+    size_t max_orders = 0;
+    for (const auto& market_handler : market_handlers)
+    {
+        total_updates += market_handler.updates();
+        max_orders += market_handler.max_orders();
+    }
+
+    std::cout << "Errors: " << pipeline.errors() << std::endl;
+    std::cout << "Processing time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    std::cout << "Total routed ITCH messages: " << total_messages << std::endl;
+    std::cout << "ITCH message latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_messages) << std::endl;
+    std::cout << "ITCH message throughput: " << total_messages * 1000000000 / (timestamp_stop - timestamp_start) << " msg/s" << std::endl;
+    std::cout << "Total market updates: " << total_updates << std::endl;
+    std::cout << "Market update latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod((timestamp_stop - timestamp_start) / total_updates) << std::endl;
+    std::cout << "Market update throughput: " << total_updates * 1000000000 / (timestamp_stop - timestamp_start) << " upd/s" << std::endl;
+    std::cout << "Max orders: " << max_orders << std::endl;
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input file name");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    // Map the input file or load stdin into memory to replay it with different shards count
+    ITCHMappedFile mapped_file;
+    std::vector<uint8_t> input_data;
+    if (options.is_set("input"))
+    {
+        if (!mapped_file.Open(Path(options.get("input"))))
+        {
+            std::cerr << "Cannot map the input file: " << options.get("input") << std::endl;
+            return -1;
+        }
+    }
+    else
+    {
+        size_t size;
+        uint8_t buffer[8192];
+        StdInput input;
+        std::cout << "ITCH loading...";
+        while ((size = input.Read(buffer, sizeof(buffer))) > 0)
+            input_data.insert(input_data.end(), buffer, buffer + size);
+        std::cout << "Done!" << std::endl;
+    }
+    void* data = mapped_file.IsOpened() ? mapped_file.data() : input_data.data();
+    size_t size = mapped_file.IsOpened() ? mapped_file.size() : input_data.size();
+
+    std::cout << std::endl;
+
+    for (size_t shards : { 1, 2, 4, 8 })
+        Replay(shards, data, size);
+
+    for (size_t workers : { 1, 2, 4, 8 })
+        ReplayPipeline(workers, data, size);
+
+    return 0;
+}
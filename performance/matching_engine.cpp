@@ -4,6 +4,7 @@
 
 #include "trader/matching/market_manager.h"
 #include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
 
 #include "benchmark/reporter_console.h"
 #include "filesystem/file.h"
@@ -118,11 +119,55 @@ private:
     size_t _errors;
 };
 
+void Sweep(size_t sweeps, size_t depth)
+{
+    MyMarketHandler market_handler;
+    MarketManager market(market_handler);
+
+    // Prepare symbol & order book
+    Symbol symbol(0, "SWEEP");
+    market.AddSymbol(symbol);
+    market.AddOrderBook(symbol);
+
+    // Enable automatic matching
+    market.EnableMatching();
+
+    uint64_t id = 1;
+    uint64_t duration = 0;
+
+    // Each sweep fills all resting orders with a single aggressive order
+    std::cout << "Matching sweeps processing...";
+    for (size_t i = 0; i < sweeps; ++i)
+    {
+        for (size_t j = 0; j < depth; ++j)
+            market.AddOrder(Order::SellLimit(id++, 0, 1000 + j, 10));
+
+        uint64_t timestamp_start = Timestamp::nano();
+        market.AddOrder(Order::BuyLimit(id++, 0, 1000 + depth, 10 * depth));
+        uint64_t timestamp_stop = Timestamp::nano();
+
+        duration += timestamp_stop - timestamp_start;
+    }
+    std::cout << "Done!" << std::endl;
+
+    std::cout << std::endl;
+
+    size_t total_fills = sweeps * depth;
+
+    std::cout << "Matching sweeps: " << sweeps << " (depth " << depth << " orders)" << std::endl;
+    std::cout << "Matching time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(duration) << std::endl;
+    std::cout << "Total fills: " << total_fills << std::endl;
+    std::cout << "Fill latency: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(duration / total_fills) << std::endl;
+    std::cout << "Fill throughput: " << total_fills * 1000000000 / duration << " fills/s" << std::endl;
+}
+
 int main(int argc, char** argv)
 {
     auto parser = optparse::OptionParser().version("1.0.0.0");
 
     parser.add_option("-i", "--input").dest("input").help("Input file name");
+    parser.add_option("-s", "--sweeps").dest("sweeps").help("Matching sweeps count (ITCH processing is performed if not set)");
+    parser.add_option("-d", "--depth").dest("depth").help("Matching sweep depth in resting orders").set_default("1000");
 
     optparse::Values options = parser.parse_args(argc, argv);
 
@@ -133,6 +178,13 @@ int main(int argc, char** argv)
         return 0;
     }
 
+    // Perform matching sweeps
+    if (options.is_set("sweeps"))
+    {
+        Sweep(std::stoull(options["sweeps"]), std::stoull(options["depth"]));
+        return 0;
+    }
+
     MyMarketHandler market_handler;
     MarketManager market(market_handler);
     MyITCHHandler itch_handler(market);
@@ -140,13 +192,13 @@ int main(int argc, char** argv)
     // Enable automatic matching
     market.EnableMatching();
 
-    // Open the input file or stdin
+    // Map the input file or read stdin
+    ITCHMappedFile mapped_file;
     std::unique_ptr<Reader> input(new StdInput());
-    if (options.is_set("input"))
+    if (options.is_set("input") && !mapped_file.Open(Path(options.get("input"))))
     {
-        File* file = new File(Path(options.get("input")));
-        file->Open(true, false);
-        input.reset(file);
+        std::cerr << "Cannot map the input file: " << options.get("input") << std::endl;
+        return -1;
     }
 
     // Perform input
@@ -154,10 +206,18 @@ int main(int argc, char** argv)
     uint8_t buffer[8192];
     std::cout << "ITCH processing...";
     uint64_t timestamp_start = Timestamp::nano();
-    while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+    if (mapped_file.IsOpened())
+    {
+        // Process the whole mapped file
+        mapped_file.Process(itch_handler);
+    }
+    else
     {
-        // Process the buffer
-        itch_handler.Process(buffer, size);
+        while ((size = input->Read(buffer, sizeof(buffer))) > 0)
+        {
+            // Process the buffer
+            itch_handler.Process(buffer, size);
+        }
     }
     uint64_t timestamp_stop = Timestamp::nano();
     std::cout << "Done!" << std::endl;
@@ -0,0 +1,282 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "trader/matching/market_scenario.h"
+
+#include "benchmark/reporter_console.h"
+#include "filesystem/file.h"
+#include "system/stream.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _updates(0)
+    {}
+
+    size_t updates() const { return _updates; }
+
+protected:
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onAddOrder(const Order& order) override { ++_updates; }
+    void onUpdateOrder(const Order& order) override { ++_updates; }
+    void onDeleteOrder(const Order& order) override { ++_updates; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; }
+
+private:
+    size_t _updates;
+};
+
+// Generate the stress scenario with limit, market, stop orders and order modifications
+void GenerateStress(MarketScenario& scenario, size_t symbols, size_t count)
+{
+    MarketManager market;
+
+    auto append = [&scenario](MarketManager& target, const auto& command) { command(scenario); command(target); };
+
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        char name[8] = { 0 };
+        Symbol symbol(i, name);
+        append(market, [&symbol](auto& target) { target.AddSymbol(symbol); target.AddOrderBook(symbol); });
+    }
+    append(market, [](auto& target) { target.EnableMatching(); });
+
+    std::mt19937 random(42);
+    std::vector<uint64_t> active;
+    uint64_t next_id = 1;
+    for (size_t i = 0; i < count; ++i)
+    {
+        int action = random() % 20;
+        if ((action < 10) || active.empty())
+        {
+            uint64_t id = next_id++;
+            uint32_t symbol = random() % symbols;
+            OrderSide side = (random() % 2) ? OrderSide::BUY : OrderSide::SELL;
+            uint64_t price = 1000 + random() % 100;
+            uint64_t quantity = 1 + random() % 100;
+            Order order;
+            switch (action)
+            {
+                case 0:
+                    order = Order::Market(id, symbol, side, quantity);
+                    break;
+                case 1:
+                    order = Order::Stop(id, symbol, side, (side == OrderSide::BUY) ? (price + 50) : (price - 50), quantity);
+                    break;
+                default:
+                    order = Order::Limit(id, symbol, side, price, quantity);
+                    break;
+            }
+            append(market, [&order](auto& target) { target.AddOrder(order); });
+
+            // Only resting limit orders are modified later
+            const Order* order_ptr = market.GetOrder(id);
+            if ((order_ptr != nullptr) && order_ptr->IsLimit())
+                active.push_back(id);
+        }
+        else
+        {
+            size_t index = random() % active.size();
+            uint64_t id = active[index];
+            if (action < 14)
+                append(market, [id](auto& target) { target.ReduceOrder(id, 10); });
+            else if (action < 16)
+            {
+                uint64_t price = 1000 + random() % 100;
+                append(market, [id, price](auto& target) { target.ModifyOrder(id, price, 50); });
+            }
+            else if (action < 17)
+            {
+                uint64_t new_id = next_id++;
+                uint64_t price = 1000 + random() % 100;
+                append(market, [id, new_id, price](auto& target) { target.ReplaceOrder(id, new_id, price, 50); });
+                if (market.GetOrder(new_id) != nullptr)
+                    active.push_back(new_id);
+            }
+            else
+                append(market, [id](auto& target) { target.DeleteOrder(id); });
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+        {
+            if (market.GetOrder(active[j]) == nullptr)
+            {
+                active[j] = active.back();
+                active.pop_back();
+            }
+        }
+    }
+}
+
+void ReportPercentiles(std::vector<uint64_t>& latencies)
+{
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) { return latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))]; };
+
+    std::cout << "Command latency (min): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(latencies.front()) << std::endl;
+    std::cout << "Command latency (50%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.5)) << std::endl;
+    std::cout << "Command latency (90%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.9)) << std::endl;
+    std::cout << "Command latency (99%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.99)) << std::endl;
+    std::cout << "Command latency (99.9%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.999)) << std::endl;
+    std::cout << "Command latency (99.99%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.9999)) << std::endl;
+    std::cout << "Command latency (max): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(latencies.back()) << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-i", "--input").dest("input").help("Input scenario file name (text or binary)");
+    parser.add_option("-o", "--output").dest("output").help("Output binary scenario file name");
+    parser.add_option("-g", "--generate").dest("generate").help("Generated stress scenario commands count (if no input)").set_default("1000000");
+    parser.add_option("-s", "--symbols").dest("symbols").help("Generated stress scenario symbols count").set_default("10");
+    parser.add_option("-r", "--replays").dest("replays").help("Replays count").set_default("10");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    MarketScenario scenario;
+
+    if (options.is_set("input"))
+    {
+        // Load the whole input into memory
+        std::vector<uint8_t> data = File::ReadAllBytes(Path(options.get("input")));
+
+        JournalHeader header = {};
+        if (data.size() >= sizeof(header))
+            std::memcpy(&header, data.data(), sizeof(header));
+
+        uint64_t timestamp_start = Timestamp::nano();
+        if (header.Signature == JournalHeader::SIGNATURE)
+        {
+            std::cout << "Binary scenario loading...";
+            ErrorCode result = scenario.Load(data.data(), data.size());
+            if (result != ErrorCode::OK)
+            {
+                std::cerr << "Failed to load the binary scenario: " << result << std::endl;
+                return -1;
+            }
+        }
+        else
+        {
+            // Convert the text scenario line by line
+            std::cout << "Text scenario converting...";
+            std::string line;
+            size_t errors = 0;
+            for (size_t offset = 0; offset <= data.size(); ++offset)
+            {
+                if ((offset == data.size()) || (data[offset] == '\n'))
+                {
+                    if (scenario.Parse(line) != ErrorCode::OK)
+                    {
+                        if (errors++ == 0)
+                            std::cerr << std::endl;
+                        std::cerr << "Invalid scenario command: " << line << std::endl;
+                    }
+                    line.clear();
+                }
+                else
+                    line.push_back((char)data[offset]);
+            }
+        }
+        uint64_t timestamp_stop = Timestamp::nano();
+        std::cout << "Done!" << std::endl;
+        std::cout << "Loading time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(timestamp_stop - timestamp_start) << std::endl;
+    }
+    else
+    {
+        std::cout << "Stress scenario generating...";
+        GenerateStress(scenario, std::stoull(options["symbols"]), std::stoull(options["generate"]));
+        std::cout << "Done!" << std::endl;
+    }
+
+    std::cout << "Scenario commands: " << scenario.commands() << std::endl;
+    std::cout << "Scenario size: " << scenario.size() << " bytes" << std::endl;
+    std::cout << std::endl;
+
+    // Save the binary scenario
+    if (options.is_set("output"))
+    {
+        File output(Path(options.get("output")));
+        output.Open(false, true, true);
+        ErrorCode result = scenario.Save(output);
+        output.Close();
+        if (result != ErrorCode::OK)
+        {
+            std::cerr << "Failed to save the binary scenario: " << result << std::endl;
+            return -1;
+        }
+        std::cout << "Binary scenario saved: " << options["output"] << std::endl;
+        std::cout << std::endl;
+    }
+
+    if (scenario.empty())
+        return 0;
+
+    // Replay the scenario at full speed
+    size_t replays = std::max((size_t)1, (size_t)std::stoull(options["replays"]));
+    uint64_t total_time = 0;
+    uint64_t errors = 0;
+    size_t updates = 0;
+    std::cout << "Scenario replaying...";
+    for (size_t i = 0; i < replays; ++i)
+    {
+        MyMarketHandler market_handler;
+        MarketManager market(market_handler);
+        uint64_t timestamp_start = Timestamp::nano();
+        errors = scenario.Replay(market);
+        uint64_t timestamp_stop = Timestamp::nano();
+        total_time += timestamp_stop - timestamp_start;
+        updates = market_handler.updates();
+    }
+    std::cout << "Done!" << std::endl;
+
+    uint64_t commands = scenario.commands() * replays;
+    std::cout << "Failed commands: " << errors << std::endl;
+    std::cout << "Replay time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_time / replays) << std::endl;
+    std::cout << "Command latency (average): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_time / commands) << std::endl;
+    std::cout << "Command throughput: " << commands * 1000000000 / std::max(total_time, (uint64_t)1) << " cmd/s" << std::endl;
+    std::cout << "Market updates: " << updates << std::endl;
+    std::cout << "Market update throughput: " << updates * replays * 1000000000 / std::max(total_time, (uint64_t)1) << " upd/s" << std::endl;
+    std::cout << std::endl;
+
+    // Replay the scenario once more measuring each command (includes the timer overhead)
+    std::vector<uint64_t> latencies;
+    latencies.reserve(scenario.commands());
+    {
+        MyMarketHandler market_handler;
+        MarketManager market(market_handler);
+        for (const uint8_t* record = scenario.begin(); record != scenario.end(); record += record[0])
+        {
+            uint64_t timestamp_start = Timestamp::nano();
+            MarketJournal::ReplayRecord(record, market);
+            uint64_t timestamp_stop = Timestamp::nano();
+            latencies.push_back(timestamp_stop - timestamp_start);
+        }
+    }
+    ReportPercentiles(latencies);
+
+    return 0;
+}
@@ -0,0 +1,184 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "trader/matching/market_manager.h"
+
+#include "benchmark/reporter_console.h"
+#include "time/timestamp.h"
+
+#include <OptionParser.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _updates(0),
+          _trailing_updates(0)
+    {}
+
+    size_t updates() const { return _updates; }
+    size_t trailing_updates() const { return _trailing_updates; }
+
+protected:
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_updates; }
+    void onAddOrder(const Order& order) override { ++_updates; }
+    void onUpdateOrder(const Order& order) override { ++_updates; if (order.IsTrailingStop() || order.IsTrailingStopLimit()) ++_trailing_updates; }
+    void onDeleteOrder(const Order& order) override { ++_updates; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_updates; }
+
+private:
+    size_t _updates;
+    size_t _trailing_updates;
+};
+
+// Trade at the given price on both sides of the order book to move the trailing market prices
+void Trade(MarketManager& market, uint64_t& next_id, uint64_t ask, uint64_t bid)
+{
+    market.AddOrder(Order::SellLimit(next_id++, 0, ask, 2));
+    market.AddOrder(Order::BuyLimit(next_id++, 0, ask, 1));
+    market.AddOrder(Order::BuyLimit(next_id++, 0, bid, 2));
+    market.AddOrder(Order::SellLimit(next_id++, 0, bid, 1));
+}
+
+// Add the large population of trailing stop orders with mixed trailing distances and steps
+void AddTrailingStops(MarketManager& market, uint64_t& next_id, size_t count, uint64_t ask, uint64_t bid, uint64_t distances)
+{
+    std::mt19937 random(42);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t id = next_id++;
+        bool buy = (i % 2) == 0;
+        int64_t distance;
+        int64_t step;
+        switch (random() % 4)
+        {
+            case 0:
+                // Absolute trailing distance without the trailing step (repriced on each market price tick)
+                distance = 1 + random() % distances;
+                step = 0;
+                break;
+            case 1:
+                // Absolute trailing distance with the trailing step
+                distance = 1 + random() % distances;
+                step = random() % distance;
+                break;
+            default:
+                // Percentage trailing distance with the trailing step
+                distance = -(int64_t)(1 + random() % 1000);
+                step = -(int64_t)(random() % -distance);
+                break;
+        }
+        uint64_t stop_price = buy ? (ask + 1 + random() % (2 * distances)) : (bid - 1 - random() % (2 * distances));
+        if (random() % 2)
+            market.AddOrder(Order::TrailingStop(id, 0, buy ? OrderSide::BUY : OrderSide::SELL, stop_price, 100, distance, step));
+        else
+            market.AddOrder(Order::TrailingStopLimit(id, 0, buy ? OrderSide::BUY : OrderSide::SELL, stop_price, buy ? (stop_price + 10) : (stop_price - 10), 100, distance, step));
+    }
+}
+
+int main(int argc, char** argv)
+{
+    auto parser = optparse::OptionParser().version("1.0.0.0");
+
+    parser.add_option("-o", "--orders").dest("orders").help("Trailing stop orders count").set_default("100000");
+    parser.add_option("-d", "--distances").dest("distances").help("Maximal absolute trailing distance in price ticks").set_default("10000");
+    parser.add_option("-m", "--moves").dest("moves").help("Market price moves count").set_default("10000");
+    parser.add_option("-l", "--ladder").dest("ladder").help("Price ladder window size in ticks (0 to disable)").set_default("0");
+
+    optparse::Values options = parser.parse_args(argc, argv);
+
+    // Print help
+    if (options.get("help"))
+    {
+        parser.print_help();
+        return 0;
+    }
+
+    size_t orders = std::stoull(options["orders"]);
+    uint64_t distances = std::max<uint64_t>(std::stoull(options["distances"]), 1);
+    size_t moves = std::stoull(options["moves"]);
+    size_t ladder = std::stoull(options["ladder"]);
+
+    MyMarketHandler market_handler;
+    MarketManager market(market_handler);
+    if (ladder > 0)
+        market.EnablePriceLadder(1, ladder);
+
+    Symbol symbol(0, "TRAILING");
+    market.AddSymbol(symbol);
+    market.AddOrderBook(symbol);
+    market.EnableMatching();
+
+    // Keep the spread wide enough for the whole trend
+    uint64_t bid = 1000000000;
+    uint64_t ask = bid + 2 * moves + 2;
+    uint64_t next_id = 1;
+
+    Trade(market, next_id, ask, bid);
+
+    std::cout << "Trailing stop orders adding...";
+    AddTrailingStops(market, next_id, orders, ask, bid, distances);
+    std::cout << "Done!" << std::endl;
+
+    const OrderBook* order_book_ptr = market.GetOrderBook(0);
+    std::cout << "Trailing buy stop levels: " << order_book_ptr->trailing_buy_stop_size() << std::endl;
+    std::cout << "Trailing sell stop levels: " << order_book_ptr->trailing_sell_stop_size() << std::endl;
+    std::cout << std::endl;
+
+    // Trend the market price by one tick per move. It is the adversarial case
+    // for trailing stops: each move reprices every order without the trailing
+    // step and every order whose trailing step is passed.
+    std::vector<uint64_t> latencies;
+    latencies.reserve(moves);
+    size_t trailing_updates = market_handler.trailing_updates();
+
+    std::cout << "Market price trending...";
+    uint64_t total_time = 0;
+    for (size_t i = 0; i < moves; ++i)
+    {
+        --ask;
+        ++bid;
+
+        uint64_t timestamp_start = Timestamp::nano();
+        Trade(market, next_id, ask, bid);
+        uint64_t timestamp_stop = Timestamp::nano();
+
+        latencies.push_back(timestamp_stop - timestamp_start);
+        total_time += timestamp_stop - timestamp_start;
+    }
+    std::cout << "Done!" << std::endl;
+
+    trailing_updates = market_handler.trailing_updates() - trailing_updates;
+
+    std::cout << "Active orders: " << market.orders().size() << std::endl;
+    std::cout << "Trailing stop reprices: " << trailing_updates << std::endl;
+    std::cout << "Trend time: " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_time) << std::endl;
+    std::cout << "Market move latency (average): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(total_time / std::max<size_t>(moves, 1)) << std::endl;
+    std::cout << "Trailing stop reprice throughput: " << trailing_updates * 1000000000 / std::max(total_time, (uint64_t)1) << " ops/s" << std::endl;
+
+    if (!latencies.empty())
+    {
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&latencies](double p) { return latencies[std::min(latencies.size() - 1, (size_t)(p * latencies.size()))]; };
+
+        std::cout << "Market move latency (min): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(latencies.front()) << std::endl;
+        std::cout << "Market move latency (50%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.5)) << std::endl;
+        std::cout << "Market move latency (90%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.9)) << std::endl;
+        std::cout << "Market move latency (99%): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(percentile(0.99)) << std::endl;
+        std::cout << "Market move latency (max): " << CppBenchmark::ReporterConsole::GenerateTimePeriod(latencies.back()) << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,24 @@
+/*!
+    \file depth_publisher.cpp
+    \brief Depth publisher implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/depth_publisher.h"
+
+namespace CppTrader {
+namespace Matching {
+
+DepthPublisher::DepthPublisher(size_t depth, size_t buffers)
+    : _depth(depth),
+      _published(0),
+      _buffers((depth > 0) ? std::max(buffers, (size_t)2) : 1),
+      _levels(new std::atomic<uint64_t>[2 * _buffers.size() * depth * LEVEL_WORDS]()),
+      _current(0)
+{
+}
+
+} // namespace Matching
+} // namespace CppTrader
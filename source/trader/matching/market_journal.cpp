@@ -0,0 +1,407 @@
+/*!
+    \file market_journal.cpp
+    \brief Market journal implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_journal.h"
+
+#include <algorithm>
+#include <chrono>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace CppTrader {
+namespace Matching {
+
+namespace {
+
+// Allocate disk blocks of the journal file up to the given size, so group
+// commits do not allocate them and the file tail is read as zeros
+bool Preallocate(const CppCommon::Path& path, uint64_t offset, uint64_t size)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    // SetFileValidData() is not used, because it exposes stale disk data
+    // instead of zeros at the journal end
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    FILE_ALLOCATION_INFO info;
+    info.AllocationSize.QuadPart = (LONGLONG)(offset + size);
+    bool result = (SetFileInformationByHandle(file, FileAllocationInfo, &info, sizeof(info)) != 0);
+    CloseHandle(file);
+    return result;
+#else
+    int file = open(path.string().c_str(), O_WRONLY);
+    if (file < 0)
+        return false;
+#if defined(__APPLE__)
+    fstore_t store = { F_ALLOCATEALL, F_PEOFPOSMODE, 0, (off_t)size, 0 };
+    bool result = (fcntl(file, F_PREALLOCATE, &store) != -1);
+#else
+    bool result = (posix_fallocate(file, (off_t)offset, (off_t)size) == 0);
+#endif
+    close(file);
+    return result;
+#endif
+}
+
+// Check that only zeros are left in the buffer
+bool IsZero(const uint8_t* data, const uint8_t* end)
+{
+    return std::all_of(data, end, [](uint8_t value) { return value == 0; });
+}
+
+} // namespace
+
+MarketJournal::MarketJournal(MarketManager& market, const CppCommon::Path& path, uint64_t preallocate, uint64_t interval)
+    : _market(market),
+      _file(path),
+      _preallocate(preallocate),
+      _interval(interval),
+      _capacity(0),
+      _size(sizeof(JournalHeader)),
+      _appended(0),
+      _commit_requested(false),
+      _stop(false),
+      _committed(0),
+      _failed(false),
+      _offset(0)
+{
+    assert((preallocate > 0) && "Journal file preallocation size must be greater than zero!");
+
+    // Preallocate the journal file, so group commits do not extend it
+    _file.OpenOrCreate(false, true, true);
+    _capacity = _preallocate;
+    if (!Preallocate(_file.path(), 0, _capacity))
+        _failed = true;
+    _file.Resize(_capacity);
+    _file.Seek(0);
+
+    // Reserve the journal buffers for one preallocation chunk
+    _buffer.reserve(std::min(_preallocate, (uint64_t)(16 * 1024 * 1024)));
+    _commit_buffer.reserve(_buffer.capacity());
+
+    // The journal header is written with the first group commit
+    JournalHeader header = { JournalHeader::SIGNATURE, JournalHeader::VERSION };
+    _buffer.insert(_buffer.end(), (const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+
+    // Start the commit thread
+    _thread = CppCommon::Thread::Start([this]() { Committer(); });
+}
+
+MarketJournal::~MarketJournal()
+{
+    // Commit all appended records and stop the commit thread
+    {
+        std::lock_guard<std::mutex> locker(_mutex);
+        _stop = true;
+    }
+    _commit_request.notify_one();
+    _thread.join();
+
+    _file.Close();
+}
+
+ErrorCode MarketJournal::Commit()
+{
+    std::unique_lock<std::mutex> locker(_mutex);
+
+    uint64_t appended = _appended;
+    _commit_requested = true;
+    _commit_request.notify_one();
+    _commit_response.wait(locker, [this, appended]() { return (_committed.load(std::memory_order_acquire) >= appended) || _failed.load(std::memory_order_acquire); });
+
+    return failed() ? ErrorCode::JOURNAL_WRITE_FAILED : ErrorCode::OK;
+}
+
+void MarketJournal::Committer()
+{
+    std::unique_lock<std::mutex> locker(_mutex);
+    while (true)
+    {
+        // Wait for the commit request or the group commit interval
+        _commit_request.wait_for(locker, std::chrono::nanoseconds(_interval), [this]() { return _commit_requested || _stop; });
+        _commit_requested = false;
+
+        if (!_buffer.empty())
+        {
+            // Take all appended records as a single group
+            _commit_buffer.swap(_buffer);
+            uint64_t appended = _appended;
+
+            // Write and sync the group without the lock, so the journal could be appended meanwhile
+            locker.unlock();
+            bool success = !failed() && WriteAndSync(_commit_buffer);
+            _commit_buffer.clear();
+            locker.lock();
+
+            if (success)
+                _committed.store(appended, std::memory_order_release);
+            else
+                _failed.store(true, std::memory_order_release);
+        }
+
+        _commit_response.notify_all();
+
+        if (_stop && _buffer.empty())
+            break;
+    }
+}
+
+bool MarketJournal::WriteAndSync(const std::vector<uint8_t>& buffer)
+{
+    try
+    {
+        // Extend the journal file with another preallocation chunk
+        if ((_offset + buffer.size()) > _capacity)
+        {
+            uint64_t capacity = _capacity;
+            while ((_offset + buffer.size()) > capacity)
+                capacity += _preallocate;
+            if (!Preallocate(_file.path(), _capacity, capacity - _capacity))
+                return false;
+            _capacity = capacity;
+            _file.Resize(_capacity);
+            _file.Seek(_offset);
+        }
+
+        if (_file.Write(buffer.data(), buffer.size()) != buffer.size())
+            return false;
+        _offset += buffer.size();
+
+        return _file.Flush();
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+ErrorCode MarketJournal::Replay(const void* buffer, size_t size, MarketManager& market, uint64_t& records)
+{
+    records = 0;
+
+    const uint8_t* data = (const uint8_t*)buffer;
+    const uint8_t* end = data + size;
+
+    // Validate the journal header
+    if (!ReadHeader(data, end))
+        return ErrorCode::JOURNAL_INVALID;
+
+    bool finished = false;
+    ErrorCode result = ReplayRecords(data, end, market, records, finished);
+    if (result != ErrorCode::OK)
+        return result;
+
+    // Only zeros could follow the end of the journal
+    if (finished && !IsZero(data, end))
+        return ErrorCode::JOURNAL_INVALID;
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketJournal::Replay(const CppCommon::Path& path, MarketManager& market, uint64_t& records)
+{
+    records = 0;
+
+    CppCommon::File file(path);
+    file.Open(true, false);
+
+    // Read the journal file by chunks and stop at the end of the journal
+    // instead of reading the whole preallocated journal file
+    std::vector<uint8_t> buffer(REPLAY_BUFFER_SIZE);
+    size_t pending = 0;
+    bool header = false;
+    bool finished = false;
+    while (true)
+    {
+        size_t size = file.Read(buffer.data() + pending, buffer.size() - pending);
+        if (size == 0)
+            break;
+        pending += size;
+
+        const uint8_t* data = buffer.data();
+        const uint8_t* end = data + pending;
+
+        // Validate the journal header
+        if (!header)
+        {
+            if (pending < sizeof(JournalHeader))
+                continue;
+            if (!ReadHeader(data, end))
+                return ErrorCode::JOURNAL_INVALID;
+            header = true;
+        }
+
+        if (!finished)
+        {
+            ErrorCode result = ReplayRecords(data, end, market, records, finished);
+            if (result != ErrorCode::OK)
+                return result;
+        }
+
+        // Only zeros could follow the end of the journal up to the end of the preallocated file
+        if (finished)
+        {
+            if (!IsZero(data, end))
+                return ErrorCode::JOURNAL_INVALID;
+            pending = 0;
+            continue;
+        }
+
+        // Move the incomplete record to the buffer start
+        pending = end - data;
+        std::memmove(buffer.data(), data, pending);
+    }
+
+    return header ? ErrorCode::OK : ErrorCode::JOURNAL_INVALID;
+}
+
+bool MarketJournal::ReadHeader(const uint8_t*& data, const uint8_t* end)
+{
+    JournalHeader header;
+    if ((size_t)(end - data) < sizeof(header))
+        return false;
+    std::memcpy(&header, data, sizeof(header));
+    if ((header.Signature != JournalHeader::SIGNATURE) || (header.Version != JournalHeader::VERSION))
+        return false;
+    data += sizeof(header);
+    return true;
+}
+
+ErrorCode MarketJournal::ReplayRecords(const uint8_t*& data, const uint8_t* end, MarketManager& market, uint64_t& records, bool& finished)
+{
+    while ((end - data) >= (ptrdiff_t)sizeof(JournalRecord))
+    {
+        // Zero record size marks the end of the preallocated journal
+        size_t record_size = data[0];
+        if (record_size == 0)
+        {
+            finished = true;
+            break;
+        }
+        if (record_size < sizeof(JournalRecord))
+            return ErrorCode::JOURNAL_INVALID;
+
+        // Incomplete record could be continued in the next buffer
+        if ((size_t)(end - data) < record_size)
+            break;
+
+        // Broken checksum marks the torn write of the last group commit,
+        // so the caller checks that only zeros follow the broken record
+        uint16_t checksum;
+        std::memcpy(&checksum, data + 2, sizeof(checksum));
+        if (checksum != JournalRecord::CalculateChecksum(data, record_size))
+        {
+            data += record_size;
+            finished = true;
+            break;
+        }
+
+        // Failed commands fail in the same way as when they were journaled
+        if (ReplayRecord(data, market) == ErrorCode::JOURNAL_INVALID)
+            return ErrorCode::JOURNAL_INVALID;
+
+        data += record_size;
+        ++records;
+    }
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketJournal::ReplayRecord(const uint8_t* data, MarketManager& market)
+{
+    Symbol symbol;
+    Order order;
+    uint32_t symbol_id;
+    uint64_t fields[4];
+
+    const uint8_t* record = data + sizeof(JournalRecord);
+    size_t fields_size = data[0] - sizeof(JournalRecord);
+
+    switch ((JournalRecordType)data[1])
+    {
+        case JournalRecordType::ADD_SYMBOL:
+        case JournalRecordType::ADD_ORDER_BOOK:
+            if (fields_size != sizeof(symbol))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(&symbol, record, sizeof(symbol));
+            if ((JournalRecordType)data[1] == JournalRecordType::ADD_SYMBOL)
+                return market.AddSymbol(symbol);
+            else
+                return market.AddOrderBook(symbol);
+        case JournalRecordType::DELETE_SYMBOL:
+        case JournalRecordType::DELETE_ORDER_BOOK:
+            if (fields_size != sizeof(symbol_id))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(&symbol_id, record, sizeof(symbol_id));
+            if ((JournalRecordType)data[1] == JournalRecordType::DELETE_SYMBOL)
+                return market.DeleteSymbol(symbol_id);
+            else
+                return market.DeleteOrderBook(symbol_id);
+        case JournalRecordType::ADD_ORDER:
+            if (fields_size != sizeof(order))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(&order, record, sizeof(order));
+            return market.AddOrder(order);
+        case JournalRecordType::REPLACE_ORDER_WITH_ORDER:
+            if (fields_size != (sizeof(uint64_t) + sizeof(order)))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(fields, record, sizeof(uint64_t));
+            std::memcpy(&order, record + sizeof(uint64_t), sizeof(order));
+            return market.ReplaceOrder(fields[0], order);
+        case JournalRecordType::DELETE_ORDER:
+            if (fields_size != sizeof(uint64_t))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(fields, record, fields_size);
+            return market.DeleteOrder(fields[0]);
+        case JournalRecordType::REDUCE_ORDER:
+        case JournalRecordType::EXECUTE_ORDER:
+            if (fields_size != (2 * sizeof(uint64_t)))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(fields, record, fields_size);
+            if ((JournalRecordType)data[1] == JournalRecordType::REDUCE_ORDER)
+                return market.ReduceOrder(fields[0], fields[1]);
+            else
+                return market.ExecuteOrder(fields[0], fields[1]);
+        case JournalRecordType::MODIFY_ORDER:
+        case JournalRecordType::MITIGATE_ORDER:
+        case JournalRecordType::EXECUTE_ORDER_AT_PRICE:
+            if (fields_size != (3 * sizeof(uint64_t)))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(fields, record, fields_size);
+            if ((JournalRecordType)data[1] == JournalRecordType::MODIFY_ORDER)
+                return market.ModifyOrder(fields[0], fields[1], fields[2]);
+            else if ((JournalRecordType)data[1] == JournalRecordType::MITIGATE_ORDER)
+                return market.MitigateOrder(fields[0], fields[1], fields[2]);
+            else
+                return market.ExecuteOrder(fields[0], fields[1], fields[2]);
+        case JournalRecordType::REPLACE_ORDER:
+            if (fields_size != (4 * sizeof(uint64_t)))
+                return ErrorCode::JOURNAL_INVALID;
+            std::memcpy(fields, record, fields_size);
+            return market.ReplaceOrder(fields[0], fields[1], fields[2], fields[3]);
+        case JournalRecordType::ENABLE_MATCHING:
+            market.EnableMatching();
+            return ErrorCode::OK;
+        case JournalRecordType::DISABLE_MATCHING:
+            market.DisableMatching();
+            return ErrorCode::OK;
+        case JournalRecordType::MATCH:
+            market.Match();
+            return ErrorCode::OK;
+        default:
+            return ErrorCode::JOURNAL_INVALID;
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,424 @@
+/*!
+    \file market_manager_optimized.cpp
+    \brief Optimized market manager implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_manager_optimized.h"
+
+#include <algorithm>
+
+namespace CppTrader {
+namespace Matching {
+
+MarketHandlerOptimized MarketManagerOptimized::_default;
+
+MarketManagerOptimized::~MarketManagerOptimized()
+{
+    // Release orders
+    _orders.clear();
+
+    // Release order books
+    for (auto order_book_ptr : _order_books)
+        if (order_book_ptr != nullptr)
+            _order_book_pool.Release(order_book_ptr);
+    _order_books.clear();
+
+    // Release symbols
+    for (auto symbol_ptr : _symbols)
+        if (symbol_ptr != nullptr)
+            _symbol_pool.Release(symbol_ptr);
+    _symbols.clear();
+}
+
+void MarketManagerOptimized::Reserve(size_t symbols, size_t levels, size_t orders)
+{
+    // Reserve symbols and order books containers
+    if (_symbols.size() <= symbols)
+        _symbols.resize(symbols + 1, nullptr);
+    if (_order_books.size() <= symbols)
+        _order_books.resize(symbols + 1, nullptr);
+
+    // Reserve price levels pool
+    _levels.Reserve(levels);
+
+    // Reserve orders container
+    if (_orders.size() <= orders)
+        _orders.resize(orders + 1);
+}
+
+ErrorCode MarketManagerOptimized::AddSymbol(const Symbol& symbol)
+{
+    // Resize the symbol container
+    if (_symbols.size() <= symbol.Id)
+        _symbols.resize(symbol.Id + 1, nullptr);
+
+    // Insert the symbol
+    assert((_symbols[symbol.Id] == nullptr) && "Duplicate symbol detected!");
+    if (_symbols[symbol.Id] != nullptr)
+        return ErrorCode::SYMBOL_DUPLICATE;
+
+    // Create a new symbol
+    Symbol* symbol_ptr = _symbol_pool.Create(symbol);
+    _symbols[symbol.Id] = symbol_ptr;
+
+    // Call the corresponding handler
+    _market_handler.onAddSymbol(*symbol_ptr);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::DeleteSymbol(uint32_t id)
+{
+    assert(((id < _symbols.size()) && (_symbols[id] != nullptr)) && "Symbol not found!");
+    if ((_symbols.size() <= id) || (_symbols[id] == nullptr))
+        return ErrorCode::SYMBOL_NOT_FOUND;
+
+    // Get the symbol by Id
+    Symbol* symbol_ptr = _symbols[id];
+
+    // Call the corresponding handler
+    _market_handler.onDeleteSymbol(*symbol_ptr);
+
+    // Erase the symbol
+    _symbols[id] = nullptr;
+
+    // Release the symbol
+    _symbol_pool.Release(symbol_ptr);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::AddOrderBook(const Symbol& symbol)
+{
+    assert(((symbol.Id < _symbols.size()) && (_symbols[symbol.Id] != nullptr)) && "Symbol not found!");
+    if ((_symbols.size() <= symbol.Id) || (_symbols[symbol.Id] == nullptr))
+        return ErrorCode::SYMBOL_NOT_FOUND;
+
+    // Resize the order book container
+    if (_order_books.size() <= symbol.Id)
+        _order_books.resize(symbol.Id + 1, nullptr);
+
+    // Insert the order book
+    assert((_order_books[symbol.Id] == nullptr) && "Duplicate order book detected!");
+    if (_order_books[symbol.Id] != nullptr)
+        return ErrorCode::ORDER_BOOK_DUPLICATE;
+
+    // Create a new order book
+    OrderBookOptimized* order_book_ptr = _order_book_pool.Create(_levels, *_symbols[symbol.Id]);
+    _order_books[symbol.Id] = order_book_ptr;
+
+    // Call the corresponding handler
+    _market_handler.onAddOrderBook(*order_book_ptr);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::DeleteOrderBook(uint32_t id)
+{
+    assert(((id < _order_books.size()) && (_order_books[id] != nullptr)) && "Order book not found!");
+    if ((_order_books.size() <= id) || (_order_books[id] == nullptr))
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Get the order book by Id
+    OrderBookOptimized* order_book_ptr = _order_books[id];
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrderBook(*order_book_ptr);
+
+    // Erase the order book
+    _order_books[id] = nullptr;
+
+    // Release the order book
+    _order_book_pool.Release(order_book_ptr);
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::AddOrder(uint64_t id, uint32_t symbol, OrderSide side, uint64_t price, uint64_t quantity)
+{
+    // Validate order parameters
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the valid order book for the order
+    OrderBookOptimized* order_book_ptr = (OrderBookOptimized*)GetOrderBook(symbol);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Insert the order
+    OrderOptimized* order_ptr = InsertOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_DUPLICATE;
+    *order_ptr = OrderOptimized(id, symbol, side, price, quantity);
+
+    // Call the corresponding handler
+    _market_handler.onAddOrder(*order_ptr);
+
+    // Add the new order into the order book
+    UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::ReduceOrder(uint64_t id, uint64_t quantity)
+{
+    // Validate parameters
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to reduce
+    OrderOptimized* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBookOptimized* order_book_ptr = (OrderBookOptimized*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Calculate the minimal possible order quantity to reduce
+    quantity = std::min(quantity, order_ptr->Quantity);
+
+    // Reduce the order quantity
+    order_ptr->Quantity -= quantity;
+
+    // Reduce the order in the order book
+    UpdateLevel(*order_book_ptr, order_book_ptr->ReduceOrder(order_ptr, quantity));
+
+    // Update the order or delete the empty order
+    if (order_ptr->Quantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Erase the order
+        order_ptr->Id = 0;
+    }
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::ModifyOrder(uint64_t id, uint64_t new_price, uint64_t new_quantity)
+{
+    // Validate parameters
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+
+    // Get the order to modify
+    OrderOptimized* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBookOptimized* order_book_ptr = (OrderBookOptimized*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Delete the order from the order book
+    UpdateLevel(*order_book_ptr, order_book_ptr->DeleteOrder(order_ptr));
+
+    // Modify the order
+    order_ptr->Price = new_price;
+    order_ptr->Quantity = new_quantity;
+
+    // Update the order or delete the empty order
+    if (order_ptr->Quantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+
+        // Add the modified order into the order book
+        UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(order_ptr));
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Erase the order
+        order_ptr->Id = 0;
+    }
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::ReplaceOrder(uint64_t id, uint64_t new_id, uint64_t new_price, uint64_t new_quantity)
+{
+    // Validate parameters
+    if ((id == 0) || (new_id == 0))
+        return ErrorCode::ORDER_ID_INVALID;
+
+    // Get the order to replace
+    OrderOptimized* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Check for the duplicate replacement order
+    if (FindOrder(new_id) != nullptr)
+        return ErrorCode::ORDER_DUPLICATE;
+
+    // Get the valid order book for the order
+    OrderBookOptimized* order_book_ptr = (OrderBookOptimized*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Delete the old order from the order book
+    UpdateLevel(*order_book_ptr, order_book_ptr->DeleteOrder(order_ptr));
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the old order
+    uint32_t symbol = order_ptr->SymbolId;
+    OrderSide side = order_ptr->Side;
+    order_ptr->Id = 0;
+
+    if (new_quantity > 0)
+    {
+        // Insert the replacement order (old order pointer is not valid anymore)
+        OrderOptimized* new_order_ptr = InsertOrder(new_id);
+        *new_order_ptr = OrderOptimized(new_id, symbol, side, new_price, new_quantity);
+
+        // Call the corresponding handler
+        _market_handler.onAddOrder(*new_order_ptr);
+
+        // Add the replacement order into the order book
+        UpdateLevel(*order_book_ptr, order_book_ptr->AddOrder(new_order_ptr));
+    }
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::DeleteOrder(uint64_t id)
+{
+    // Validate parameters
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+
+    // Get the order to delete
+    OrderOptimized* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBookOptimized* order_book_ptr = (OrderBookOptimized*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Delete the order from the order book
+    UpdateLevel(*order_book_ptr, order_book_ptr->DeleteOrder(order_ptr));
+
+    // Call the corresponding handler
+    _market_handler.onDeleteOrder(*order_ptr);
+
+    // Erase the order
+    order_ptr->Id = 0;
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketManagerOptimized::ExecuteOrder(uint64_t id, uint64_t quantity)
+{
+    const OrderOptimized* order_ptr = GetOrder(id);
+    if (order_ptr == nullptr)
+        return (id == 0) ? ErrorCode::ORDER_ID_INVALID : ErrorCode::ORDER_NOT_FOUND;
+
+    return ExecuteOrder(id, order_ptr->Price, quantity);
+}
+
+ErrorCode MarketManagerOptimized::ExecuteOrder(uint64_t id, uint64_t price, uint64_t quantity)
+{
+    // Validate parameters
+    if (id == 0)
+        return ErrorCode::ORDER_ID_INVALID;
+    if (quantity == 0)
+        return ErrorCode::ORDER_QUANTITY_INVALID;
+
+    // Get the order to execute
+    OrderOptimized* order_ptr = FindOrder(id);
+    if (order_ptr == nullptr)
+        return ErrorCode::ORDER_NOT_FOUND;
+
+    // Get the valid order book for the order
+    OrderBookOptimized* order_book_ptr = (OrderBookOptimized*)GetOrderBook(order_ptr->SymbolId);
+    if (order_book_ptr == nullptr)
+        return ErrorCode::ORDER_BOOK_NOT_FOUND;
+
+    // Calculate the minimal possible order quantity to execute
+    quantity = std::min(quantity, order_ptr->Quantity);
+
+    // Call the corresponding handler
+    _market_handler.onExecuteOrder(*order_ptr, price, quantity);
+
+    // Reduce the order quantity
+    order_ptr->Quantity -= quantity;
+
+    // Reduce the order in the order book
+    UpdateLevel(*order_book_ptr, order_book_ptr->ReduceOrder(order_ptr, quantity));
+
+    // Update the order or delete the empty order
+    if (order_ptr->Quantity > 0)
+    {
+        // Call the corresponding handler
+        _market_handler.onUpdateOrder(*order_ptr);
+    }
+    else
+    {
+        // Call the corresponding handler
+        _market_handler.onDeleteOrder(*order_ptr);
+
+        // Erase the order
+        order_ptr->Id = 0;
+    }
+
+    return ErrorCode::OK;
+}
+
+OrderOptimized* MarketManagerOptimized::InsertOrder(uint64_t id)
+{
+    // Resize the orders container
+    if (_orders.size() <= id)
+        _orders.resize(std::max((size_t)id + 1, 2 * _orders.size()));
+
+    // Check for the duplicate order
+    OrderOptimized* order_ptr = &_orders[id];
+    assert((order_ptr->Id == 0) && "Duplicate order detected!");
+    if (order_ptr->Id != 0)
+        return nullptr;
+
+    return order_ptr;
+}
+
+void MarketManagerOptimized::UpdateLevel(const OrderBookOptimized& order_book, const LevelUpdate& update) const
+{
+    switch (update.Type)
+    {
+        case UpdateType::ADD:
+            _market_handler.onAddLevel(order_book, update.Update, update.Top);
+            break;
+        case UpdateType::UPDATE:
+            _market_handler.onUpdateLevel(order_book, update.Update, update.Top);
+            break;
+        case UpdateType::DELETE:
+            _market_handler.onDeleteLevel(order_book, update.Update, update.Top);
+            break;
+        default:
+            break;
+    }
+    _market_handler.onUpdateOrderBook(order_book, update.Top);
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,88 @@
+/*!
+    \file market_manager_sharded.cpp
+    \brief Sharded market manager implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_manager_sharded.h"
+
+#include <stdexcept>
+
+namespace CppTrader {
+namespace Matching {
+
+MarketManagerSharded::MarketManagerSharded(const std::vector<MarketHandler*>& market_handlers, bool matching, size_t queue_capacity)
+    : _stop(false)
+{
+    // Shards are found by the symbol Id modulo shards count
+    if (market_handlers.empty())
+        throw std::invalid_argument("At least one shard market handler must be provided!");
+
+    _shards.reserve(market_handlers.size());
+    for (auto market_handler : market_handlers)
+    {
+        _shards.emplace_back(std::make_unique<Shard>(*market_handler, queue_capacity));
+        if (matching)
+            _shards.back()->Market.EnableMatching();
+    }
+
+    // Start shard worker threads
+    try
+    {
+        for (auto& shard : _shards)
+            shard->Thread = CppCommon::Thread::Start([this, &shard]() { Worker(*shard); });
+    }
+    catch (...)
+    {
+        // Stop already started shard worker threads
+        Stop();
+        throw;
+    }
+}
+
+MarketManagerSharded::~MarketManagerSharded()
+{
+    // Process all submitted commands
+    Wait();
+
+    // Stop shard worker threads
+    Stop();
+}
+
+void MarketManagerSharded::Stop()
+{
+    _stop.store(true, std::memory_order_release);
+    for (auto& shard : _shards)
+        if (shard->Thread.joinable())
+            shard->Thread.join();
+}
+
+void MarketManagerSharded::Wait() const
+{
+    for (const auto& shard : _shards)
+        while (shard->Processed.load(std::memory_order_acquire) < shard->Submitted)
+            CppCommon::Thread::Yield();
+}
+
+void MarketManagerSharded::Worker(Shard& shard)
+{
+    MarketCommand command;
+    while (true)
+    {
+        if (shard.Queue.Dequeue(command))
+        {
+            if (shard.Market.ProcessCommand(command) != ErrorCode::OK)
+                shard.Errors.fetch_add(1, std::memory_order_relaxed);
+            shard.Processed.store(shard.Processed.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+        else if (_stop.load(std::memory_order_acquire))
+            break;
+        else
+            CppCommon::Thread::Yield();
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,246 @@
+/*!
+    \file market_scenario.cpp
+    \brief Market scenario implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/market_scenario.h"
+
+#include <algorithm>
+#include <cctype>
+#include <initializer_list>
+#include <limits>
+
+namespace CppTrader {
+namespace Matching {
+
+namespace {
+
+// Split the text command into words separated by whitespaces
+std::vector<std::string> Split(const std::string& command)
+{
+    std::vector<std::string> words;
+    size_t index = 0;
+    while (index < command.size())
+    {
+        while ((index < command.size()) && std::isspace((unsigned char)command[index]))
+            ++index;
+        size_t start = index;
+        while ((index < command.size()) && !std::isspace((unsigned char)command[index]))
+            ++index;
+        if (index > start)
+            words.emplace_back(command, start, index - start);
+    }
+    return words;
+}
+
+// Check the command prefix words and the total count of words
+bool MatchCommand(const std::vector<std::string>& words, std::initializer_list<const char*> prefix, size_t fields)
+{
+    if (words.size() != (prefix.size() + fields))
+        return false;
+
+    size_t index = 0;
+    for (auto word : prefix)
+        if (words[index++] != word)
+            return false;
+
+    return true;
+}
+
+// Parse the decimal number word
+bool ParseNumber(const std::string& word, uint64_t& value)
+{
+    value = 0;
+    for (char ch : word)
+    {
+        if ((ch < '0') || (ch > '9'))
+            return false;
+        uint64_t digit = ch - '0';
+        if (value > ((std::numeric_limits<uint64_t>::max() - digit) / 10))
+            return false;
+        value = value * 10 + digit;
+    }
+    return !word.empty();
+}
+
+// Parse decimal number words starting from the given index
+bool ParseNumbers(const std::vector<std::string>& words, size_t index, uint64_t* values)
+{
+    for (size_t i = index; i < words.size(); ++i)
+        if (!ParseNumber(words[i], values[i - index]))
+            return false;
+    return true;
+}
+
+// Parse the order side word
+bool ParseSide(const std::string& word, OrderSide& side)
+{
+    if (word == "buy")
+        side = OrderSide::BUY;
+    else if (word == "sell")
+        side = OrderSide::SELL;
+    else
+        return false;
+    return true;
+}
+
+// Parse the order command with the side word followed by decimal numbers
+bool ParseOrder(const std::vector<std::string>& words, std::initializer_list<const char*> prefix, size_t fields, OrderSide& side, uint64_t* values)
+{
+    if (!MatchCommand(words, prefix, fields + 1) || !ParseSide(words[prefix.size()], side) || !ParseNumbers(words, prefix.size() + 1, values))
+        return false;
+
+    // Symbol Id is always the second order field
+    return (values[1] <= std::numeric_limits<uint32_t>::max());
+}
+
+} // namespace
+
+MarketScenario::MarketScenario() : _commands(0)
+{
+    Clear();
+}
+
+void MarketScenario::Clear()
+{
+    JournalHeader header = { JournalHeader::SIGNATURE, JournalHeader::VERSION };
+    _buffer.assign((const uint8_t*)&header, (const uint8_t*)&header + sizeof(header));
+    _commands = 0;
+}
+
+ErrorCode MarketScenario::Parse(const std::string& command)
+{
+    std::vector<std::string> words = Split(command);
+
+    // Skip empty lines and comments
+    if (words.empty() || (words.front()[0] == '#'))
+        return ErrorCode::OK;
+
+    OrderSide side;
+    uint64_t values[7];
+
+    if (MatchCommand(words, { "enable", "matching" }, 0))
+        EnableMatching();
+    else if (MatchCommand(words, { "disable", "matching" }, 0))
+        DisableMatching();
+    else if (MatchCommand(words, { "add", "symbol" }, 2) && ParseNumber(words[2], values[0]) && (values[0] <= std::numeric_limits<uint32_t>::max()))
+    {
+        char name[8] = { 0 };
+        std::memcpy(name, words[3].data(), std::min(words[3].size(), sizeof(name)));
+        AddSymbol(Symbol((uint32_t)values[0], name));
+    }
+    else if (MatchCommand(words, { "delete", "symbol" }, 1) && ParseNumbers(words, 2, values) && (values[0] <= std::numeric_limits<uint32_t>::max()))
+        DeleteSymbol((uint32_t)values[0]);
+    else if (MatchCommand(words, { "add", "book" }, 1) && ParseNumbers(words, 2, values) && (values[0] <= std::numeric_limits<uint32_t>::max()))
+    {
+        char name[8] = { 0 };
+        AddOrderBook(Symbol((uint32_t)values[0], name));
+    }
+    else if (MatchCommand(words, { "delete", "book" }, 1) && ParseNumbers(words, 2, values) && (values[0] <= std::numeric_limits<uint32_t>::max()))
+        DeleteOrderBook((uint32_t)values[0]);
+    else if (ParseOrder(words, { "add", "market" }, 3, side, values))
+        AddOrder(Order::Market(values[0], (uint32_t)values[1], side, values[2]));
+    else if (ParseOrder(words, { "add", "slippage", "market" }, 4, side, values))
+        AddOrder(Order::Market(values[0], (uint32_t)values[1], side, values[2], values[3]));
+    else if (ParseOrder(words, { "add", "limit" }, 4, side, values))
+        AddOrder(Order::Limit(values[0], (uint32_t)values[1], side, values[2], values[3]));
+    else if (ParseOrder(words, { "add", "ioc", "limit" }, 4, side, values))
+        AddOrder(Order::Limit(values[0], (uint32_t)values[1], side, values[2], values[3], OrderTimeInForce::IOC));
+    else if (ParseOrder(words, { "add", "fok", "limit" }, 4, side, values))
+        AddOrder(Order::Limit(values[0], (uint32_t)values[1], side, values[2], values[3], OrderTimeInForce::FOK));
+    else if (ParseOrder(words, { "add", "aon", "limit" }, 4, side, values))
+        AddOrder(Order::Limit(values[0], (uint32_t)values[1], side, values[2], values[3], OrderTimeInForce::AON));
+    else if (ParseOrder(words, { "add", "stop" }, 4, side, values))
+        AddOrder(Order::Stop(values[0], (uint32_t)values[1], side, values[2], values[3]));
+    else if (ParseOrder(words, { "add", "stop-limit" }, 5, side, values))
+        AddOrder(Order::StopLimit(values[0], (uint32_t)values[1], side, values[2], values[3], values[4]));
+    else if (ParseOrder(words, { "add", "trailing", "stop" }, 6, side, values) && (values[4] <= (uint64_t)std::numeric_limits<int64_t>::max()) && (values[5] <= (uint64_t)std::numeric_limits<int64_t>::max()))
+        AddOrder(Order::TrailingStop(values[0], (uint32_t)values[1], side, values[2], values[3], (int64_t)values[4], (int64_t)values[5]));
+    else if (ParseOrder(words, { "add", "trailing", "stop-limit" }, 7, side, values) && (values[5] <= (uint64_t)std::numeric_limits<int64_t>::max()) && (values[6] <= (uint64_t)std::numeric_limits<int64_t>::max()))
+        AddOrder(Order::TrailingStopLimit(values[0], (uint32_t)values[1], side, values[2], values[3], values[4], (int64_t)values[5], (int64_t)values[6]));
+    else if (MatchCommand(words, { "reduce", "order" }, 2) && ParseNumbers(words, 2, values))
+        ReduceOrder(values[0], values[1]);
+    else if (MatchCommand(words, { "modify", "order" }, 3) && ParseNumbers(words, 2, values))
+        ModifyOrder(values[0], values[1], values[2]);
+    else if (MatchCommand(words, { "mitigate", "order" }, 3) && ParseNumbers(words, 2, values))
+        MitigateOrder(values[0], values[1], values[2]);
+    else if (MatchCommand(words, { "replace", "order" }, 4) && ParseNumbers(words, 2, values))
+        ReplaceOrder(values[0], values[1], values[2], values[3]);
+    else if (MatchCommand(words, { "delete", "order" }, 1) && ParseNumbers(words, 2, values))
+        DeleteOrder(values[0]);
+    else if (MatchCommand(words, { "execute", "order" }, 3) && ParseNumbers(words, 2, values))
+    {
+        if (values[1] == 0)
+            ExecuteOrder(values[0], values[2]);
+        else
+            ExecuteOrder(values[0], values[1], values[2]);
+    }
+    else
+        return ErrorCode::SCENARIO_INVALID;
+
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketScenario::Load(const void* buffer, size_t size)
+{
+    Clear();
+
+    const uint8_t* data = (const uint8_t*)buffer;
+    const uint8_t* end = data + size;
+
+    // Validate the journal header
+    JournalHeader header;
+    if (size < sizeof(header))
+        return ErrorCode::JOURNAL_INVALID;
+    std::memcpy(&header, data, sizeof(header));
+    if ((header.Signature != JournalHeader::SIGNATURE) || (header.Version != JournalHeader::VERSION))
+        return ErrorCode::JOURNAL_INVALID;
+    data += sizeof(header);
+
+    // Find the end of the journal
+    const uint8_t* start = data;
+    uint64_t commands = 0;
+    while ((end - data) >= (ptrdiff_t)sizeof(JournalRecord))
+    {
+        size_t record_size = data[0];
+        if ((record_size < sizeof(JournalRecord)) || ((size_t)(end - data) < record_size))
+            break;
+
+        uint16_t checksum;
+        std::memcpy(&checksum, data + 2, sizeof(checksum));
+        if (checksum != JournalRecord::CalculateChecksum(data, record_size))
+            break;
+
+        data += record_size;
+        ++commands;
+    }
+
+    _buffer.insert(_buffer.end(), start, data);
+    _commands = commands;
+    return ErrorCode::OK;
+}
+
+ErrorCode MarketScenario::Save(CppCommon::Writer& writer) const
+{
+    if (writer.Write(_buffer.data(), _buffer.size()) != _buffer.size())
+        return ErrorCode::JOURNAL_WRITE_FAILED;
+    if (!writer.Flush())
+        return ErrorCode::JOURNAL_WRITE_FAILED;
+
+    return ErrorCode::OK;
+}
+
+uint64_t MarketScenario::Replay(MarketManager& market) const
+{
+    uint64_t errors = 0;
+    for (const uint8_t* record = begin(); record != end(); record += record[0])
+        if (MarketJournal::ReplayRecord(record, market) != ErrorCode::OK)
+            ++errors;
+    return errors;
+}
+
+} // namespace Matching
+} // namespace CppTrader
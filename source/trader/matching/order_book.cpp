@@ -6,61 +6,129 @@
     \copyright MIT License
 */
 
-#include "trader/matching/market_manager.h"
 #include "trader/matching/order_book.h"
 
 namespace CppTrader {
 namespace Matching {
 
-OrderBook::OrderBook(MarketManager& manager, const Symbol& symbol)
-    : _manager(manager),
+OrderBook::OrderBook(LevelAllocator& level_pool, const Symbol& symbol, const OrderBookOptions& options)
+    : _level_pool(level_pool),
       _symbol(symbol),
       _best_bid(nullptr),
       _best_ask(nullptr),
+      _bid_ladder(options.LadderTickSize, options.LadderTicks),
+      _ask_ladder(options.LadderTickSize, options.LadderTicks),
+      _depth(options.Depth),
+      _depth_changed(false),
+      _depth_publish_pending(false),
+      _depth_publisher(options.DepthPublication ? options.Depth : 0),
+      _volume_index(options.VolumeIndex),
+      _top_of_book(options.TopOfBook),
+      _last_trade_price(0),
       _best_buy_stop(nullptr),
       _best_sell_stop(nullptr),
+      _buy_stop_ladder(options.LadderTickSize, options.LadderTicks),
+      _sell_stop_ladder(options.LadderTickSize, options.LadderTicks),
       _best_trailing_buy_stop(nullptr),
       _best_trailing_sell_stop(nullptr),
+      _trailing_buy_stop_ladder(options.LadderTickSize, options.LadderTicks),
+      _trailing_sell_stop_ladder(options.LadderTickSize, options.LadderTicks),
       _last_bid_price(0),
       _last_ask_price(std::numeric_limits<uint64_t>::max()),
       _matching_bid_price(0),
       _matching_ask_price(std::numeric_limits<uint64_t>::max()),
+      _batch_bid_price(std::numeric_limits<uint64_t>::max()),
+      _batch_ask_price(0),
       _trailing_bid_price(0),
-      _trailing_ask_price(std::numeric_limits<uint64_t>::max())
+      _trailing_ask_price(std::numeric_limits<uint64_t>::max()),
+      _match_pending(false)
 {
+    // Reserve the depth arrays to avoid allocations on price level changes
+    _bid_depth.reserve(_depth + 1);
+    _ask_depth.reserve(_depth + 1);
+    _bid_depth_levels.reserve(_depth + 1);
+    _ask_depth_levels.reserve(_depth + 1);
 }
 
 OrderBook::~OrderBook()
 {
     // Release bid price levels
     for (auto& bid : _bids)
-        _manager._level_pool.Release(&bid);
+        _level_pool.Release(&bid);
     _bids.clear();
 
     // Release ask price levels
     for (auto& ask : _asks)
-        _manager._level_pool.Release(&ask);
+        _level_pool.Release(&ask);
     _asks.clear();
 
+    // Release bid price ladder levels
+    while (!_bid_ladder.empty())
+    {
+        LevelNode* level_ptr = _bid_ladder.Lowest();
+        _bid_ladder.Erase(level_ptr);
+        _level_pool.Release(level_ptr);
+    }
+
+    // Release ask price ladder levels
+    while (!_ask_ladder.empty())
+    {
+        LevelNode* level_ptr = _ask_ladder.Lowest();
+        _ask_ladder.Erase(level_ptr);
+        _level_pool.Release(level_ptr);
+    }
+
     // Release buy stop orders levels
     for (auto& buy_stop : _buy_stop)
-        _manager._level_pool.Release(&buy_stop);
+        _level_pool.Release(&buy_stop);
     _buy_stop.clear();
 
+    // Release buy stop orders price ladder levels
+    while (!_buy_stop_ladder.empty())
+    {
+        LevelNode* level_ptr = _buy_stop_ladder.Lowest();
+        _buy_stop_ladder.Erase(level_ptr);
+        _level_pool.Release(level_ptr);
+    }
+
     // Release sell stop orders levels
     for (auto& sell_stop : _sell_stop)
-        _manager._level_pool.Release(&sell_stop);
+        _level_pool.Release(&sell_stop);
     _sell_stop.clear();
 
+    // Release sell stop orders price ladder levels
+    while (!_sell_stop_ladder.empty())
+    {
+        LevelNode* level_ptr = _sell_stop_ladder.Lowest();
+        _sell_stop_ladder.Erase(level_ptr);
+        _level_pool.Release(level_ptr);
+    }
+
     // Release trailing buy stop orders levels
     for (auto& trailing_buy_stop : _trailing_buy_stop)
-        _manager._level_pool.Release(&trailing_buy_stop);
+        _level_pool.Release(&trailing_buy_stop);
     _trailing_buy_stop.clear();
 
+    // Release trailing buy stop orders price ladder levels
+    while (!_trailing_buy_stop_ladder.empty())
+    {
+        LevelNode* level_ptr = _trailing_buy_stop_ladder.Lowest();
+        _trailing_buy_stop_ladder.Erase(level_ptr);
+        _level_pool.Release(level_ptr);
+    }
+
     // Release trailing sell stop orders levels
     for (auto& trailing_sell_stop : _trailing_sell_stop)
-        _manager._level_pool.Release(&trailing_sell_stop);
+        _level_pool.Release(&trailing_sell_stop);
     _trailing_sell_stop.clear();
+
+    // Release trailing sell stop orders price ladder levels
+    while (!_trailing_sell_stop_ladder.empty())
+    {
+        LevelNode* level_ptr = _trailing_sell_stop_ladder.Lowest();
+        _trailing_sell_stop_ladder.Erase(level_ptr);
+        _level_pool.Release(level_ptr);
+    }
 }
 
 LevelNode* OrderBook::AddLevel(OrderNode* order_ptr)
@@ -70,10 +138,18 @@ LevelNode* OrderBook::AddLevel(OrderNode* order_ptr)
     if (order_ptr->IsBuy())
     {
         // Create a new price level
-        level_ptr = _manager._level_pool.Create(LevelType::BID, order_ptr->Price);
+        level_ptr = _level_pool.Create(LevelType::BID, order_ptr->Price);
+
+        // Move the bid price ladder window to the new best bid price level
+        if (_bid_ladder.enabled() && !_bid_ladder.IsInWindow(level_ptr->Price) && _bid_ladder.IsAligned(level_ptr->Price))
+            if (_bid_ladder.empty() || (level_ptr->Price > _best_bid->Price))
+                _bid_ladder.Rebase(level_ptr->Price, _bids);
 
-        // Insert the price level into the bid collection
-        _bids.insert(*level_ptr);
+        // Insert the price level into the bid price ladder or the bid collection
+        if (_bid_ladder.IsInWindow(level_ptr->Price))
+            _bid_ladder.Insert(level_ptr);
+        else
+            _bids.insert(*level_ptr);
 
         // Update the best bid price level
         if ((_best_bid == nullptr) || (level_ptr->Price > _best_bid->Price))
@@ -82,16 +158,27 @@ LevelNode* OrderBook::AddLevel(OrderNode* order_ptr)
     else
     {
         // Create a new price level
-        level_ptr = _manager._level_pool.Create(LevelType::ASK, order_ptr->Price);
+        level_ptr = _level_pool.Create(LevelType::ASK, order_ptr->Price);
 
-        // Insert the price level into the ask collection
-        _asks.insert(*level_ptr);
+        // Move the ask price ladder window to the new best ask price level
+        if (_ask_ladder.enabled() && !_ask_ladder.IsInWindow(level_ptr->Price) && _ask_ladder.IsAligned(level_ptr->Price))
+            if (_ask_ladder.empty() || (level_ptr->Price < _best_ask->Price))
+                _ask_ladder.Rebase(level_ptr->Price, _asks);
+
+        // Insert the price level into the ask price ladder or the ask collection
+        if (_ask_ladder.IsInWindow(level_ptr->Price))
+            _ask_ladder.Insert(level_ptr);
+        else
+            _asks.insert(*level_ptr);
 
         // Update the best ask price level
         if ((_best_ask == nullptr) || (level_ptr->Price < _best_ask->Price))
             _best_ask = level_ptr;
     }
 
+    // Add the price level to the depth
+    AddDepthLevel(level_ptr);
+
     return level_ptr;
 }
 
@@ -100,27 +187,46 @@ LevelNode* OrderBook::DeleteLevel(OrderNode* order_ptr)
     // Find the price level for the order
     LevelNode* level_ptr = order_ptr->Level;
 
+    // Delete the price level from the depth
+    DeleteDepthLevel(level_ptr);
+
     if (order_ptr->IsBuy())
     {
         // Update the best bid price level
         if (level_ptr == _best_bid)
-            _best_bid = (_best_bid->left != nullptr) ? _best_bid->left : ((_best_bid->parent != nullptr) ? _best_bid->parent : _best_bid->right);
-
-        // Erase the price level from the bid collection
-        _bids.erase(Levels::iterator(&_bids, level_ptr));
+        {
+            if (_bid_ladder.enabled())
+                _best_bid = GetNextLevel(_best_bid);
+            else
+                _best_bid = (_best_bid->left != nullptr) ? _best_bid->left : ((_best_bid->parent != nullptr) ? _best_bid->parent : _best_bid->right);
+        }
+
+        // Erase the price level from the bid price ladder or the bid collection
+        if (_bid_ladder.IsInWindow(level_ptr->Price))
+            _bid_ladder.Erase(level_ptr);
+        else
+            _bids.erase(Levels::iterator(&_bids, level_ptr));
     }
     else
     {
         // Update the best ask price level
         if (level_ptr == _best_ask)
-            _best_ask = (_best_ask->right != nullptr) ? _best_ask->right : ((_best_ask->parent != nullptr) ? _best_ask->parent : _best_ask->left);
-
-        // Erase the price level from the ask collection
-        _asks.erase(Levels::iterator(&_asks, level_ptr));
+        {
+            if (_ask_ladder.enabled())
+                _best_ask = GetNextLevel(_best_ask);
+            else
+                _best_ask = (_best_ask->right != nullptr) ? _best_ask->right : ((_best_ask->parent != nullptr) ? _best_ask->parent : _best_ask->left);
+        }
+
+        // Erase the price level from the ask price ladder or the ask collection
+        if (_ask_ladder.IsInWindow(level_ptr->Price))
+            _ask_ladder.Erase(level_ptr);
+        else
+            _asks.erase(Levels::iterator(&_asks, level_ptr));
     }
 
     // Release the price level
-    _manager._level_pool.Release(level_ptr);
+    _level_pool.Release(level_ptr);
 
     return nullptr;
 }
@@ -138,17 +244,15 @@ LevelUpdate OrderBook::AddOrder(OrderNode* order_ptr)
         update = UpdateType::ADD;
     }
 
-    // Update the price level volume
-    level_ptr->TotalVolume += order_ptr->LeavesQuantity;
-    level_ptr->HiddenVolume += order_ptr->HiddenQuantity();
-    level_ptr->VisibleVolume += order_ptr->VisibleQuantity();
+    // Link the new order to the price level
+    LinkOrder(level_ptr, order_ptr);
 
-    // Link the new order to the orders list of the price level
-    level_ptr->OrderList.push_back(*order_ptr);
-    ++level_ptr->Orders;
+    // Update the volume index
+    if (_volume_index)
+        (order_ptr->IsBuy() ? _bid_volume : _ask_volume).Add(level_ptr->Price, order_ptr->LeavesQuantity);
 
-    // Cache the price level in the given order
-    order_ptr->Level = level_ptr;
+    // Update the price level in the depth
+    UpdateDepthLevel(level_ptr);
 
     // Price level was changed. Return top of the book modification flag.
     return LevelUpdate(update, *order_ptr->Level, (order_ptr->Level == (order_ptr->IsBuy() ? _best_bid : _best_ask)));
@@ -166,6 +270,10 @@ LevelUpdate OrderBook::ReduceOrder(OrderNode* order_ptr, uint64_t quantity, uint
     level_ptr->HiddenVolume -= hidden;
     level_ptr->VisibleVolume -= visible;
 
+    // Update the volume index
+    if (_volume_index)
+        (order_ptr->IsBuy() ? _bid_volume : _ask_volume).Subtract(level_ptr->Price, quantity);
+
     // Unlink the empty order from the orders list of the price level
     if (order_ptr->LeavesQuantity == 0)
     {
@@ -183,6 +291,11 @@ LevelUpdate OrderBook::ReduceOrder(OrderNode* order_ptr, uint64_t quantity, uint
         order_ptr->Level = DeleteLevel(order_ptr);
         update = UpdateType::DELETE;
     }
+    else
+    {
+        // Update the price level in the depth
+        UpdateDepthLevel(level_ptr);
+    }
 
     // Price level was changed. Return top of the book modification flag.
     return LevelUpdate(update, level, top);
@@ -200,6 +313,10 @@ LevelUpdate OrderBook::DeleteOrder(OrderNode* order_ptr)
     level_ptr->HiddenVolume -= order_ptr->HiddenQuantity();
     level_ptr->VisibleVolume -= order_ptr->VisibleQuantity();
 
+    // Update the volume index
+    if (_volume_index)
+        (order_ptr->IsBuy() ? _bid_volume : _ask_volume).Subtract(level_ptr->Price, order_ptr->LeavesQuantity);
+
     // Unlink the empty order from the orders list of the price level
     level_ptr->OrderList.pop_current(*order_ptr);
     --level_ptr->Orders;
@@ -214,11 +331,99 @@ LevelUpdate OrderBook::DeleteOrder(OrderNode* order_ptr)
         order_ptr->Level = DeleteLevel(order_ptr);
         update = UpdateType::DELETE;
     }
+    else
+    {
+        // Update the price level in the depth
+        UpdateDepthLevel(level_ptr);
+    }
 
     // Price level was changed. Return top of the book modification flag.
     return LevelUpdate(update, level, top);
 }
 
+void OrderBook::AddDepthLevel(LevelNode* level_ptr)
+{
+    if (_depth == 0)
+        return;
+
+    bool bid = level_ptr->IsBid();
+    std::vector<Level>& depth = bid ? _bid_depth : _ask_depth;
+    std::vector<LevelNode*>& levels = bid ? _bid_depth_levels : _ask_depth_levels;
+
+    // Find the depth position of the new price level
+    size_t index = 0;
+    while ((index < levels.size()) && (bid ? (levels[index]->Price > level_ptr->Price) : (levels[index]->Price < level_ptr->Price)))
+        ++index;
+
+    // Skip price levels below the depth
+    if (index >= _depth)
+        return;
+
+    // Insert the new price level and drop the worst one from the full depth
+    _depth_changed = true;
+    depth.insert(depth.begin() + index, *level_ptr);
+    levels.insert(levels.begin() + index, level_ptr);
+    if (levels.size() > _depth)
+    {
+        depth.pop_back();
+        levels.pop_back();
+    }
+}
+
+void OrderBook::UpdateDepthLevel(const LevelNode* level_ptr)
+{
+    if (_depth == 0)
+        return;
+
+    bool bid = level_ptr->IsBid();
+    std::vector<Level>& depth = bid ? _bid_depth : _ask_depth;
+    const std::vector<LevelNode*>& levels = bid ? _bid_depth_levels : _ask_depth_levels;
+
+    for (size_t index = 0; index < levels.size(); ++index)
+    {
+        if (levels[index] == level_ptr)
+        {
+            depth[index] = *level_ptr;
+            _depth_changed = true;
+            return;
+        }
+    }
+}
+
+void OrderBook::DeleteDepthLevel(LevelNode* level_ptr)
+{
+    if (_depth == 0)
+        return;
+
+    bool bid = level_ptr->IsBid();
+    std::vector<Level>& depth = bid ? _bid_depth : _ask_depth;
+    std::vector<LevelNode*>& levels = bid ? _bid_depth_levels : _ask_depth_levels;
+
+    // Find the depth position of the deleted price level
+    auto it = std::find(levels.begin(), levels.end(), level_ptr);
+    if (it == levels.end())
+        return;
+
+    _depth_changed = true;
+    size_t index = it - levels.begin();
+    bool full = (levels.size() == _depth);
+    depth.erase(depth.begin() + index);
+    levels.erase(it);
+
+    // Refill the full depth with the next price level. The deleted price level
+    // is still linked into its container, so the next price level is found
+    // from it or from the last depth price level.
+    if (full)
+    {
+        LevelNode* next_ptr = GetNextLevel((index == levels.size()) ? level_ptr : levels.back());
+        if (next_ptr != nullptr)
+        {
+            depth.push_back(*next_ptr);
+            levels.push_back(next_ptr);
+        }
+    }
+}
+
 LevelNode* OrderBook::AddStopLevel(OrderNode* order_ptr)
 {
     LevelNode* level_ptr = nullptr;
@@ -226,10 +431,18 @@ LevelNode* OrderBook::AddStopLevel(OrderNode* order_ptr)
     if (order_ptr->IsBuy())
     {
         // Create a new price level
-        level_ptr = _manager._level_pool.Create(LevelType::ASK, order_ptr->StopPrice);
+        level_ptr = _level_pool.Create(LevelType::ASK, order_ptr->StopPrice);
+
+        // Move the buy stop price ladder window to the new best buy stop order price level
+        if (_buy_stop_ladder.enabled() && !_buy_stop_ladder.IsInWindow(level_ptr->Price) && _buy_stop_ladder.IsAligned(level_ptr->Price))
+            if (_buy_stop_ladder.empty() || (level_ptr->Price < _best_buy_stop->Price))
+                _buy_stop_ladder.Rebase(level_ptr->Price, _buy_stop);
 
-        // Insert the price level into the buy stop orders collection
-        _buy_stop.insert(*level_ptr);
+        // Insert the price level into the buy stop orders price ladder or the buy stop orders collection
+        if (_buy_stop_ladder.IsInWindow(level_ptr->Price))
+            _buy_stop_ladder.Insert(level_ptr);
+        else
+            _buy_stop.insert(*level_ptr);
 
         // Update the best buy stop order price level
         if ((_best_buy_stop == nullptr) || (level_ptr->Price < _best_buy_stop->Price))
@@ -238,10 +451,18 @@ LevelNode* OrderBook::AddStopLevel(OrderNode* order_ptr)
     else
     {
         // Create a new price level
-        level_ptr = _manager._level_pool.Create(LevelType::BID, order_ptr->StopPrice);
+        level_ptr = _level_pool.Create(LevelType::BID, order_ptr->StopPrice);
 
-        // Insert the price level into the sell stop orders collection
-        _sell_stop.insert(*level_ptr);
+        // Move the sell stop price ladder window to the new best sell stop order price level
+        if (_sell_stop_ladder.enabled() && !_sell_stop_ladder.IsInWindow(level_ptr->Price) && _sell_stop_ladder.IsAligned(level_ptr->Price))
+            if (_sell_stop_ladder.empty() || (level_ptr->Price > _best_sell_stop->Price))
+                _sell_stop_ladder.Rebase(level_ptr->Price, _sell_stop);
+
+        // Insert the price level into the sell stop orders price ladder or the sell stop orders collection
+        if (_sell_stop_ladder.IsInWindow(level_ptr->Price))
+            _sell_stop_ladder.Insert(level_ptr);
+        else
+            _sell_stop.insert(*level_ptr);
 
         // Update the best sell stop order price level
         if ((_best_sell_stop == nullptr) || (level_ptr->Price > _best_sell_stop->Price))
@@ -260,23 +481,39 @@ LevelNode* OrderBook::DeleteStopLevel(OrderNode* order_ptr)
     {
         // Update the best buy stop order price level
         if (level_ptr == _best_buy_stop)
-            _best_buy_stop = (_best_buy_stop->right != nullptr) ? _best_buy_stop->right : _best_buy_stop->parent;
-
-        // Erase the price level from the buy stop orders collection
-        _buy_stop.erase(Levels::iterator(&_buy_stop, level_ptr));
+        {
+            if (_buy_stop_ladder.enabled())
+                _best_buy_stop = GetNextStopLevel(_best_buy_stop);
+            else
+                _best_buy_stop = (_best_buy_stop->right != nullptr) ? _best_buy_stop->right : _best_buy_stop->parent;
+        }
+
+        // Erase the price level from the buy stop orders price ladder or the buy stop orders collection
+        if (_buy_stop_ladder.IsInWindow(level_ptr->Price))
+            _buy_stop_ladder.Erase(level_ptr);
+        else
+            _buy_stop.erase(Levels::iterator(&_buy_stop, level_ptr));
     }
     else
     {
         // Update the best sell stop order price level
         if (level_ptr == _best_sell_stop)
-            _best_sell_stop = (_best_sell_stop->left != nullptr) ? _best_sell_stop->left : _best_sell_stop->parent;
-
-        // Erase the price level from the sell stop orders collection
-        _sell_stop.erase(Levels::iterator(&_sell_stop, level_ptr));
+        {
+            if (_sell_stop_ladder.enabled())
+                _best_sell_stop = GetNextStopLevel(_best_sell_stop);
+            else
+                _best_sell_stop = (_best_sell_stop->left != nullptr) ? _best_sell_stop->left : _best_sell_stop->parent;
+        }
+
+        // Erase the price level from the sell stop orders price ladder or the sell stop orders collection
+        if (_sell_stop_ladder.IsInWindow(level_ptr->Price))
+            _sell_stop_ladder.Erase(level_ptr);
+        else
+            _sell_stop.erase(Levels::iterator(&_sell_stop, level_ptr));
     }
 
     // Release the price level
-    _manager._level_pool.Release(level_ptr);
+    _level_pool.Release(level_ptr);
 
     return nullptr;
 }
@@ -290,17 +527,8 @@ void OrderBook::AddStopOrder(OrderNode* order_ptr)
     if (level_ptr == nullptr)
         level_ptr = AddStopLevel(order_ptr);
 
-    // Update the price level volume
-    level_ptr->TotalVolume += order_ptr->LeavesQuantity;
-    level_ptr->HiddenVolume += order_ptr->HiddenQuantity();
-    level_ptr->VisibleVolume += order_ptr->VisibleQuantity();
-
-    // Link the new order to the orders list of the price level
-    level_ptr->OrderList.push_back(*order_ptr);
-    ++level_ptr->Orders;
-
-    // Cache the price level in the given order
-    order_ptr->Level = level_ptr;
+    // Link the new order to the price level
+    LinkOrder(level_ptr, order_ptr);
 }
 
 void OrderBook::ReduceStopOrder(OrderNode* order_ptr, uint64_t quantity, uint64_t hidden, uint64_t visible)
@@ -357,10 +585,18 @@ LevelNode* OrderBook::AddTrailingStopLevel(OrderNode* order_ptr)
     if (order_ptr->IsBuy())
     {
         // Create a new price level
-        level_ptr = _manager._level_pool.Create(LevelType::ASK, order_ptr->StopPrice);
+        level_ptr = _level_pool.Create(LevelType::ASK, order_ptr->StopPrice);
+
+        // Move the trailing buy stop price ladder window to the new best trailing buy stop order price level
+        if (_trailing_buy_stop_ladder.enabled() && !_trailing_buy_stop_ladder.IsInWindow(level_ptr->Price) && _trailing_buy_stop_ladder.IsAligned(level_ptr->Price))
+            if (_trailing_buy_stop_ladder.empty() || (level_ptr->Price < _best_trailing_buy_stop->Price))
+                _trailing_buy_stop_ladder.Rebase(level_ptr->Price, _trailing_buy_stop);
 
-        // Insert the price level into the trailing buy stop orders collection
-        _trailing_buy_stop.insert(*level_ptr);
+        // Insert the price level into the trailing buy stop orders price ladder or the trailing buy stop orders collection
+        if (_trailing_buy_stop_ladder.IsInWindow(level_ptr->Price))
+            _trailing_buy_stop_ladder.Insert(level_ptr);
+        else
+            _trailing_buy_stop.insert(*level_ptr);
 
         // Update the best trailing buy stop order price level
         if ((_best_trailing_buy_stop == nullptr) || (level_ptr->Price < _best_trailing_buy_stop->Price))
@@ -369,10 +605,18 @@ LevelNode* OrderBook::AddTrailingStopLevel(OrderNode* order_ptr)
     else
     {
         // Create a new price level
-        level_ptr = _manager._level_pool.Create(LevelType::BID, order_ptr->StopPrice);
+        level_ptr = _level_pool.Create(LevelType::BID, order_ptr->StopPrice);
 
-        // Insert the price level into the trailing sell stop orders collection
-        _trailing_sell_stop.insert(*level_ptr);
+        // Move the trailing sell stop price ladder window to the new best trailing sell stop order price level
+        if (_trailing_sell_stop_ladder.enabled() && !_trailing_sell_stop_ladder.IsInWindow(level_ptr->Price) && _trailing_sell_stop_ladder.IsAligned(level_ptr->Price))
+            if (_trailing_sell_stop_ladder.empty() || (level_ptr->Price > _best_trailing_sell_stop->Price))
+                _trailing_sell_stop_ladder.Rebase(level_ptr->Price, _trailing_sell_stop);
+
+        // Insert the price level into the trailing sell stop orders price ladder or the trailing sell stop orders collection
+        if (_trailing_sell_stop_ladder.IsInWindow(level_ptr->Price))
+            _trailing_sell_stop_ladder.Insert(level_ptr);
+        else
+            _trailing_sell_stop.insert(*level_ptr);
 
         // Update the best trailing sell stop order price level
         if ((_best_trailing_sell_stop == nullptr) || (level_ptr->Price > _best_trailing_sell_stop->Price))
@@ -391,28 +635,44 @@ LevelNode* OrderBook::DeleteTrailingStopLevel(OrderNode* order_ptr)
     {
         // Update the best trailing buy stop order price level
         if (level_ptr == _best_trailing_buy_stop)
-            _best_trailing_buy_stop = (_best_trailing_buy_stop->right != nullptr) ? _best_trailing_buy_stop->right : _best_trailing_buy_stop->parent;
-
-        // Erase the price level from the trailing buy stop orders collection
-        _trailing_buy_stop.erase(Levels::iterator(&_trailing_buy_stop, level_ptr));
+        {
+            if (_trailing_buy_stop_ladder.enabled())
+                _best_trailing_buy_stop = GetNextTrailingStopLevel(_best_trailing_buy_stop);
+            else
+                _best_trailing_buy_stop = (_best_trailing_buy_stop->right != nullptr) ? _best_trailing_buy_stop->right : _best_trailing_buy_stop->parent;
+        }
+
+        // Erase the price level from the trailing buy stop orders price ladder or the trailing buy stop orders collection
+        if (_trailing_buy_stop_ladder.IsInWindow(level_ptr->Price))
+            _trailing_buy_stop_ladder.Erase(level_ptr);
+        else
+            _trailing_buy_stop.erase(Levels::iterator(&_trailing_buy_stop, level_ptr));
     }
     else
     {
         // Update the best trailing sell stop order price level
         if (level_ptr == _best_trailing_sell_stop)
-            _best_trailing_sell_stop = (_best_trailing_sell_stop->left != nullptr) ? _best_trailing_sell_stop->left : _best_trailing_sell_stop->parent;
-
-        // Erase the price level from the trailing sell stop orders collection
-        _trailing_sell_stop.erase(Levels::iterator(&_trailing_sell_stop, level_ptr));
+        {
+            if (_trailing_sell_stop_ladder.enabled())
+                _best_trailing_sell_stop = GetNextTrailingStopLevel(_best_trailing_sell_stop);
+            else
+                _best_trailing_sell_stop = (_best_trailing_sell_stop->left != nullptr) ? _best_trailing_sell_stop->left : _best_trailing_sell_stop->parent;
+        }
+
+        // Erase the price level from the trailing sell stop orders price ladder or the trailing sell stop orders collection
+        if (_trailing_sell_stop_ladder.IsInWindow(level_ptr->Price))
+            _trailing_sell_stop_ladder.Erase(level_ptr);
+        else
+            _trailing_sell_stop.erase(Levels::iterator(&_trailing_sell_stop, level_ptr));
     }
 
     // Release the price level
-    _manager._level_pool.Release(level_ptr);
+    _level_pool.Release(level_ptr);
 
     return nullptr;
 }
 
-void OrderBook::AddTrailingStopOrder(OrderNode* order_ptr)
+void OrderBook::AddTrailingStopOrder(OrderNode* order_ptr, bool reprice)
 {
     // Find the price level for the order
     LevelNode* level_ptr = order_ptr->IsBuy() ? (LevelNode*)GetTrailingBuyStopLevel(order_ptr->StopPrice) : (LevelNode*)GetTrailingSellStopLevel(order_ptr->StopPrice);
@@ -421,17 +681,12 @@ void OrderBook::AddTrailingStopOrder(OrderNode* order_ptr)
     if (level_ptr == nullptr)
         level_ptr = AddTrailingStopLevel(order_ptr);
 
-    // Update the price level volume
-    level_ptr->TotalVolume += order_ptr->LeavesQuantity;
-    level_ptr->HiddenVolume += order_ptr->HiddenQuantity();
-    level_ptr->VisibleVolume += order_ptr->VisibleQuantity();
-
-    // Link the new order to the orders list of the price level
-    level_ptr->OrderList.push_back(*order_ptr);
-    ++level_ptr->Orders;
+    // Link the new order to the price level
+    LinkOrder(level_ptr, order_ptr);
 
-    // Cache the price level in the given order
-    order_ptr->Level = level_ptr;
+    // Register the order repricing threshold (repriced orders keep their thresholds)
+    if (!reprice)
+        AddTrailingThreshold(order_ptr);
 }
 
 void OrderBook::ReduceTrailingStopOrder(OrderNode* order_ptr, uint64_t quantity, uint64_t hidden, uint64_t visible)
@@ -449,6 +704,7 @@ void OrderBook::ReduceTrailingStopOrder(OrderNode* order_ptr, uint64_t quantity,
     {
         level_ptr->OrderList.pop_current(*order_ptr);
         --level_ptr->Orders;
+        DeleteTrailingThreshold(order_ptr);
     }
 
     // Delete the empty price level
@@ -459,7 +715,7 @@ void OrderBook::ReduceTrailingStopOrder(OrderNode* order_ptr, uint64_t quantity,
     }
 }
 
-void OrderBook::DeleteTrailingStopOrder(OrderNode* order_ptr)
+void OrderBook::DeleteTrailingStopOrder(OrderNode* order_ptr, bool reprice)
 {
     // Find the price level for the order
     LevelNode* level_ptr = order_ptr->Level;
@@ -472,6 +728,8 @@ void OrderBook::DeleteTrailingStopOrder(OrderNode* order_ptr)
     // Unlink the empty order from the orders list of the price level
     level_ptr->OrderList.pop_current(*order_ptr);
     --level_ptr->Orders;
+    if (!reprice)
+        DeleteTrailingThreshold(order_ptr);
 
     // Delete the empty price level
     if (level_ptr->TotalVolume == 0)
@@ -521,5 +779,84 @@ uint64_t OrderBook::CalculateTrailingStopPrice(const Order& order) const noexcep
     return old_price;
 }
 
+void OrderBook::AddTrailingThreshold(const OrderNode* order_ptr)
+{
+    TrailingThresholds& thresholds = order_ptr->IsBuy() ? _trailing_buy_thresholds : _trailing_sell_thresholds;
+
+    // Percentage trailing values are negative
+    if (order_ptr->TrailingDistance < 0)
+        ++thresholds.Percentage[(uint64_t)(-order_ptr->TrailingDistance) + (uint64_t)(-order_ptr->TrailingStep)];
+    else
+        ++thresholds.Absolute[(uint64_t)order_ptr->TrailingDistance + (uint64_t)order_ptr->TrailingStep];
+}
+
+void OrderBook::DeleteTrailingThreshold(const OrderNode* order_ptr)
+{
+    TrailingThresholds& thresholds = order_ptr->IsBuy() ? _trailing_buy_thresholds : _trailing_sell_thresholds;
+    std::map<uint64_t, size_t>& group = (order_ptr->TrailingDistance < 0) ? thresholds.Percentage : thresholds.Absolute;
+
+    // Percentage trailing values are negative
+    uint64_t threshold = (order_ptr->TrailingDistance < 0) ?
+        ((uint64_t)(-order_ptr->TrailingDistance) + (uint64_t)(-order_ptr->TrailingStep)) :
+        ((uint64_t)order_ptr->TrailingDistance + (uint64_t)order_ptr->TrailingStep);
+
+    auto it = group.find(threshold);
+    assert((it != group.end()) && "Trailing stop order threshold not found!");
+    if (--it->second == 0)
+        group.erase(it);
+}
+
+LevelNode* OrderBook::GetTrailingStopRepriceLevel(bool buy) noexcept
+{
+    const TrailingThresholds& thresholds = buy ? _trailing_buy_thresholds : _trailing_sell_thresholds;
+    if (thresholds.Absolute.empty() && thresholds.Percentage.empty())
+        return nullptr;
+
+    // Get the current market price
+    uint64_t market_price = buy ? GetMarketTrailingStopPriceAsk() : GetMarketTrailingStopPriceBid();
+
+    // Find the minimal repricing threshold. The order is repriced only if its
+    // stop price is at least (trailing distance + trailing step) away from the
+    // market price. Percentage thresholds are rounded down to stay conservative.
+    uint64_t threshold = std::numeric_limits<uint64_t>::max();
+    if (!thresholds.Absolute.empty())
+        threshold = thresholds.Absolute.begin()->first;
+    if (!thresholds.Percentage.empty())
+        threshold = std::min(threshold, (market_price / 10000) * thresholds.Percentage.begin()->first);
+
+    if (buy)
+    {
+        // Buy stop price could not be decreased below the market price
+        if (market_price >= (std::numeric_limits<uint64_t>::max() - threshold))
+            return nullptr;
+        uint64_t price = market_price + threshold;
+
+        // Find the first trailing buy stop price level with the price higher or equal to the found one
+        if (_trailing_buy_stop_ladder.enabled())
+            return (price > 0) ? _trailing_buy_stop_ladder.Higher(_trailing_buy_stop, price - 1) : _best_trailing_buy_stop;
+
+        auto it = _trailing_buy_stop.lower_bound(LevelNode(LevelType::ASK, price));
+        return it.operator->();
+    }
+    else
+    {
+        // Sell stop price could not be increased above the market price
+        if (market_price < threshold)
+            return nullptr;
+        uint64_t price = market_price - threshold;
+
+        // Find the first trailing sell stop price level with the price lower or equal to the found one
+        if (_trailing_sell_stop_ladder.enabled())
+            return (price < std::numeric_limits<uint64_t>::max()) ? _trailing_sell_stop_ladder.Lower(_trailing_sell_stop, price + 1) : _best_trailing_sell_stop;
+
+        auto it = _trailing_sell_stop.upper_bound(LevelNode(LevelType::BID, price));
+        if (it == _trailing_sell_stop.end())
+            return _best_trailing_sell_stop;
+        Levels::reverse_iterator prev(&_trailing_sell_stop, it.operator->());
+        ++prev;
+        return prev.operator->();
+    }
+}
+
 } // namespace Matching
 } // namespace CppTrader
@@ -0,0 +1,169 @@
+/*!
+    \file order_book_optimized.cpp
+    \brief Optimized order book implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/order_book_optimized.h"
+
+namespace CppTrader {
+namespace Matching {
+
+OrderBookOptimized::OrderBookOptimized(LevelPool& levels, const Symbol& symbol)
+    : _levels(levels),
+      _symbol(symbol)
+{
+}
+
+OrderBookOptimized::~OrderBookOptimized()
+{
+    // Release bid price levels
+    for (const auto& bid : _bids)
+        _levels.Release(bid.Level);
+    _bids.clear();
+
+    // Release ask price levels
+    for (const auto& ask : _asks)
+        _levels.Release(ask.Level);
+    _asks.clear();
+}
+
+size_t OrderBookOptimized::FindLevel(const OrderOptimized* order_ptr, UpdateType& update)
+{
+    if (order_ptr->IsBuy())
+    {
+        // Try to find required price level in the bid collection
+        auto it = _bids.end();
+        while (it != _bids.begin())
+        {
+            auto prev = it - 1;
+            if (prev->Price == order_ptr->Price)
+            {
+                update = UpdateType::UPDATE;
+                return prev->Level;
+            }
+            if (prev->Price < order_ptr->Price)
+                break;
+            it = prev;
+        }
+
+        // Create a new price level and insert it into the bid collection
+        size_t index = _levels.Create(LevelType::BID, order_ptr->Price);
+        _bids.insert(it, PriceLevel{ order_ptr->Price, index });
+
+        update = UpdateType::ADD;
+        return index;
+    }
+    else
+    {
+        // Try to find required price level in the ask collection
+        auto it = _asks.end();
+        while (it != _asks.begin())
+        {
+            auto prev = it - 1;
+            if (prev->Price == order_ptr->Price)
+            {
+                update = UpdateType::UPDATE;
+                return prev->Level;
+            }
+            if (prev->Price > order_ptr->Price)
+                break;
+            it = prev;
+        }
+
+        // Create a new price level and insert it into the ask collection
+        size_t index = _levels.Create(LevelType::ASK, order_ptr->Price);
+        _asks.insert(it, PriceLevel{ order_ptr->Price, index });
+
+        update = UpdateType::ADD;
+        return index;
+    }
+}
+
+void OrderBookOptimized::DeleteLevel(const OrderOptimized* order_ptr)
+{
+    Levels& levels = order_ptr->IsBuy() ? _bids : _asks;
+
+    // Erase the price level from the corresponding collection
+    for (auto it = levels.end(); it != levels.begin();)
+    {
+        if ((--it)->Level == order_ptr->Level)
+        {
+            levels.erase(it);
+            break;
+        }
+    }
+
+    // Release the price level
+    _levels.Release(order_ptr->Level);
+}
+
+LevelUpdate OrderBookOptimized::AddOrder(OrderOptimized* order_ptr)
+{
+    // Find the price level for the order
+    UpdateType update = UpdateType::UPDATE;
+    order_ptr->Level = FindLevel(order_ptr, update);
+    Level& level = _levels[order_ptr->Level];
+
+    // Update the price level volume
+    level.TotalVolume += order_ptr->Quantity;
+    level.VisibleVolume += order_ptr->Quantity;
+
+    // Update the price level orders count
+    ++level.Orders;
+
+    // Price level was changed. Return top of the book modification flag.
+    return LevelUpdate(update, level, IsTop(order_ptr));
+}
+
+LevelUpdate OrderBookOptimized::ReduceOrder(OrderOptimized* order_ptr, uint64_t quantity)
+{
+    Level& level = _levels[order_ptr->Level];
+
+    // Update the price level volume
+    level.TotalVolume -= quantity;
+    level.VisibleVolume -= quantity;
+
+    // Update the price level orders count
+    if (order_ptr->Quantity == 0)
+        --level.Orders;
+
+    LevelUpdate update(UpdateType::UPDATE, level, IsTop(order_ptr));
+
+    // Delete the empty price level
+    if (level.Orders == 0)
+    {
+        update.Type = UpdateType::DELETE;
+        DeleteLevel(order_ptr);
+    }
+
+    return update;
+}
+
+LevelUpdate OrderBookOptimized::DeleteOrder(OrderOptimized* order_ptr)
+{
+    Level& level = _levels[order_ptr->Level];
+
+    // Update the price level volume
+    level.TotalVolume -= order_ptr->Quantity;
+    level.VisibleVolume -= order_ptr->Quantity;
+
+    // Update the price level orders count
+    --level.Orders;
+
+    LevelUpdate update(UpdateType::UPDATE, level, IsTop(order_ptr));
+
+    // Delete the empty price level
+    if (level.Orders == 0)
+    {
+        update.Type = UpdateType::DELETE;
+        DeleteLevel(order_ptr);
+    }
+
+    return update;
+}
+
+} // namespace Matching
+} // namespace CppTrader
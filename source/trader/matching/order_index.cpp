@@ -0,0 +1,108 @@
+/*!
+    \file order_index.cpp
+    \brief Order index implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/order_index.h"
+
+#include <algorithm>
+
+namespace CppTrader {
+namespace Matching {
+
+OrderIndex::OrderIndex()
+    : _limit(0),
+      _size(0),
+      _pages(0),
+      _capacity(0),
+      _overflow(16384, 0)
+{
+}
+
+void OrderIndex::Clear()
+{
+    _directory.clear();
+    _spares.clear();
+    _overflow.clear();
+    _size = 0;
+    _pages = 0;
+}
+
+void OrderIndex::Reserve(size_t capacity)
+{
+    _capacity = capacity;
+    ReservePages();
+    _overflow.reserve(capacity);
+}
+
+void OrderIndex::SetLimit(uint64_t limit)
+{
+    if (limit == _limit)
+        return;
+
+    // Collect all orders
+    std::vector<OrderNode*> orders;
+    orders.reserve(size());
+    for (const auto& order : *this)
+        orders.push_back(order.second);
+
+    // Re-insert all orders with the new limit
+    Clear();
+    _limit = limit;
+    ReservePages();
+    for (auto order_ptr : orders)
+        Insert(order_ptr);
+}
+
+size_t OrderIndex::ReservedPages() const noexcept
+{
+    // Reserved orders could not take more pages than the direct index limit
+    uint64_t ids = std::min<uint64_t>(_capacity, _limit);
+    return (ids > 0) ? (PageIndex(ids - 1) + 1) : 0;
+}
+
+void OrderIndex::ReservePages()
+{
+    size_t pages = ReservedPages();
+    _directory.reserve(pages);
+    _spares.reserve(pages);
+    while ((_pages + _spares.size()) < pages)
+        _spares.emplace_back(std::make_unique<Page>());
+}
+
+OrderIndex::Page* OrderIndex::AllocatePage()
+{
+    // Released pages are always empty, new pages are zero initialized
+    Page* page_ptr;
+    if (!_spares.empty())
+    {
+        page_ptr = _spares.back().release();
+        _spares.pop_back();
+    }
+    else
+        page_ptr = new Page();
+
+    ++_pages;
+    return page_ptr;
+}
+
+void OrderIndex::ReleasePage(size_t index)
+{
+    // Keep reserved pages and at least one released page to avoid allocations on page boundaries
+    if (_spares.empty() || ((_pages + _spares.size()) <= ReservedPages()))
+        _spares.push_back(std::move(_directory[index]));
+    else
+        _directory[index].reset();
+
+    --_pages;
+
+    // Shrink the pages directory tail
+    while (!_directory.empty() && !_directory.back())
+        _directory.pop_back();
+}
+
+} // namespace Matching
+} // namespace CppTrader
@@ -0,0 +1,80 @@
+/*!
+    \file price_ladder.cpp
+    \brief Price ladder implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/price_ladder.h"
+
+namespace CppTrader {
+namespace Matching {
+
+PriceLadder::PriceLadder(uint64_t tick_size, size_t capacity)
+    : _tick_size(tick_size),
+      _capacity(0),
+      _mask(0),
+      _size(0),
+      _base(0)
+{
+    // Disabled price ladder
+    if ((tick_size == 0) || (capacity == 0))
+        return;
+
+    // Round the window capacity up to the power of two
+    _capacity = 64;
+    while (_capacity < capacity)
+        _capacity <<= 1;
+    _mask = _capacity - 1;
+}
+
+void PriceLadder::Allocate()
+{
+    _slots.resize(_capacity, nullptr);
+    _bitmap.resize(_capacity / 64, 0);
+    _summary.resize((_capacity / 64 + 63) / 64, 0);
+}
+
+void PriceLadder::Rebase(uint64_t price, Levels& overflow)
+{
+    assert(enabled() && "Price ladder is disabled!");
+
+    // Calculate a new window base tick centered at the given price
+    uint64_t max_tick = std::numeric_limits<uint64_t>::max() / _tick_size;
+    uint64_t max_base = (max_tick >= _capacity) ? (max_tick - _capacity + 1) : 0;
+    uint64_t tick = price / _tick_size;
+    uint64_t base = std::min((tick > (_capacity / 2)) ? (tick - _capacity / 2) : 0, max_base);
+    if (base == _base)
+        return;
+
+    // Move price levels leaving the window into the overflow container.
+    // Ring slots do not depend on the window base, so other price levels stay in place.
+    for (size_t slot = (_size > 0) ? FindFirstSlot(0, _capacity) : npos; slot != npos; slot = FindFirstSlot(slot + 1, _capacity))
+    {
+        LevelNode* level_ptr = _slots[slot];
+        if (((level_ptr->Price / _tick_size) - base) >= _capacity)
+        {
+            Erase(level_ptr);
+            overflow.insert(*level_ptr);
+        }
+    }
+
+    _base = base;
+
+    // Move aligned overflow price levels entering the window into the ladder
+    auto it = overflow.lower_bound(LevelNode(LevelType::BID, base * _tick_size));
+    while ((it != overflow.end()) && (((it->Price / _tick_size) - base) < _capacity))
+    {
+        LevelNode* level_ptr = it.operator->();
+        ++it;
+        if (IsAligned(level_ptr->Price))
+        {
+            overflow.erase(Levels::iterator(&overflow, level_ptr));
+            Insert(level_ptr);
+        }
+    }
+}
+
+} // namespace Matching
+} // namespace CppTrader
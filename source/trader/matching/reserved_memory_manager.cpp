@@ -0,0 +1,182 @@
+/*!
+    \file reserved_memory_manager.cpp
+    \brief Reserved memory manager implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/reserved_memory_manager.h"
+
+#include <new>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+namespace CppTrader {
+namespace Matching {
+
+namespace {
+
+const size_t REGION_PAGE_SIZE = 4096;
+const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+// Heap blocks are freed without the alignment, so they are always cache line aligned
+const size_t HEAP_ALIGNMENT = 64;
+
+size_t AlignUp(size_t value, size_t alignment) noexcept
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+ReservedMemoryManager::ReservedMemoryManager() noexcept
+    : _buffer(nullptr),
+      _capacity(0),
+      _size(0),
+      _huge_pages(false),
+      _allocated(0),
+      _allocations(0)
+{
+}
+
+ReservedMemoryManager::~ReservedMemoryManager()
+{
+    if (_buffer != nullptr)
+        UnmapRegion(_buffer, _capacity);
+}
+
+void* ReservedMemoryManager::malloc(size_t size, size_t alignment)
+{
+    assert((alignment > 0) && ((alignment & (alignment - 1)) == 0) && "Alignment must be a power of two!");
+    assert((alignment <= HEAP_ALIGNMENT) && "Alignment must not be greater than the cache line size!");
+
+    void* result = nullptr;
+
+    // Allocate the memory block from the reserved memory region
+    size_t offset = AlignUp((size_t)_buffer + _size, alignment) - (size_t)_buffer;
+    if ((_buffer != nullptr) && (offset <= _capacity) && (size <= (_capacity - offset)))
+    {
+        result = _buffer + offset;
+        _size = offset + size;
+    }
+    else
+        result = ::operator new(size, std::align_val_t(HEAP_ALIGNMENT), std::nothrow);
+
+    if (result != nullptr)
+    {
+        _allocated += size;
+        ++_allocations;
+    }
+
+    return result;
+}
+
+void ReservedMemoryManager::free(void* ptr, size_t size)
+{
+    if (ptr == nullptr)
+        return;
+
+    assert((size <= _allocated) && (_allocations > 0) && "Invalid memory block to free!");
+    _allocated -= size;
+    --_allocations;
+
+    // Blocks of the reserved memory region are released together with the region
+    if (!owns(ptr))
+        ::operator delete(ptr, std::align_val_t(HEAP_ALIGNMENT));
+}
+
+bool ReservedMemoryManager::Reserve(size_t capacity, bool huge_pages)
+{
+    assert((_buffer == nullptr) && "Memory region is already reserved!");
+    if ((_buffer != nullptr) || (capacity == 0))
+        return false;
+
+    bool mapped_huge_pages = false;
+    void* buffer = MapRegion(capacity, huge_pages, mapped_huge_pages);
+    if (buffer == nullptr)
+        return false;
+
+    // Prefault the memory region
+    for (size_t offset = 0; offset < capacity; offset += REGION_PAGE_SIZE)
+        ((volatile uint8_t*)buffer)[offset] = 0;
+
+    _buffer = (uint8_t*)buffer;
+    _capacity = capacity;
+    _size = 0;
+    _huge_pages = mapped_huge_pages;
+    return true;
+}
+
+void* ReservedMemoryManager::MapRegion(size_t& capacity, bool huge_pages, bool& mapped_huge_pages)
+{
+    mapped_huge_pages = false;
+
+#if defined(_WIN32) || defined(_WIN64)
+    if (huge_pages)
+    {
+        // Large pages require 'SeLockMemoryPrivilege' privilege
+        size_t large_page = GetLargePageMinimum();
+        if (large_page > 0)
+        {
+            size_t size = AlignUp(capacity, large_page);
+            void* buffer = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+            if (buffer != nullptr)
+            {
+                capacity = size;
+                mapped_huge_pages = true;
+                return buffer;
+            }
+        }
+    }
+
+    capacity = AlignUp(capacity, REGION_PAGE_SIZE);
+    return VirtualAlloc(nullptr, capacity, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    if (huge_pages)
+    {
+#if defined(MAP_HUGETLB)
+        // Explicit huge pages must be preallocated by the system
+        size_t size = AlignUp(capacity, HUGE_PAGE_SIZE);
+        void* buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (buffer != MAP_FAILED)
+        {
+            capacity = size;
+            mapped_huge_pages = true;
+            return buffer;
+        }
+#endif
+        // Align the region to the huge page size for transparent huge pages
+        capacity = AlignUp(capacity, HUGE_PAGE_SIZE);
+    }
+    else
+        capacity = AlignUp(capacity, REGION_PAGE_SIZE);
+
+    void* buffer = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buffer == MAP_FAILED)
+        return nullptr;
+
+#if defined(MADV_HUGEPAGE)
+    if (huge_pages)
+        madvise(buffer, capacity, MADV_HUGEPAGE);
+#endif
+
+    return buffer;
+#endif
+}
+
+void ReservedMemoryManager::UnmapRegion(void* buffer, size_t capacity)
+{
+#if defined(_WIN32) || defined(_WIN64)
+    VirtualFree(buffer, 0, MEM_RELEASE);
+#else
+    munmap(buffer, capacity);
+#endif
+}
+
+} // namespace Matching
+} // namespace CppTrader
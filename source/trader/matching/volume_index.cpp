@@ -0,0 +1,46 @@
+/*!
+    \file volume_index.cpp
+    \brief Volume index implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/matching/volume_index.h"
+
+namespace CppTrader {
+namespace Matching {
+
+VolumeIndex::VolumeIndex()
+    : _total(0)
+{
+    // Create the root node
+    _nodes.emplace_back();
+}
+
+void VolumeIndex::Clear()
+{
+    _total = 0;
+    _nodes.clear();
+    _free.clear();
+
+    // Create the root node
+    _nodes.emplace_back();
+}
+
+uint32_t VolumeIndex::CreateNode()
+{
+    // Reuse the released node
+    if (!_free.empty())
+    {
+        uint32_t index = _free.back();
+        _free.pop_back();
+        return index;
+    }
+
+    _nodes.emplace_back();
+    return (uint32_t)(_nodes.size() - 1);
+}
+
+} // namespace Matching
+} // namespace CppTrader
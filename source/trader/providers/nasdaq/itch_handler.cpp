@@ -13,182 +13,151 @@
 namespace CppTrader {
 namespace ITCH {
 
-bool ITCHHandler::Process(void* buffer, size_t size)
+bool ITCHHandler::ProcessMessage(void* buffer, size_t size)
 {
-    size_t index = 0;
+    // Message is empty
+    if (size == 0)
+        return false;
+
     uint8_t* data = (uint8_t*)buffer;
 
-    while (index < size)
+    // Pass messages with views to message view handlers
+    if (_views)
+        return ProcessMessageView(data, size);
+
+    switch (*data)
     {
-        if (_size == 0)
-        {
-            size_t remaining = size - index;
-
-            // Collect message size into the cache
-            if (((_cache.size() == 0) && (remaining < 3)) || (_cache.size() == 1))
-            {
-                _cache.push_back(data[index++]);
-                continue;
-            }
-
-            // Read a new message size
-            uint16_t message_size;
-            if (_cache.empty())
-            {
-                // Read the message size directly from the input buffer
-                index += CppCommon::Endian::ReadBigEndian(&data[index], message_size);
-            }
-            else
-            {
-                // Read the message size from the cache
-                CppCommon::Endian::ReadBigEndian(_cache.data(), message_size);
-
-                // Clear the cache
-                _cache.clear();
-            }
-            _size = message_size;
-        }
-
-        // Read a new message
-        if (_size > 0)
-        {
-            size_t remaining = size - index;
-
-            // Complete or place the message into the cache
-            if (!_cache.empty())
-            {
-                size_t tail = _size - _cache.size();
-                if (tail > remaining)
-                    tail = remaining;
-                _cache.insert(_cache.end(), &data[index], &data[index + tail]);
-                index += tail;
-                if (_cache.size() < _size)
-                    continue;
-            }
-            else if (_size > remaining)
-            {
-                _cache.reserve(_size);
-                _cache.insert(_cache.end(), &data[index], &data[index + remaining]);
-                index += remaining;
-                continue;
-            }
-
-            // Process the current message
-            if (_cache.empty())
-            {
-                // Process the current message size directly from the input buffer
-                if (!ProcessMessage(&data[index], _size))
-                    return false;
-                index += _size;
-            }
-            else
-            {
-                // Process the current message size directly from the cache
-                if (!ProcessMessage(_cache.data(), _size))
-                    return false;
-
-                // Clear the cache
-                _cache.clear();
-            }
-
-            // Process the next message
-            _size = 0;
-        }
+        case 'S':
+            return DecodeMessage<SystemEventMessage>(data, size);
+        case 'R':
+            return DecodeMessage<StockDirectoryMessage>(data, size);
+        case 'H':
+            return DecodeMessage<StockTradingActionMessage>(data, size);
+        case 'Y':
+            return DecodeMessage<RegSHOMessage>(data, size);
+        case 'L':
+            return DecodeMessage<MarketParticipantPositionMessage>(data, size);
+        case 'V':
+            return DecodeMessage<MWCBDeclineMessage>(data, size);
+        case 'W':
+            return DecodeMessage<MWCBStatusMessage>(data, size);
+        case 'K':
+            return DecodeMessage<IPOQuotingMessage>(data, size);
+        case 'A':
+            return DecodeMessage<AddOrderMessage>(data, size);
+        case 'F':
+            return DecodeMessage<AddOrderMPIDMessage>(data, size);
+        case 'E':
+            return DecodeMessage<OrderExecutedMessage>(data, size);
+        case 'C':
+            return DecodeMessage<OrderExecutedWithPriceMessage>(data, size);
+        case 'X':
+            return DecodeMessage<OrderCancelMessage>(data, size);
+        case 'D':
+            return DecodeMessage<OrderDeleteMessage>(data, size);
+        case 'U':
+            return DecodeMessage<OrderReplaceMessage>(data, size);
+        case 'P':
+            return DecodeMessage<TradeMessage>(data, size);
+        case 'Q':
+            return DecodeMessage<CrossTradeMessage>(data, size);
+        case 'B':
+            return DecodeMessage<BrokenTradeMessage>(data, size);
+        case 'I':
+            return DecodeMessage<NOIIMessage>(data, size);
+        case 'N':
+            return DecodeMessage<RPIIMessage>(data, size);
+        case 'J':
+            return DecodeMessage<LULDAuctionCollarMessage>(data, size);
+        default:
+            return DecodeMessage<UnknownMessage>(data, size);
     }
-
-    return true;
 }
 
-bool ITCHHandler::ProcessMessage(void* buffer, size_t size)
+bool ITCHHandler::ProcessMessageView(void* buffer, size_t size)
 {
-    // Message is empty
-    if (size == 0)
-        return false;
-
     uint8_t* data = (uint8_t*)buffer;
 
     switch (*data)
     {
         case 'S':
-            return ProcessSystemEventMessage(data, size);
+            return DecodeMessage<SystemEventMessage>(data, size);
         case 'R':
-            return ProcessStockDirectoryMessage(data, size);
+            return ProcessView<StockDirectoryView>(data, size);
         case 'H':
-            return ProcessStockTradingActionMessage(data, size);
+            return DecodeMessage<StockTradingActionMessage>(data, size);
         case 'Y':
-            return ProcessRegSHOMessage(data, size);
+            return DecodeMessage<RegSHOMessage>(data, size);
         case 'L':
-            return ProcessMarketParticipantPositionMessage(data, size);
+            return DecodeMessage<MarketParticipantPositionMessage>(data, size);
         case 'V':
-            return ProcessMWCBDeclineMessage(data, size);
+            return DecodeMessage<MWCBDeclineMessage>(data, size);
         case 'W':
-            return ProcessMWCBStatusMessage(data, size);
+            return DecodeMessage<MWCBStatusMessage>(data, size);
         case 'K':
-            return ProcessIPOQuotingMessage(data, size);
+            return DecodeMessage<IPOQuotingMessage>(data, size);
         case 'A':
-            return ProcessAddOrderMessage(data, size);
+            return ProcessView<AddOrderView>(data, size);
         case 'F':
-            return ProcessAddOrderMPIDMessage(data, size);
+            return ProcessView<AddOrderMPIDView>(data, size);
         case 'E':
-            return ProcessOrderExecutedMessage(data, size);
+            return ProcessView<OrderExecutedView>(data, size);
         case 'C':
-            return ProcessOrderExecutedWithPriceMessage(data, size);
+            return ProcessView<OrderExecutedWithPriceView>(data, size);
         case 'X':
-            return ProcessOrderCancelMessage(data, size);
+            return ProcessView<OrderCancelView>(data, size);
         case 'D':
-            return ProcessOrderDeleteMessage(data, size);
+            return ProcessView<OrderDeleteView>(data, size);
         case 'U':
-            return ProcessOrderReplaceMessage(data, size);
+            return ProcessView<OrderReplaceView>(data, size);
         case 'P':
-            return ProcessTradeMessage(data, size);
+            return ProcessView<TradeView>(data, size);
         case 'Q':
-            return ProcessCrossTradeMessage(data, size);
+            return DecodeMessage<CrossTradeMessage>(data, size);
         case 'B':
-            return ProcessBrokenTradeMessage(data, size);
+            return DecodeMessage<BrokenTradeMessage>(data, size);
         case 'I':
-            return ProcessNOIIMessage(data, size);
+            return DecodeMessage<NOIIMessage>(data, size);
         case 'N':
-            return ProcessRPIIMessage(data, size);
+            return DecodeMessage<RPIIMessage>(data, size);
         case 'J':
-            return ProcessLULDAuctionCollarMessage(data, size);
+            return DecodeMessage<LULDAuctionCollarMessage>(data, size);
         default:
-            return ProcessUnknownMessage(data, size);
+            return DecodeMessage<UnknownMessage>(data, size);
     }
 }
 
-void ITCHHandler::Reset()
+void ITCHFramer::Reset()
 {
     _size = 0;
     _cache.clear();
 }
 
-bool ITCHHandler::ProcessSystemEventMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, SystemEventMessage& message)
 {
     assert((size == 12) && "Invalid size of the ITCH message type 'S'");
     if (size != 12)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    SystemEventMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
     data += ReadTimestamp(data, message.Timestamp);
     message.EventCode = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessStockDirectoryMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, StockDirectoryMessage& message)
 {
     assert((size == 39) && "Invalid size of the ITCH message type 'R'");
     if (size != 39)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    StockDirectoryMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -208,18 +177,17 @@ bool ITCHHandler::ProcessStockDirectoryMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.ETPLeverageFactor);
     message.InverseIndicator = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessStockTradingActionMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, StockTradingActionMessage& message)
 {
     assert((size == 25) && "Invalid size of the ITCH message type 'H'");
     if (size != 25)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    StockTradingActionMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -229,18 +197,17 @@ bool ITCHHandler::ProcessStockTradingActionMessage(void* buffer, size_t size)
     message.Reserved = *data++;
     message.Reason = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessRegSHOMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, RegSHOMessage& message)
 {
     assert((size == 20) && "Invalid size of the ITCH message type 'Y'");
     if (size != 20)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    RegSHOMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -248,18 +215,17 @@ bool ITCHHandler::ProcessRegSHOMessage(void* buffer, size_t size)
     data += ReadString(data, message.Stock);
     message.RegSHOAction = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessMarketParticipantPositionMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, MarketParticipantPositionMessage& message)
 {
     assert((size == 26) && "Invalid size of the ITCH message type 'L'");
     if (size != 26)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    MarketParticipantPositionMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -270,18 +236,17 @@ bool ITCHHandler::ProcessMarketParticipantPositionMessage(void* buffer, size_t s
     message.MarketMakerMode = *data++;
     message.MarketParticipantState = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessMWCBDeclineMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, MWCBDeclineMessage& message)
 {
     assert((size == 35) && "Invalid size of the ITCH message type 'V'");
     if (size != 35)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    MWCBDeclineMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -290,36 +255,34 @@ bool ITCHHandler::ProcessMWCBDeclineMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.Level2);
     data += CppCommon::Endian::ReadBigEndian(data, message.Level3);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessMWCBStatusMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, MWCBStatusMessage& message)
 {
     assert((size == 12) && "Invalid size of the ITCH message type 'W'");
     if (size != 12)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    MWCBStatusMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
     data += ReadTimestamp(data, message.Timestamp);
     message.BreachedLevel = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessIPOQuotingMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, IPOQuotingMessage& message)
 {
     assert((size == 28) && "Invalid size of the ITCH message type 'W'");
     if (size != 28)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    IPOQuotingMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -329,18 +292,17 @@ bool ITCHHandler::ProcessIPOQuotingMessage(void* buffer, size_t size)
     message.IPOReleaseQualifier = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.IPOPrice);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessAddOrderMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, AddOrderMessage& message)
 {
     assert((size == 36) && "Invalid size of the ITCH message type 'A'");
     if (size != 36)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    AddOrderMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -351,18 +313,17 @@ bool ITCHHandler::ProcessAddOrderMessage(void* buffer, size_t size)
     data += ReadString(data, message.Stock);
     data += CppCommon::Endian::ReadBigEndian(data, message.Price);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessAddOrderMPIDMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, AddOrderMPIDMessage& message)
 {
     assert((size == 40) && "Invalid size of the ITCH message type 'F'");
     if (size != 40)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    AddOrderMPIDMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -374,18 +335,17 @@ bool ITCHHandler::ProcessAddOrderMPIDMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.Price);
     message.Attribution = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessOrderExecutedMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, OrderExecutedMessage& message)
 {
     assert((size == 31) && "Invalid size of the ITCH message type 'E'");
     if (size != 31)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    OrderExecutedMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -394,18 +354,17 @@ bool ITCHHandler::ProcessOrderExecutedMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.ExecutedShares);
     data += CppCommon::Endian::ReadBigEndian(data, message.MatchNumber);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessOrderExecutedWithPriceMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, OrderExecutedWithPriceMessage& message)
 {
     assert((size == 36) && "Invalid size of the ITCH message type 'C'");
     if (size != 36)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    OrderExecutedWithPriceMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -416,18 +375,17 @@ bool ITCHHandler::ProcessOrderExecutedWithPriceMessage(void* buffer, size_t size
     message.Printable = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.ExecutionPrice);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessOrderCancelMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, OrderCancelMessage& message)
 {
     assert((size == 23) && "Invalid size of the ITCH message type 'X'");
     if (size != 23)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    OrderCancelMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -435,36 +393,34 @@ bool ITCHHandler::ProcessOrderCancelMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.OrderReferenceNumber);
     data += CppCommon::Endian::ReadBigEndian(data, message.CanceledShares);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessOrderDeleteMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, OrderDeleteMessage& message)
 {
     assert((size == 19) && "Invalid size of the ITCH message type 'D'");
     if (size != 19)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    OrderDeleteMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
     data += ReadTimestamp(data, message.Timestamp);
     data += CppCommon::Endian::ReadBigEndian(data, message.OrderReferenceNumber);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessOrderReplaceMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, OrderReplaceMessage& message)
 {
     assert((size == 35) && "Invalid size of the ITCH message type 'U'");
     if (size != 35)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    OrderReplaceMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -474,18 +430,17 @@ bool ITCHHandler::ProcessOrderReplaceMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.Shares);
     data += CppCommon::Endian::ReadBigEndian(data, message.Price);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessTradeMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, TradeMessage& message)
 {
     assert((size == 44) && "Invalid size of the ITCH message type 'P'");
     if (size != 44)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    TradeMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -497,18 +452,17 @@ bool ITCHHandler::ProcessTradeMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.Price);
     data += CppCommon::Endian::ReadBigEndian(data, message.MatchNumber);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessCrossTradeMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, CrossTradeMessage& message)
 {
     assert((size == 40) && "Invalid size of the ITCH message type 'Q'");
     if (size != 40)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    CrossTradeMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -519,36 +473,34 @@ bool ITCHHandler::ProcessCrossTradeMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.MatchNumber);
     message.CrossType = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessBrokenTradeMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, BrokenTradeMessage& message)
 {
     assert((size == 19) && "Invalid size of the ITCH message type 'B'");
     if (size != 19)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    BrokenTradeMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
     data += ReadTimestamp(data, message.Timestamp);
     data += CppCommon::Endian::ReadBigEndian(data, message.MatchNumber);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessNOIIMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, NOIIMessage& message)
 {
     assert((size == 50) && "Invalid size of the ITCH message type 'I'");
     if (size != 50)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    NOIIMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -563,18 +515,17 @@ bool ITCHHandler::ProcessNOIIMessage(void* buffer, size_t size)
     message.CrossType = *data++;
     message.PriceVariationIndicator = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessRPIIMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, RPIIMessage& message)
 {
     assert((size == 20) && "Invalid size of the ITCH message type 'N'");
     if (size != 20)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    RPIIMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -582,18 +533,17 @@ bool ITCHHandler::ProcessRPIIMessage(void* buffer, size_t size)
     data += ReadString(data, message.Stock);
     message.InterestFlag = *data++;
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessLULDAuctionCollarMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, LULDAuctionCollarMessage& message)
 {
     assert((size == 35) && "Invalid size of the ITCH message type 'J'");
     if (size != 35)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    LULDAuctionCollarMessage message;
     message.Type = *data++;
     data += CppCommon::Endian::ReadBigEndian(data, message.StockLocate);
     data += CppCommon::Endian::ReadBigEndian(data, message.TrackingNumber);
@@ -604,21 +554,20 @@ bool ITCHHandler::ProcessLULDAuctionCollarMessage(void* buffer, size_t size)
     data += CppCommon::Endian::ReadBigEndian(data, message.LowerAuctionCollarPrice);
     data += CppCommon::Endian::ReadBigEndian(data, message.AuctionCollarExtension);
 
-    return onMessage(message);
+    return true;
 }
 
-bool ITCHHandler::ProcessUnknownMessage(void* buffer, size_t size)
+bool ITCHDecoder::Decode(const void* buffer, size_t size, UnknownMessage& message)
 {
     assert((size > 0) && "Invalid size of the unknown ITCH message!");
     if (size == 0)
         return false;
 
-    uint8_t* data = (uint8_t*)buffer;
+    const uint8_t* data = (const uint8_t*)buffer;
 
-    UnknownMessage message;
     message.Type = *data;
 
-    return onMessage(message);
+    return true;
 }
 
 } // namespace ITCH
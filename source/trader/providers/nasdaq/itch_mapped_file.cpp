@@ -0,0 +1,149 @@
+/*!
+    \file itch_mapped_file.cpp
+    \brief NASDAQ ITCH memory-mapped file implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_mapped_file.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CppTrader {
+namespace ITCH {
+
+ITCHMappedFile::ITCHMappedFile() noexcept
+    : _opened(false),
+      _data(nullptr),
+      _size(0)
+#if defined(_WIN32) || defined(_WIN64)
+      , _file(INVALID_HANDLE_VALUE),
+      _mapping(nullptr)
+#endif
+{
+}
+
+ITCHMappedFile::~ITCHMappedFile()
+{
+    Close();
+}
+
+bool ITCHMappedFile::Open(const CppCommon::Path& path, bool huge_pages)
+{
+    if (_opened)
+        Close();
+
+#if defined(_WIN32) || defined(_WIN64)
+    // Large pages are not supported for file mappings
+    HANDLE file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    // Empty file could not be mapped
+    if (size.QuadPart > 0)
+    {
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        void* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (data == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        _mapping = mapping;
+        _data = data;
+    }
+
+    _file = file;
+    _size = (size_t)size.QuadPart;
+#else
+    int file = open(path.string().c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat status;
+    if (fstat(file, &status) != 0)
+    {
+        close(file);
+        return false;
+    }
+
+    // Empty file could not be mapped
+    size_t size = (size_t)status.st_size;
+    if (size > 0)
+    {
+        void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, file, 0);
+        if (data == MAP_FAILED)
+        {
+            close(file);
+            return false;
+        }
+
+        // Advise the system to read ahead the file aggressively
+        madvise(data, size, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+        // Transparent huge pages for file mappings are supported only by some file systems
+        if (huge_pages)
+            madvise(data, size, MADV_HUGEPAGE);
+#endif
+
+        _data = data;
+    }
+
+    // The mapping stays valid after the file is closed
+    close(file);
+
+    _size = size;
+#endif
+
+    _opened = true;
+    return true;
+}
+
+void ITCHMappedFile::Close()
+{
+    if (!_opened)
+        return;
+
+#if defined(_WIN32) || defined(_WIN64)
+    if (_data != nullptr)
+        UnmapViewOfFile(_data);
+    if (_mapping != nullptr)
+        CloseHandle(_mapping);
+    CloseHandle(_file);
+    _file = INVALID_HANDLE_VALUE;
+    _mapping = nullptr;
+#else
+    if (_data != nullptr)
+        munmap(_data, _size);
+#endif
+
+    _opened = false;
+    _data = nullptr;
+    _size = 0;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
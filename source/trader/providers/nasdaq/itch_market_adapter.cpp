@@ -0,0 +1,83 @@
+/*!
+    \file itch_market_adapter.cpp
+    \brief NASDAQ ITCH market adapter implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_market_adapter.h"
+
+namespace CppTrader {
+namespace ITCH {
+
+using namespace Matching;
+
+ITCHMarketAdapter::ITCHMarketAdapter(MarketManagerOptimized& market)
+    : _market(market),
+      _messages(0),
+      _errors(0)
+{
+}
+
+bool ITCHMarketAdapter::onMessage(const StockDirectoryMessage& message)
+{
+    ++_messages;
+    Symbol symbol(message.StockLocate, message.Stock);
+    ErrorCode result = _market.AddSymbol(symbol);
+    if (result == ErrorCode::OK)
+        result = _market.AddOrderBook(symbol);
+    return Apply(result);
+}
+
+bool ITCHMarketAdapter::onMessage(const AddOrderMessage& message)
+{
+    ++_messages;
+    return Apply(_market.AddOrder(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares));
+}
+
+bool ITCHMarketAdapter::onMessage(const AddOrderMPIDMessage& message)
+{
+    ++_messages;
+    return Apply(_market.AddOrder(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares));
+}
+
+bool ITCHMarketAdapter::onMessage(const OrderExecutedMessage& message)
+{
+    ++_messages;
+    return Apply(_market.ExecuteOrder(message.OrderReferenceNumber, message.ExecutedShares));
+}
+
+bool ITCHMarketAdapter::onMessage(const OrderExecutedWithPriceMessage& message)
+{
+    ++_messages;
+    return Apply(_market.ExecuteOrder(message.OrderReferenceNumber, message.ExecutionPrice, message.ExecutedShares));
+}
+
+bool ITCHMarketAdapter::onMessage(const OrderCancelMessage& message)
+{
+    ++_messages;
+    return Apply(_market.ReduceOrder(message.OrderReferenceNumber, message.CanceledShares));
+}
+
+bool ITCHMarketAdapter::onMessage(const OrderDeleteMessage& message)
+{
+    ++_messages;
+    return Apply(_market.DeleteOrder(message.OrderReferenceNumber));
+}
+
+bool ITCHMarketAdapter::onMessage(const OrderReplaceMessage& message)
+{
+    ++_messages;
+    return Apply(_market.ReplaceOrder(message.OriginalOrderReferenceNumber, message.NewOrderReferenceNumber, message.Price, message.Shares));
+}
+
+bool ITCHMarketAdapter::Apply(ErrorCode result) noexcept
+{
+    if (result != ErrorCode::OK)
+        ++_errors;
+    return true;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
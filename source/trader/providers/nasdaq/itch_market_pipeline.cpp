@@ -0,0 +1,21 @@
+/*!
+    \file itch_market_pipeline.cpp
+    \brief NASDAQ ITCH market pipeline implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_market_pipeline.h"
+
+namespace CppTrader {
+namespace ITCH {
+
+ITCHMarketPipeline::ITCHMarketPipeline(const std::vector<Matching::MarketHandler*>& market_handlers, size_t queue_capacity)
+    : _market(market_handlers, false, queue_capacity),
+      _routed(0)
+{
+}
+
+} // namespace ITCH
+} // namespace CppTrader
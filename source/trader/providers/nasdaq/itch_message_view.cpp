@@ -0,0 +1,151 @@
+/*!
+    \file itch_message_view.cpp
+    \brief NASDAQ ITCH message views implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_handler.h"
+
+namespace CppTrader {
+namespace ITCH {
+
+StockDirectoryMessage StockDirectoryView::Decode() const noexcept
+{
+    StockDirectoryMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    CopyString(11, message.Stock);
+    message.MarketCategory = MarketCategory();
+    message.FinancialStatusIndicator = FinancialStatusIndicator();
+    message.RoundLotSize = RoundLotSize();
+    message.RoundLotsOnly = RoundLotsOnly();
+    message.IssueClassification = IssueClassification();
+    CopyString(27, message.IssueSubType);
+    message.Authenticity = Authenticity();
+    message.ShortSaleThresholdIndicator = ShortSaleThresholdIndicator();
+    message.IPOFlag = IPOFlag();
+    message.LULDReferencePriceTier = LULDReferencePriceTier();
+    message.ETPFlag = ETPFlag();
+    message.ETPLeverageFactor = ETPLeverageFactor();
+    message.InverseIndicator = InverseIndicator();
+    return message;
+}
+
+AddOrderMessage AddOrderView::Decode() const noexcept
+{
+    AddOrderMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    message.BuySellIndicator = BuySellIndicator();
+    message.Shares = Shares();
+    CopyString(24, message.Stock);
+    message.Price = Price();
+    return message;
+}
+
+AddOrderMPIDMessage AddOrderMPIDView::Decode() const noexcept
+{
+    AddOrderMPIDMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    message.BuySellIndicator = BuySellIndicator();
+    message.Shares = Shares();
+    CopyString(24, message.Stock);
+    message.Price = Price();
+    message.Attribution = Attribution();
+    return message;
+}
+
+OrderExecutedMessage OrderExecutedView::Decode() const noexcept
+{
+    OrderExecutedMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    message.ExecutedShares = ExecutedShares();
+    message.MatchNumber = MatchNumber();
+    return message;
+}
+
+OrderExecutedWithPriceMessage OrderExecutedWithPriceView::Decode() const noexcept
+{
+    OrderExecutedWithPriceMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    message.ExecutedShares = ExecutedShares();
+    message.MatchNumber = MatchNumber();
+    message.Printable = Printable();
+    message.ExecutionPrice = ExecutionPrice();
+    return message;
+}
+
+OrderCancelMessage OrderCancelView::Decode() const noexcept
+{
+    OrderCancelMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    message.CanceledShares = CanceledShares();
+    return message;
+}
+
+OrderDeleteMessage OrderDeleteView::Decode() const noexcept
+{
+    OrderDeleteMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    return message;
+}
+
+OrderReplaceMessage OrderReplaceView::Decode() const noexcept
+{
+    OrderReplaceMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OriginalOrderReferenceNumber = OriginalOrderReferenceNumber();
+    message.NewOrderReferenceNumber = NewOrderReferenceNumber();
+    message.Shares = Shares();
+    message.Price = Price();
+    return message;
+}
+
+TradeMessage TradeView::Decode() const noexcept
+{
+    TradeMessage message;
+    message.Type = Type();
+    message.StockLocate = StockLocate();
+    message.TrackingNumber = TrackingNumber();
+    message.Timestamp = Timestamp();
+    message.OrderReferenceNumber = OrderReferenceNumber();
+    message.BuySellIndicator = BuySellIndicator();
+    message.Shares = Shares();
+    CopyString(24, message.Stock);
+    message.Price = Price();
+    message.MatchNumber = MatchNumber();
+    return message;
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -0,0 +1,289 @@
+/*!
+    \file itch_parallel_decoder.cpp
+    \brief NASDAQ ITCH parallel decoder implementation
+    \author Ivan Shynkarenka
+    \date 16.10.2026
+    \copyright MIT License
+*/
+
+#include "trader/providers/nasdaq/itch_parallel_decoder.h"
+
+#include <algorithm>
+
+namespace CppTrader {
+namespace ITCH {
+
+namespace {
+
+template <class TMessage>
+bool DecodeMessage(const void* buffer, size_t size, ITCHParallelDecoder::Message& message)
+{
+    return ITCHDecoder::Decode(buffer, size, message.emplace<TMessage>());
+}
+
+} // namespace
+
+ITCHParallelDecoder::ITCHParallelDecoder(size_t threads, size_t chunk_size)
+    : _threads((threads > 0) ? threads : std::max(std::thread::hardware_concurrency(), 1u)),
+      _chunk_size((chunk_size > 0) ? chunk_size : DEFAULT_CHUNK_SIZE),
+      _shutdown(false),
+      _data(nullptr),
+      _next(0),
+      _delivered(0),
+      _decoding(0),
+      _stop(true)
+{
+    // Single thread decoder processes buffers in the calling thread
+    if (_threads < 2)
+        return;
+
+    // Decode only a limited window of chunks ahead of the delivered one
+    _slots.resize(2 * _threads);
+
+    // Start worker threads
+    try
+    {
+        _workers.reserve(_threads);
+        for (size_t i = 0; i < _threads; ++i)
+            _workers.emplace_back([this]() { Worker(); });
+    }
+    catch (...)
+    {
+        // Stop already started worker threads
+        Shutdown();
+        throw;
+    }
+}
+
+ITCHParallelDecoder::~ITCHParallelDecoder()
+{
+    Shutdown();
+}
+
+void ITCHParallelDecoder::Shutdown()
+{
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _chunk_delivered.notify_all();
+
+    for (auto& worker : _workers)
+        worker.join();
+    _workers.clear();
+}
+
+void ITCHParallelDecoder::StopBuffer()
+{
+    // Wait for chunks being decoded, so worker threads do not access the buffer anymore
+    std::unique_lock<std::mutex> lock(_mutex);
+    _stop = true;
+    _chunk_decoded.wait(lock, [this]() { return _decoding == 0; });
+    _chunks.clear();
+    _data = nullptr;
+}
+
+void ITCHParallelDecoder::Worker()
+{
+    for (;;)
+    {
+        size_t index;
+        {
+            // Wait for the next chunk with a free slot
+            std::unique_lock<std::mutex> lock(_mutex);
+            _chunk_delivered.wait(lock, [this]() { return _shutdown || (!_stop && (_next < _chunks.size()) && (_next < (_delivered + _slots.size()))); });
+            if (_shutdown)
+                return;
+            index = _next++;
+            ++_decoding;
+        }
+
+        Slot& slot = _slots[index % _slots.size()];
+        DecodeChunk(&_data[_chunks[index].Offset], _chunks[index].Size, slot);
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            slot.Index = index;
+            slot.Ready = true;
+            --_decoding;
+        }
+        _chunk_decoded.notify_all();
+    }
+}
+
+bool ITCHParallelDecoder::Process(void* buffer, size_t size, ITCHHandler& handler)
+{
+    // Message views are processed directly from the buffer
+    if ((_threads < 2) || handler.IsMessageViewsEnabled())
+        return handler.Process(buffer, size);
+
+    uint8_t* data = (uint8_t*)buffer;
+
+    // Index message boundaries and split the buffer into chunks of whole messages
+    std::vector<Chunk> chunks;
+    size_t offset = 0;
+    size_t start = 0;
+    while ((size - offset) >= 2)
+    {
+        uint16_t message_size;
+        CppCommon::Endian::ReadBigEndian(&data[offset], message_size);
+        if (message_size > (size - offset - 2))
+            break;
+
+        offset += 2 + message_size;
+        if ((offset - start) >= _chunk_size)
+        {
+            chunks.push_back({ start, offset - start });
+            start = offset;
+        }
+    }
+    if (offset > start)
+        chunks.push_back({ start, offset - start });
+
+    // Pass the buffer to worker threads
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (auto& slot : _slots)
+            slot.Ready = false;
+        _data = data;
+        _chunks.swap(chunks);
+        _next = 0;
+        _delivered = 0;
+        _stop = false;
+    }
+    _chunk_delivered.notify_all();
+
+    // Stop decoding the buffer when the delivery is finished, failed or thrown
+    struct BufferGuard
+    {
+        ITCHParallelDecoder& Decoder;
+        ~BufferGuard() { Decoder.StopBuffer(); }
+    } guard{ *this };
+
+    // Deliver decoded messages in the chunk order
+    bool result = true;
+    size_t count = _chunks.size();
+    for (size_t index = 0; index < count; ++index)
+    {
+        Slot& slot = _slots[index % _slots.size()];
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _chunk_decoded.wait(lock, [&]() { return slot.Ready && (slot.Index == index); });
+        }
+
+        for (const auto& message : slot.Messages)
+        {
+            result = std::visit([&handler](const auto& msg) { return handler.onMessage(msg); }, message);
+            if (!result)
+                break;
+        }
+        if (slot.Failed)
+            result = false;
+
+        if (!result)
+            break;
+
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            slot.Ready = false;
+            _delivered = index + 1;
+        }
+        _chunk_delivered.notify_all();
+    }
+
+    if (!result)
+        return false;
+
+    // Pass the partial message at the end of the buffer to the handler
+    if (offset < size)
+        return handler.Process(&data[offset], size - offset);
+
+    return true;
+}
+
+bool ITCHParallelDecoder::Decode(const void* buffer, size_t size, Message& message)
+{
+    // Message is empty
+    if (size == 0)
+        return false;
+
+    switch (*(const uint8_t*)buffer)
+    {
+        case 'S':
+            return DecodeMessage<SystemEventMessage>(buffer, size, message);
+        case 'R':
+            return DecodeMessage<StockDirectoryMessage>(buffer, size, message);
+        case 'H':
+            return DecodeMessage<StockTradingActionMessage>(buffer, size, message);
+        case 'Y':
+            return DecodeMessage<RegSHOMessage>(buffer, size, message);
+        case 'L':
+            return DecodeMessage<MarketParticipantPositionMessage>(buffer, size, message);
+        case 'V':
+            return DecodeMessage<MWCBDeclineMessage>(buffer, size, message);
+        case 'W':
+            return DecodeMessage<MWCBStatusMessage>(buffer, size, message);
+        case 'K':
+            return DecodeMessage<IPOQuotingMessage>(buffer, size, message);
+        case 'A':
+            return DecodeMessage<AddOrderMessage>(buffer, size, message);
+        case 'F':
+            return DecodeMessage<AddOrderMPIDMessage>(buffer, size, message);
+        case 'E':
+            return DecodeMessage<OrderExecutedMessage>(buffer, size, message);
+        case 'C':
+            return DecodeMessage<OrderExecutedWithPriceMessage>(buffer, size, message);
+        case 'X':
+            return DecodeMessage<OrderCancelMessage>(buffer, size, message);
+        case 'D':
+            return DecodeMessage<OrderDeleteMessage>(buffer, size, message);
+        case 'U':
+            return DecodeMessage<OrderReplaceMessage>(buffer, size, message);
+        case 'P':
+            return DecodeMessage<TradeMessage>(buffer, size, message);
+        case 'Q':
+            return DecodeMessage<CrossTradeMessage>(buffer, size, message);
+        case 'B':
+            return DecodeMessage<BrokenTradeMessage>(buffer, size, message);
+        case 'I':
+            return DecodeMessage<NOIIMessage>(buffer, size, message);
+        case 'N':
+            return DecodeMessage<RPIIMessage>(buffer, size, message);
+        case 'J':
+            return DecodeMessage<LULDAuctionCollarMessage>(buffer, size, message);
+        default:
+            return DecodeMessage<UnknownMessage>(buffer, size, message);
+    }
+}
+
+void ITCHParallelDecoder::DecodeChunk(const uint8_t* data, size_t size, Slot& slot)
+{
+    // Message buffers keep their capacity between chunks
+    slot.Messages.clear();
+    slot.Failed = false;
+
+    size_t offset = 0;
+    while (offset < size)
+    {
+        uint16_t message_size;
+        offset += CppCommon::Endian::ReadBigEndian(&data[offset], message_size);
+
+        // Empty messages are skipped the same way as the ITCH framer does
+        if (message_size > 0)
+        {
+            slot.Messages.emplace_back();
+            if (!Decode(&data[offset], message_size, slot.Messages.back()))
+            {
+                // Messages before the failed one are still delivered
+                slot.Messages.pop_back();
+                slot.Failed = true;
+                return;
+            }
+        }
+
+        offset += message_size;
+    }
+}
+
+} // namespace ITCH
+} // namespace CppTrader
@@ -0,0 +1,191 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CppTrader::Matching;
+
+namespace {
+
+std::vector<uint64_t> DumpDepth(const std::vector<Level>& bids, const std::vector<Level>& asks)
+{
+    std::vector<uint64_t> result;
+    for (const auto& level : bids)
+        result.insert(result.end(), { level.Price, level.TotalVolume, level.Orders });
+    result.push_back(0);
+    for (const auto& level : asks)
+        result.insert(result.end(), { level.Price, level.TotalVolume, level.Orders });
+    return result;
+}
+
+std::vector<Level> MakeLevels(LevelType type, uint64_t base, size_t count)
+{
+    std::vector<Level> result;
+    for (size_t i = 0; i < count; ++i)
+    {
+        Level level(type, base + i);
+        level.TotalVolume = base * 2;
+        level.Orders = count;
+        result.push_back(level);
+    }
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Depth publisher", "[CppTrader][Matching]")
+{
+    DepthPublisher disabled(0);
+    REQUIRE(!disabled.enabled());
+
+    DepthPublisher publisher(3);
+    REQUIRE(publisher.enabled());
+    REQUIRE(publisher.sequence() == 0);
+
+    DepthSnapshot snapshot;
+    publisher.Read(snapshot);
+    REQUIRE(snapshot.Bids.empty());
+    REQUIRE(snapshot.Asks.empty());
+
+    // Levels above the depth are not published
+    publisher.Publish(MakeLevels(LevelType::BID, 100, 5), MakeLevels(LevelType::ASK, 200, 2));
+    publisher.Read(snapshot);
+    REQUIRE(snapshot.Sequence == 1);
+    REQUIRE(snapshot.Bids.size() == 3);
+    REQUIRE(snapshot.Asks.size() == 2);
+    REQUIRE(snapshot.Bids[2].Price == 102);
+    REQUIRE(snapshot.Asks[1].Price == 201);
+
+    // Publications wrap around all buffers
+    for (uint64_t i = 0; i < 10; ++i)
+        publisher.Publish(MakeLevels(LevelType::BID, i, 1), {});
+    publisher.Read(snapshot);
+    REQUIRE(snapshot.Sequence == 11);
+    REQUIRE(snapshot.Bids.size() == 1);
+    REQUIRE(snapshot.Bids[0].Price == 9);
+    REQUIRE(snapshot.Asks.empty());
+}
+
+TEST_CASE("Depth publisher concurrent readers", "[CppTrader][Matching]")
+{
+    const uint64_t publications = 100000;
+    const size_t depth = 10;
+
+    DepthPublisher publisher(depth);
+    std::atomic<bool> done(false);
+    std::atomic<size_t> torn(0);
+
+    // Readers check the invariant between levels of each publication
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 2; ++i)
+    {
+        readers.emplace_back([&]()
+        {
+            DepthSnapshot snapshot;
+            uint64_t sequence = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                publisher.Read(snapshot);
+                if (snapshot.Sequence < sequence)
+                    ++torn;
+                sequence = snapshot.Sequence;
+                if (snapshot.Sequence == 0)
+                    continue;
+                if ((snapshot.Bids.size() != (snapshot.Sequence % depth)) || (snapshot.Asks.size() != depth))
+                    ++torn;
+                uint64_t base = snapshot.Asks[0].Price;
+                for (size_t j = 0; j < snapshot.Bids.size(); ++j)
+                    if ((snapshot.Bids[j].Price != (base + j)) || (snapshot.Bids[j].TotalVolume != (base * 2)))
+                        ++torn;
+                for (size_t j = 0; j < snapshot.Asks.size(); ++j)
+                    if ((snapshot.Asks[j].Price != (base + j)) || (snapshot.Asks[j].TotalVolume != (base * 2)))
+                        ++torn;
+            }
+        });
+    }
+
+    for (uint64_t i = 1; i <= publications; ++i)
+        publisher.Publish(MakeLevels(LevelType::BID, i, i % depth), MakeLevels(LevelType::ASK, i, depth));
+    done = true;
+
+    for (auto& reader : readers)
+        reader.join();
+
+    REQUIRE(torn == 0);
+    REQUIRE(publisher.sequence() == publications);
+}
+
+TEST_CASE("Market manager depth publication", "[CppTrader][Matching]")
+{
+    const uint32_t symbols = 4;
+    const size_t depth = 5;
+
+    MarketManager market;
+    market.EnableDepth(depth);
+    market.EnableDepthPublication();
+    market.EnableMatching();
+
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        Symbol symbol(i, "test");
+        REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+        REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+        REQUIRE(market.GetOrderBook(i)->depth_publisher().enabled());
+    }
+
+    std::mt19937 random(42);
+    DepthSnapshot snapshot;
+    uint64_t next_id = 1;
+    for (int i = 0; i < 20000; ++i)
+    {
+        uint32_t symbol = random() % symbols;
+        uint64_t id = 1 + random() % next_id;
+        switch (random() % 4)
+        {
+            case 0:
+                market.DeleteOrder(id);
+                break;
+            case 1:
+                market.ModifyOrder(id, 100 + random() % 50, 1 + random() % 100);
+                break;
+            default:
+            {
+                OrderSide side = (random() % 2) ? OrderSide::BUY : OrderSide::SELL;
+                market.AddOrder(Order::Limit(next_id++, symbol, side, 100 + random() % 50, 1 + random() % 100));
+                break;
+            }
+        }
+
+        // Published depth must match the order book depth
+        for (uint32_t j = 0; j < symbols; ++j)
+        {
+            const OrderBook* order_book_ptr = market.GetOrderBook(j);
+            order_book_ptr->depth_publisher().Read(snapshot);
+            REQUIRE(DumpDepth(snapshot.Bids, snapshot.Asks) == DumpDepth(order_book_ptr->bid_depth(), order_book_ptr->ask_depth()));
+        }
+    }
+
+    // Sweep of several price levels is published once
+    Symbol symbol(symbols, "sweep");
+    REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+    for (uint64_t price = 10; price < 15; ++price)
+        REQUIRE(market.AddOrder(Order::Limit(next_id++, symbols, OrderSide::SELL, price, 10)) == ErrorCode::OK);
+    const DepthPublisher& publisher = market.GetOrderBook(symbols)->depth_publisher();
+    uint64_t sequence = publisher.sequence();
+    REQUIRE(sequence == 5);
+    REQUIRE(market.AddOrder(Order::Limit(next_id++, symbols, OrderSide::BUY, 13, 40)) == ErrorCode::OK);
+    REQUIRE(publisher.sequence() == (sequence + 1));
+    publisher.Read(snapshot);
+    REQUIRE(snapshot.Bids.empty());
+    REQUIRE(snapshot.Asks.size() == 1);
+    REQUIRE(snapshot.Asks[0].Price == 14);
+}
@@ -5,9 +5,16 @@
 #include "test.h"
 
 #include "trader/providers/nasdaq/itch_handler.h"
+#include "trader/providers/nasdaq/itch_handler_static.h"
+#include "trader/providers/nasdaq/itch_mapped_file.h"
+#include "trader/providers/nasdaq/itch_parallel_decoder.h"
 
 #include "filesystem/file.h"
 
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
 using namespace CppCommon;
 using namespace CppTrader::ITCH;
 
@@ -79,3 +86,242 @@ TEST_CASE("ITCHHandler", "[CppTrader][Providers][NASDAQ]")
     REQUIRE(itch_handler.errors() == 0);
     REQUIRE(itch_handler.messages() == 1563071);
 }
+
+TEST_CASE("ITCHHandler memory-mapped file", "[CppTrader][Providers][NASDAQ]")
+{
+    MyITCHHandler itch_handler;
+
+    // Map the input file
+    File input("../../tools/itch/sample.itch");
+    if (!input.IsExists())
+        input = File("../tools/itch/sample.itch");
+    REQUIRE(input.IsExists());
+    ITCHMappedFile mapped_file;
+    REQUIRE(mapped_file.Open(input));
+    REQUIRE(mapped_file.IsOpened());
+    REQUIRE(mapped_file.size() == input.size());
+
+    // Process the whole mapped file
+    REQUIRE(mapped_file.Process(itch_handler));
+
+    // Check results
+    REQUIRE(itch_handler.errors() == 0);
+    REQUIRE(itch_handler.messages() == 1563071);
+
+    mapped_file.Close();
+    REQUIRE(!mapped_file.IsOpened());
+    REQUIRE(mapped_file.data() == nullptr);
+    REQUIRE(!mapped_file.Open(File("unknown.itch")));
+}
+
+namespace {
+
+void WriteMessage(std::vector<uint8_t>& buffer, const std::vector<uint8_t>& message)
+{
+    buffer.push_back((uint8_t)(message.size() >> 8));
+    buffer.push_back((uint8_t)message.size());
+    buffer.insert(buffer.end(), message.begin(), message.end());
+}
+
+void WriteBigEndian(std::vector<uint8_t>& message, uint64_t value, size_t size)
+{
+    for (size_t i = size; i-- > 0;)
+        message.push_back((uint8_t)(value >> (8 * i)));
+}
+
+std::vector<uint8_t> MakeHeader(char type, uint16_t locate)
+{
+    std::vector<uint8_t> message;
+    message.push_back((uint8_t)type);
+    WriteBigEndian(message, locate, 2);
+    WriteBigEndian(message, 7, 2);
+    WriteBigEndian(message, 0x123456789ABC, 6);
+    return message;
+}
+
+std::vector<uint8_t> MakeMessages()
+{
+    std::vector<uint8_t> buffer;
+
+    std::vector<uint8_t> add = MakeHeader('A', 5);
+    WriteBigEndian(add, 1001, 8);
+    add.push_back('B');
+    WriteBigEndian(add, 300, 4);
+    add.insert(add.end(), { 'M', 'S', 'F', 'T', ' ', ' ', ' ', ' ' });
+    WriteBigEndian(add, 1234500, 4);
+    WriteMessage(buffer, add);
+
+    std::vector<uint8_t> executed = MakeHeader('E', 5);
+    WriteBigEndian(executed, 1001, 8);
+    WriteBigEndian(executed, 100, 4);
+    WriteBigEndian(executed, 77, 8);
+    WriteMessage(buffer, executed);
+
+    std::vector<uint8_t> replace = MakeHeader('U', 5);
+    WriteBigEndian(replace, 1001, 8);
+    WriteBigEndian(replace, 1002, 8);
+    WriteBigEndian(replace, 150, 4);
+    WriteBigEndian(replace, 1234600, 4);
+    WriteMessage(buffer, replace);
+
+    std::vector<uint8_t> system = MakeHeader('S', 0);
+    system.push_back('O');
+    WriteMessage(buffer, system);
+
+    std::vector<uint8_t> remove = MakeHeader('D', 5);
+    WriteBigEndian(remove, 1002, 8);
+    WriteMessage(buffer, remove);
+
+    return buffer;
+}
+
+class DecodedITCHHandler : public ITCHHandler
+{
+public:
+    std::vector<uint64_t> fields;
+
+protected:
+    bool onMessage(const SystemEventMessage& message) override { fields.insert(fields.end(), { (uint64_t)message.Type, (uint64_t)message.EventCode }); return true; }
+    bool onMessage(const AddOrderMessage& message) override { fields.insert(fields.end(), { (uint64_t)message.Type, message.StockLocate, message.TrackingNumber, message.Timestamp, message.OrderReferenceNumber, (uint64_t)message.BuySellIndicator, message.Shares, (uint64_t)message.Stock[3], message.Price }); return true; }
+    bool onMessage(const OrderExecutedMessage& message) override { fields.insert(fields.end(), { (uint64_t)message.Type, message.OrderReferenceNumber, message.ExecutedShares, message.MatchNumber }); return true; }
+    bool onMessage(const OrderReplaceMessage& message) override { fields.insert(fields.end(), { (uint64_t)message.Type, message.OriginalOrderReferenceNumber, message.NewOrderReferenceNumber, message.Shares, message.Price }); return true; }
+    bool onMessage(const OrderDeleteMessage& message) override { fields.insert(fields.end(), { (uint64_t)message.Type, message.OrderReferenceNumber }); return true; }
+};
+
+class ViewITCHHandler : public DecodedITCHHandler
+{
+protected:
+    bool onMessageView(const AddOrderView& view) override { fields.insert(fields.end(), { (uint64_t)view.Type(), view.StockLocate(), view.TrackingNumber(), view.Timestamp(), view.OrderReferenceNumber(), (uint64_t)view.BuySellIndicator(), view.Shares(), (uint64_t)view.Stock()[3], view.Price() }); return true; }
+    bool onMessageView(const OrderExecutedView& view) override { fields.insert(fields.end(), { (uint64_t)view.Type(), view.OrderReferenceNumber(), view.ExecutedShares(), view.MatchNumber() }); return true; }
+    bool onMessageView(const OrderReplaceView& view) override { fields.insert(fields.end(), { (uint64_t)view.Type(), view.OriginalOrderReferenceNumber(), view.NewOrderReferenceNumber(), view.Shares(), view.Price() }); return true; }
+};
+
+class LimitedITCHHandler : public DecodedITCHHandler
+{
+public:
+    explicit LimitedITCHHandler(size_t limit) : _limit(limit) {}
+
+protected:
+    bool onMessage(const OrderDeleteMessage& message) override { DecodedITCHHandler::onMessage(message); return --_limit > 0; }
+
+private:
+    size_t _limit;
+};
+
+class ThrowingITCHHandler : public DecodedITCHHandler
+{
+public:
+    explicit ThrowingITCHHandler(size_t limit) : _limit(limit) {}
+
+protected:
+    bool onMessage(const OrderDeleteMessage& message) override { DecodedITCHHandler::onMessage(message); if (--_limit == 0) throw std::runtime_error("Handler failure"); return true; }
+
+private:
+    size_t _limit;
+};
+
+class StaticITCHHandler : public BasicITCHHandler<StaticITCHHandler>
+{
+public:
+    std::vector<uint64_t> fields;
+
+    bool onMessage(const AddOrderView& view) { fields.insert(fields.end(), { (uint64_t)view.Type(), view.StockLocate(), view.TrackingNumber(), view.Timestamp(), view.OrderReferenceNumber(), (uint64_t)view.BuySellIndicator(), view.Shares(), (uint64_t)view.Stock()[3], view.Price() }); return true; }
+    bool onMessage(const OrderExecutedMessage& message) { fields.insert(fields.end(), { (uint64_t)message.Type, message.OrderReferenceNumber, message.ExecutedShares, message.MatchNumber }); return true; }
+    bool onMessage(const OrderReplaceMessage& message) { fields.insert(fields.end(), { (uint64_t)message.Type, message.OriginalOrderReferenceNumber, message.NewOrderReferenceNumber, message.Shares, message.Price }); return true; }
+    bool onMessage(const OrderDeleteMessage& message) { fields.insert(fields.end(), { (uint64_t)message.Type, message.OrderReferenceNumber }); return true; }
+};
+
+} // namespace
+
+TEST_CASE("ITCHHandler message views", "[CppTrader][Providers][NASDAQ]")
+{
+    std::vector<uint8_t> buffer = MakeMessages();
+
+    DecodedITCHHandler decoded;
+    REQUIRE(!decoded.IsMessageViewsEnabled());
+    REQUIRE(decoded.Process(buffer.data(), buffer.size()));
+    REQUIRE(decoded.fields.size() == 22);
+    REQUIRE(decoded.fields[4] == 1001);
+    REQUIRE(decoded.fields[6] == 300);
+    REQUIRE(decoded.fields[8] == 1234500);
+
+    // Default view handlers decode messages
+    DecodedITCHHandler defaults;
+    defaults.EnableMessageViews();
+    REQUIRE(defaults.Process(buffer.data(), buffer.size()));
+    REQUIRE(defaults.fields == decoded.fields);
+
+    // Views read the same fields as decoded messages
+    ViewITCHHandler views;
+    views.EnableMessageViews();
+    REQUIRE(views.Process(buffer.data(), buffer.size()));
+    REQUIRE(views.fields == decoded.fields);
+}
+
+TEST_CASE("ITCHHandler static dispatch", "[CppTrader][Providers][NASDAQ]")
+{
+    static_assert(StaticITCHHandler::IsHandled<AddOrderView>(), "Add order view must be handled");
+    static_assert(!StaticITCHHandler::IsHandled<AddOrderMessage>(), "Add order message must not be handled");
+    static_assert(StaticITCHHandler::IsHandled<OrderDeleteMessage>(), "Order delete message must be handled");
+    static_assert(!StaticITCHHandler::IsHandled<SystemEventMessage>(), "System event message must not be handled");
+
+    std::vector<uint8_t> buffer = MakeMessages();
+
+    DecodedITCHHandler decoded;
+    REQUIRE(decoded.Process(buffer.data(), buffer.size()));
+
+    // Unhandled system event message is skipped without parsing
+    std::vector<uint8_t> system = MakeHeader('S', 0);
+    system.insert(system.end(), { 'O', 'X', 'X' });
+    WriteMessage(buffer, system);
+
+    StaticITCHHandler handler;
+    REQUIRE(handler.Process(buffer.data(), buffer.size()));
+    std::vector<uint64_t> expected = decoded.fields;
+    expected.erase(expected.begin() + 18, expected.begin() + 20);
+    REQUIRE(handler.fields == expected);
+
+    // Messages split between buffers are processed the same way
+    StaticITCHHandler split;
+    for (size_t i = 0; i < buffer.size(); i += 7)
+        REQUIRE(split.Process(buffer.data() + i, std::min<size_t>(7, buffer.size() - i)));
+    REQUIRE(split.fields == expected);
+}
+
+TEST_CASE("ITCHHandler parallel decoding", "[CppTrader][Providers][NASDAQ]")
+{
+    std::vector<uint8_t> messages = MakeMessages();
+    std::vector<uint8_t> buffer;
+    for (int i = 0; i < 1000; ++i)
+        buffer.insert(buffer.end(), messages.begin(), messages.end());
+
+    DecodedITCHHandler decoded;
+    REQUIRE(decoded.Process(buffer.data(), buffer.size()));
+
+    // Decoded messages are delivered in the original order
+    ITCHParallelDecoder decoder(4, 1000);
+    REQUIRE(decoder.threads() == 4);
+    REQUIRE(decoder.chunk_size() == 1000);
+    DecodedITCHHandler parallel;
+    REQUIRE(decoder.Process(buffer.data(), buffer.size(), parallel));
+    REQUIRE(parallel.fields == decoded.fields);
+
+    // Partial message at the end of the buffer is completed by the next buffer
+    DecodedITCHHandler split;
+    size_t half = buffer.size() / 2 + 3;
+    REQUIRE(decoder.Process(buffer.data(), half, split));
+    REQUIRE(split.Process(buffer.data() + half, buffer.size() - half));
+    REQUIRE(split.fields == decoded.fields);
+
+    // Handler failure stops the processing
+    LimitedITCHHandler limited(10);
+    REQUIRE(!decoder.Process(buffer.data(), buffer.size(), limited));
+    REQUIRE(limited.fields.size() == (10 * decoded.fields.size() / 1000));
+
+    // Handler exception stops the processing and the decoder is still usable
+    ThrowingITCHHandler throwing(500);
+    REQUIRE_THROWS_AS(decoder.Process(buffer.data(), buffer.size(), throwing), std::runtime_error);
+    DecodedITCHHandler reused;
+    REQUIRE(decoder.Process(buffer.data(), buffer.size(), reused));
+    REQUIRE(reused.fields == decoded.fields);
+}
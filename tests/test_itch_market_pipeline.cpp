@@ -0,0 +1,229 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/providers/nasdaq/itch_market_pipeline.h"
+
+#include <map>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CppTrader::ITCH;
+using namespace CppTrader::Matching;
+
+namespace {
+
+void WriteBigEndian(std::vector<uint8_t>& message, uint64_t value, size_t size)
+{
+    for (size_t i = size; i-- > 0;)
+        message.push_back((uint8_t)(value >> (8 * i)));
+}
+
+std::vector<uint8_t> MakeHeader(char type, uint16_t locate)
+{
+    std::vector<uint8_t> message;
+    message.push_back((uint8_t)type);
+    WriteBigEndian(message, locate, 2);
+    WriteBigEndian(message, 0, 2);
+    WriteBigEndian(message, 0, 6);
+    return message;
+}
+
+void WriteMessage(std::vector<uint8_t>& buffer, std::vector<uint8_t> message, size_t size)
+{
+    message.resize(size, ' ');
+    buffer.push_back((uint8_t)(message.size() >> 8));
+    buffer.push_back((uint8_t)message.size());
+    buffer.insert(buffer.end(), message.begin(), message.end());
+}
+
+// Random ITCH feed of stock directory and order messages
+std::vector<uint8_t> MakeFeed(uint16_t symbols, size_t count)
+{
+    std::vector<uint8_t> buffer;
+
+    for (uint16_t locate = 1; locate <= symbols; ++locate)
+    {
+        std::vector<uint8_t> directory = MakeHeader('R', locate);
+        directory.insert(directory.end(), { 'S', 'T', 'O', 'C', 'K', (uint8_t)('A' + locate), ' ', ' ' });
+        WriteMessage(buffer, directory, 39);
+    }
+
+    std::mt19937 random(42);
+    std::map<uint64_t, uint16_t> orders;
+    uint64_t next_ref = 1;
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t op = random() % 6;
+        if (orders.empty() || (op < 2))
+        {
+            uint16_t locate = (uint16_t)(1 + random() % symbols);
+            std::vector<uint8_t> add = MakeHeader('A', locate);
+            WriteBigEndian(add, next_ref, 8);
+            add.push_back((random() % 2) ? 'B' : 'S');
+            WriteBigEndian(add, 1 + random() % 100, 4);
+            add.insert(add.end(), 8, ' ');
+            WriteBigEndian(add, 1000 + random() % 20, 4);
+            WriteMessage(buffer, add, 36);
+            orders[next_ref++] = locate;
+            continue;
+        }
+
+        // Pick the random live order (unknown references are errors in both market managers)
+        auto it = orders.lower_bound(1 + random() % next_ref);
+        if (it == orders.end())
+            it = orders.begin();
+        uint64_t ref = it->first;
+        uint16_t locate = it->second;
+
+        switch (op)
+        {
+            case 2:
+            {
+                std::vector<uint8_t> executed = MakeHeader('E', locate);
+                WriteBigEndian(executed, ref, 8);
+                WriteBigEndian(executed, 1 + random() % 50, 4);
+                WriteBigEndian(executed, i, 8);
+                WriteMessage(buffer, executed, 31);
+                break;
+            }
+            case 3:
+            {
+                std::vector<uint8_t> cancel = MakeHeader('X', locate);
+                WriteBigEndian(cancel, ref, 8);
+                WriteBigEndian(cancel, 1 + random() % 50, 4);
+                WriteMessage(buffer, cancel, 23);
+                break;
+            }
+            case 4:
+            {
+                std::vector<uint8_t> remove = MakeHeader('D', locate);
+                WriteBigEndian(remove, ref, 8);
+                WriteMessage(buffer, remove, 19);
+                orders.erase(it);
+                break;
+            }
+            default:
+            {
+                std::vector<uint8_t> replace = MakeHeader('U', locate);
+                WriteBigEndian(replace, ref, 8);
+                WriteBigEndian(replace, next_ref, 8);
+                WriteBigEndian(replace, 1 + random() % 100, 4);
+                WriteBigEndian(replace, 1000 + random() % 20, 4);
+                WriteMessage(buffer, replace, 35);
+                orders.erase(it);
+                orders[next_ref++] = locate;
+                break;
+            }
+        }
+
+        // Other messages are skipped by the pipeline
+        if ((i % 100) == 0)
+        {
+            std::vector<uint8_t> system = MakeHeader('S', 0);
+            system.push_back('O');
+            WriteMessage(buffer, system, 12);
+        }
+    }
+
+    return buffer;
+}
+
+class MyITCHHandler : public ITCHHandler
+{
+public:
+    explicit MyITCHHandler(MarketManager& market) : _market(market), _errors(0) {}
+
+    size_t errors() const { return _errors; }
+
+protected:
+    bool onMessage(const StockDirectoryMessage& message) override { Symbol symbol(message.StockLocate, message.Stock); Apply(_market.AddSymbol(symbol)); Apply(_market.AddOrderBook(symbol)); return true; }
+    bool onMessage(const AddOrderMessage& message) override { Apply(_market.AddOrder(Order::Limit(message.OrderReferenceNumber, message.StockLocate, (message.BuySellIndicator == 'B') ? OrderSide::BUY : OrderSide::SELL, message.Price, message.Shares))); return true; }
+    bool onMessage(const OrderExecutedMessage& message) override { Apply(_market.ExecuteOrder(message.OrderReferenceNumber, message.ExecutedShares)); return true; }
+    bool onMessage(const OrderCancelMessage& message) override { Apply(_market.ReduceOrder(message.OrderReferenceNumber, message.CanceledShares)); return true; }
+    bool onMessage(const OrderDeleteMessage& message) override { Apply(_market.DeleteOrder(message.OrderReferenceNumber)); return true; }
+    bool onMessage(const OrderReplaceMessage& message) override { Apply(_market.ReplaceOrder(message.OriginalOrderReferenceNumber, message.NewOrderReferenceNumber, message.Price, message.Shares)); return true; }
+
+private:
+    MarketManager& _market;
+    size_t _errors;
+
+    void Apply(ErrorCode result) { if (result != ErrorCode::OK) ++_errors; }
+};
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    std::thread::id thread() const { return _thread; }
+
+protected:
+    void onAddOrder(const Order& order) override { _thread = std::this_thread::get_id(); }
+
+private:
+    std::thread::id _thread;
+};
+
+std::vector<uint64_t> DumpLevels(const OrderBook::Levels& levels)
+{
+    std::vector<uint64_t> result;
+    for (const auto& level : levels)
+        result.insert(result.end(), { level.Price, level.TotalVolume, level.Orders });
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("ITCH market pipeline", "[CppTrader][Providers][NASDAQ]")
+{
+    const uint16_t symbols = 10;
+    const size_t workers = 3;
+
+    std::vector<uint8_t> feed = MakeFeed(symbols, 50000);
+
+    // Reference order books built in the single thread
+    MarketManager reference;
+    MyITCHHandler itch_handler(reference);
+    REQUIRE(itch_handler.Process(feed.data(), feed.size()));
+
+    std::vector<MyMarketHandler> market_handlers(workers);
+    std::vector<MarketHandler*> market_handler_ptrs;
+    for (auto& market_handler : market_handlers)
+        market_handler_ptrs.push_back(&market_handler);
+
+    // Small queues make the decode thread wait for book workers
+    ITCHMarketPipeline pipeline(market_handler_ptrs, 64);
+    REQUIRE(pipeline.workers() == workers);
+    REQUIRE(pipeline.Process(feed.data(), feed.size()));
+    pipeline.Wait();
+
+    REQUIRE(pipeline.processed() == pipeline.routed());
+    REQUIRE(pipeline.errors() == itch_handler.errors());
+
+    // Order books of each worker must match reference order books
+    size_t orders = 0;
+    for (uint16_t locate = 1; locate <= symbols; ++locate)
+    {
+        const MarketManager& market = pipeline.market(pipeline.WorkerOf(locate));
+        const OrderBook* order_book_ptr = market.GetOrderBook(locate);
+        const OrderBook* reference_ptr = reference.GetOrderBook(locate);
+        REQUIRE(order_book_ptr != nullptr);
+        REQUIRE(reference_ptr != nullptr);
+        REQUIRE(DumpLevels(order_book_ptr->bids()) == DumpLevels(reference_ptr->bids()));
+        REQUIRE(DumpLevels(order_book_ptr->asks()) == DumpLevels(reference_ptr->asks()));
+
+        // Other workers do not own the order book
+        for (size_t i = 0; i < workers; ++i)
+            if (i != pipeline.WorkerOf(locate))
+                REQUIRE(pipeline.market(i).GetOrderBook(locate) == nullptr);
+    }
+    for (size_t i = 0; i < workers; ++i)
+        orders += pipeline.market(i).orders().size();
+    REQUIRE(orders == reference.orders().size());
+
+    // Market handlers are called from book worker threads
+    for (const auto& market_handler : market_handlers)
+        REQUIRE(market_handler.thread() != std::this_thread::get_id());
+}
@@ -0,0 +1,179 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_journal.h"
+
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+namespace {
+
+// Dump all orders of the order book in the price level queue order
+std::vector<uint64_t> DumpOrders(const OrderBook& order_book)
+{
+    std::vector<uint64_t> result;
+    for (const LevelNode* level_ptr = order_book.best_bid(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        for (const OrderNode* order_ptr = level_ptr->OrderList.front(); order_ptr != nullptr; order_ptr = order_ptr->next)
+            result.insert(result.end(), { order_ptr->Id, order_ptr->Price, order_ptr->LeavesQuantity });
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_ask(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        for (const OrderNode* order_ptr = level_ptr->OrderList.front(); order_ptr != nullptr; order_ptr = order_ptr->next)
+            result.insert(result.end(), { order_ptr->Id, order_ptr->Price, order_ptr->LeavesQuantity });
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Market journal", "[CppTrader][Matching]")
+{
+    const Path path("test_market_journal.bin");
+
+    MarketManager market;
+    uint64_t appended;
+    {
+        // Small preallocation size to extend the journal file several times
+        MarketJournal journal(market, path, 4096, 100000);
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            Symbol symbol(i, "test");
+            REQUIRE(journal.AddSymbol(symbol) == ErrorCode::OK);
+            REQUIRE(journal.AddOrderBook(symbol) == ErrorCode::OK);
+        }
+        journal.EnableMatching();
+
+        std::mt19937 random(42);
+        std::vector<uint64_t> active;
+        uint64_t next_id = 1;
+        for (int i = 0; i < 20000; ++i)
+        {
+            int action = random() % 10;
+            if ((action < 5) || active.empty())
+            {
+                uint64_t id = next_id++;
+                uint32_t symbol = random() % 2;
+                uint64_t price = 100 + random() % 20;
+                uint64_t quantity = 1 + random() % 100;
+                Order order = (random() % 2) ? Order::BuyLimit(id, symbol, price, quantity) : Order::SellLimit(id, symbol, price, quantity);
+                REQUIRE(journal.AddOrder(order) == ErrorCode::OK);
+                active.push_back(id);
+            }
+            else
+            {
+                uint64_t id = active[random() % active.size()];
+                switch (action)
+                {
+                    case 5:
+                        REQUIRE(journal.ReduceOrder(id, 10) == ErrorCode::OK);
+                        break;
+                    case 6:
+                        REQUIRE(journal.ModifyOrder(id, 100 + random() % 20, 50) == ErrorCode::OK);
+                        break;
+                    case 7:
+                    {
+                        uint64_t new_id = next_id++;
+                        REQUIRE(journal.ReplaceOrder(id, new_id, market.GetOrder(id)->Price, 50) == ErrorCode::OK);
+                        active.push_back(new_id);
+                        break;
+                    }
+                    case 8:
+                        REQUIRE(journal.ExecuteOrder(id, 5) == ErrorCode::OK);
+                        break;
+                    default:
+                        REQUIRE(journal.DeleteOrder(id) == ErrorCode::OK);
+                        break;
+                }
+            }
+
+            // Forget filled and deleted orders
+            for (size_t j = active.size(); j-- > 0;)
+                if (market.GetOrder(active[j]) == nullptr)
+                    active.erase(active.begin() + j);
+
+            // Some explicit commits in the middle of the flow
+            if ((i % 5000) == 0)
+            {
+                REQUIRE(journal.Commit() == ErrorCode::OK);
+                REQUIRE(journal.committed() == journal.appended());
+            }
+        }
+
+        REQUIRE(journal.Commit() == ErrorCode::OK);
+        REQUIRE(journal.committed() == journal.appended());
+        REQUIRE(!journal.failed());
+        appended = journal.appended();
+    }
+    REQUIRE(!market.orders().empty());
+
+    // Replay the journal file into a fresh market manager
+    MarketManager recovered;
+    uint64_t records;
+    REQUIRE(MarketJournal::Replay(path, recovered, records) == ErrorCode::OK);
+    REQUIRE(records == appended);
+    REQUIRE(recovered.IsMatchingEnabled());
+    REQUIRE(recovered.orders().size() == market.orders().size());
+    for (uint32_t i = 0; i < 2; ++i)
+        REQUIRE(DumpOrders(*recovered.GetOrderBook(i)) == DumpOrders(*market.GetOrderBook(i)));
+
+    // Preallocated journal file tail is filled with zeros
+    std::vector<uint8_t> buffer = File::ReadAllBytes(path);
+    REQUIRE((buffer.size() % 4096) == 0);
+
+    // Find the journal end
+    size_t size = sizeof(JournalHeader);
+    size_t last = size;
+    while ((size < buffer.size()) && (buffer[size] != 0))
+    {
+        last = size;
+        size += buffer[size];
+    }
+
+    // Torn write of the last record
+    MarketManager torn;
+    REQUIRE(MarketJournal::Replay(buffer.data(), size - 1, torn, records) == ErrorCode::OK);
+    REQUIRE(records == (appended - 1));
+
+    // Broken checksum of the last record
+    buffer[last + sizeof(JournalRecord)] ^= 0xFF;
+    MarketManager broken;
+    REQUIRE(MarketJournal::Replay(buffer.data(), buffer.size(), broken, records) == ErrorCode::OK);
+    REQUIRE(records == (appended - 1));
+
+    // Broken checksum of the record followed by other records is invalid
+    std::vector<uint8_t> corrupted(buffer);
+    corrupted[sizeof(JournalHeader) + sizeof(JournalRecord)] ^= 0x01;
+    MarketManager corrupted_market;
+    REQUIRE(MarketJournal::Replay(corrupted.data(), corrupted.size(), corrupted_market, records) == ErrorCode::JOURNAL_INVALID);
+
+    // Garbage after the journal end is invalid
+    std::vector<uint8_t> garbage(buffer);
+    garbage[last + sizeof(JournalRecord)] ^= 0x01;
+    garbage[garbage.size() - 1] = 0xFF;
+    MarketManager garbage_market;
+    REQUIRE(MarketJournal::Replay(garbage.data(), garbage.size(), garbage_market, records) == ErrorCode::JOURNAL_INVALID);
+
+    // Corrupted journal file is invalid
+    const Path corrupted_path("test_market_journal_corrupted.bin");
+    {
+        File file(corrupted_path);
+        file.OpenOrCreate(false, true, true);
+        REQUIRE(file.Write(corrupted.data(), corrupted.size()) == corrupted.size());
+        file.Close();
+    }
+    MarketManager corrupted_file_market;
+    REQUIRE(MarketJournal::Replay(corrupted_path, corrupted_file_market, records) == ErrorCode::JOURNAL_INVALID);
+    File::Remove(corrupted_path);
+
+    // Broken signature is invalid
+    buffer[0] ^= 0xFF;
+    MarketManager invalid;
+    REQUIRE(MarketJournal::Replay(buffer.data(), buffer.size(), invalid, records) == ErrorCode::JOURNAL_INVALID);
+    REQUIRE(records == 0);
+
+    File::Remove(path);
+}
@@ -10,6 +10,8 @@
 #include "filesystem/file.h"
 
 #include <algorithm>
+#include <random>
+#include <vector>
 
 using namespace CppCommon;
 using namespace CppTrader::ITCH;
@@ -77,6 +79,41 @@ private:
     size_t _execute_orders;
 };
 
+class MyStaticMarketHandler : public StaticMarketHandler
+{
+public:
+    MyStaticMarketHandler()
+        : _updates(0),
+          _add_orders(0),
+          _update_orders(0),
+          _delete_orders(0),
+          _execute_orders(0)
+    {}
+
+    size_t updates() const { return _updates; }
+    size_t add_orders() const { return _add_orders; }
+    size_t update_orders() const { return _update_orders; }
+    size_t delete_orders() const { return _delete_orders; }
+    size_t execute_orders() const { return _execute_orders; }
+
+    void onAddSymbol(const Symbol& symbol) { ++_updates; }
+    void onAddOrderBook(const OrderBook& order_book) { ++_updates; }
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) { ++_updates; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) { ++_updates; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) { ++_updates; }
+    void onAddOrder(const Order& order) { ++_updates; ++_add_orders; }
+    void onUpdateOrder(const Order& order) { ++_updates; ++_update_orders; }
+    void onDeleteOrder(const Order& order) { ++_updates; ++_delete_orders; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) { ++_updates; ++_execute_orders; }
+
+private:
+    size_t _updates;
+    size_t _add_orders;
+    size_t _update_orders;
+    size_t _delete_orders;
+    size_t _execute_orders;
+};
+
 class MyITCHHandler : public ITCHHandler
 {
 public:
@@ -119,6 +156,24 @@ private:
     size_t _errors;
 };
 
+class TrailingMarketHandler : public MarketHandler
+{
+public:
+    TrailingMarketHandler() : _trailing_updates(0) {}
+
+    size_t trailing_updates() const { return _trailing_updates; }
+
+protected:
+    void onUpdateOrder(const Order& order) override
+    {
+        if (order.IsTrailingStop() || order.IsTrailingStopLimit())
+            ++_trailing_updates;
+    }
+
+private:
+    size_t _trailing_updates;
+};
+
 } // namespace
 
 TEST_CASE("Market manager", "[CppTrader][Matching]")
@@ -161,3 +216,373 @@ TEST_CASE("Market manager", "[CppTrader][Matching]")
     REQUIRE(market_handler.delete_orders() == 58915);
     REQUIRE(market_handler.execute_orders() == 2435);
 }
+
+TEST_CASE("Market manager with static market handlers", "[CppTrader][Matching]")
+{
+    MyMarketHandler market_handler;
+    MyStaticMarketHandler static_handler;
+    MarketHandlerList<MarketHandler, MyStaticMarketHandler> market_handlers(market_handler, static_handler);
+    BasicMarketManager<MarketHandlerList<MarketHandler, MyStaticMarketHandler>> market(market_handlers);
+    market.EnableMatching();
+
+    Symbol symbol(0, "test");
+    REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+
+    REQUIRE(market.AddOrder(Order::BuyLimit(1, 0, 10, 10)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::BuyLimit(2, 0, 20, 10)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::SellLimit(3, 0, 30, 10)) == ErrorCode::OK);
+    REQUIRE(market.ModifyOrder(1, 15, 20) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::SellLimit(4, 0, 15, 25)) == ErrorCode::OK);
+    REQUIRE(market.DeleteOrder(3) == ErrorCode::OK);
+
+    const OrderBook* order_book = market.GetOrderBook(0);
+    REQUIRE(order_book->bids_size() == 1);
+    REQUIRE(order_book->asks_size() == 0);
+    REQUIRE(order_book->best_bid()->TotalVolume == 5);
+
+    // Both handlers must receive the same market events
+    REQUIRE(static_handler.updates() == market_handler.updates());
+    REQUIRE(static_handler.add_orders() == market_handler.add_orders());
+    REQUIRE(static_handler.update_orders() == market_handler.update_orders());
+    REQUIRE(static_handler.delete_orders() == market_handler.delete_orders());
+    REQUIRE(static_handler.execute_orders() == market_handler.execute_orders());
+    REQUIRE(static_handler.execute_orders() == 4);
+}
+
+TEST_CASE("Market manager order node layout", "[CppTrader][Matching]")
+{
+    REQUIRE(alignof(OrderNode) == 64);
+
+    MarketManager market;
+    Symbol symbol(0, "test");
+    REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::BuyLimit(1, 0, 10, 10)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::BuyLimit(2, 0, 10, 20)) == ErrorCode::OK);
+
+    // List links, price level and hot order fields share the first cache line
+    const OrderNode* order_ptr = static_cast<const OrderNode*>(market.GetOrder(2));
+    REQUIRE(order_ptr != nullptr);
+    uintptr_t line = (uintptr_t)order_ptr;
+    REQUIRE((line % 64) == 0);
+    auto hot = [line](const void* field, size_t size) { return ((uintptr_t)field >= line) && (((uintptr_t)field + size) <= (line + 64)); };
+    REQUIRE(hot(&order_ptr->next, sizeof(order_ptr->next)));
+    REQUIRE(hot(&order_ptr->prev, sizeof(order_ptr->prev)));
+    REQUIRE(hot(&order_ptr->Level, sizeof(order_ptr->Level)));
+    REQUIRE(hot(&order_ptr->Id, sizeof(order_ptr->Id)));
+    REQUIRE(hot(&order_ptr->Price, sizeof(order_ptr->Price)));
+    REQUIRE(hot(&order_ptr->LeavesQuantity, sizeof(order_ptr->LeavesQuantity)));
+    REQUIRE(hot(&order_ptr->MaxVisibleQuantity, sizeof(order_ptr->MaxVisibleQuantity)));
+    REQUIRE(hot(&order_ptr->SymbolId, sizeof(order_ptr->SymbolId)));
+    REQUIRE(hot(&order_ptr->Type, sizeof(order_ptr->Type)));
+    REQUIRE(hot(&order_ptr->Side, sizeof(order_ptr->Side)));
+    REQUIRE(hot(&order_ptr->TimeInForce, sizeof(order_ptr->TimeInForce)));
+    REQUIRE(!hot(&order_ptr->TrailingStep, sizeof(order_ptr->TrailingStep)));
+
+    REQUIRE(order_ptr->Level != nullptr);
+    REQUIRE(order_ptr->prev == market.GetOrder(1));
+    REQUIRE(market.ReduceOrder(2, 5) == ErrorCode::OK);
+    REQUIRE(market.GetOrderBook(0)->best_bid()->TotalVolume == 25);
+}
+
+TEST_CASE("Market manager order book depth", "[CppTrader][Matching]")
+{
+    const size_t depth = 5;
+
+    // Walk the best price levels of the order book side
+    auto walk = [depth](const OrderBook& order_book, const LevelNode* level_ptr)
+    {
+        std::vector<uint64_t> result;
+        for (size_t i = 0; (i < depth) && (level_ptr != nullptr); ++i, level_ptr = order_book.GetNextLevel(level_ptr))
+            result.insert(result.end(), { level_ptr->Price, level_ptr->TotalVolume, level_ptr->VisibleVolume, level_ptr->Orders });
+        return result;
+    };
+    auto dump = [](const std::vector<Level>& levels)
+    {
+        std::vector<uint64_t> result;
+        for (const auto& level : levels)
+            result.insert(result.end(), { level.Price, level.TotalVolume, level.VisibleVolume, level.Orders });
+        return result;
+    };
+
+    for (bool ladder : { false, true })
+    {
+        MarketManager market;
+        market.EnableDepth(depth);
+        if (ladder)
+            market.EnablePriceLadder(1, 16);
+        REQUIRE(market.IsDepthEnabled());
+
+        Symbol symbol(0, "test");
+        REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+        REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+        market.EnableMatching();
+
+        const OrderBook* order_book = market.GetOrderBook(0);
+        REQUIRE(order_book->depth() == depth);
+
+        std::mt19937 random(42);
+        std::vector<uint64_t> active;
+        uint64_t next_id = 1;
+
+        for (int i = 0; i < 20000; ++i)
+        {
+            int action = random() % 10;
+            if ((action < 5) || active.empty())
+            {
+                uint64_t id = next_id++;
+                uint64_t price = 100 + random() % 40;
+                uint64_t quantity = 1 + random() % 100;
+                uint64_t visible = (random() % 4) ? std::numeric_limits<uint64_t>::max() : quantity / 2;
+                REQUIRE(market.AddOrder(Order::Limit(id, 0, (random() % 2) ? OrderSide::BUY : OrderSide::SELL, price, quantity, OrderTimeInForce::GTC, visible)) == ErrorCode::OK);
+                active.push_back(id);
+            }
+            else
+            {
+                uint64_t id = active[random() % active.size()];
+                if (action < 7)
+                    REQUIRE(market.ReduceOrder(id, 1 + random() % 20) == ErrorCode::OK);
+                else if (action < 8)
+                    REQUIRE(market.ModifyOrder(id, 100 + random() % 40, 1 + random() % 100) == ErrorCode::OK);
+                else
+                    REQUIRE(market.DeleteOrder(id) == ErrorCode::OK);
+            }
+
+            // Forget filled and deleted orders
+            for (size_t j = active.size(); j-- > 0;)
+                if (market.GetOrder(active[j]) == nullptr)
+                    active.erase(active.begin() + j);
+
+            REQUIRE(dump(order_book->bid_depth()) == walk(*order_book, order_book->best_bid()));
+            REQUIRE(dump(order_book->ask_depth()) == walk(*order_book, order_book->best_ask()));
+        }
+    }
+}
+
+TEST_CASE("Market manager trailing stop repricing", "[CppTrader][Matching]")
+{
+    // Expected trailing stop order state
+    struct Trailing
+    {
+        uint64_t Id;
+        bool Buy;
+        int64_t Distance;
+        int64_t Step;
+        uint64_t StopPrice;
+        int64_t Limit;
+    };
+
+    // Reprice the expected trailing stop order with the given market price
+    auto reprice = [](Trailing& trailing, uint64_t market_price)
+    {
+        uint64_t distance = (trailing.Distance < 0) ? (((uint64_t)-trailing.Distance * market_price) / 10000) : (uint64_t)trailing.Distance;
+        uint64_t step = (trailing.Step < 0) ? (((uint64_t)-trailing.Step * market_price) / 10000) : (uint64_t)trailing.Step;
+        uint64_t stop_price = trailing.Buy ? (market_price + distance) : ((market_price > distance) ? (market_price - distance) : 0);
+        bool repriced = trailing.Buy ?
+            ((stop_price < trailing.StopPrice) && ((trailing.StopPrice - stop_price) >= step)) :
+            ((stop_price > trailing.StopPrice) && ((stop_price - trailing.StopPrice) >= step));
+        if (repriced)
+            trailing.StopPrice = stop_price;
+        return repriced;
+    };
+
+    for (bool ladder : { false, true })
+    {
+        TrailingMarketHandler handler;
+        MarketManager market(handler);
+        if (ladder)
+            market.EnablePriceLadder(1, 64);
+
+        // Trailing buy stop orders are placed into the first order book, trailing sell stop orders into the second one
+        for (uint32_t i = 0; i < 2; ++i)
+        {
+            Symbol symbol(i, "test");
+            REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+            REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+        }
+        market.EnableMatching();
+
+        std::mt19937 random(42);
+        std::vector<Trailing> trailing;
+        uint64_t next_id = 1;
+        uint64_t ask = 100000;
+        uint64_t bid = 100000;
+
+        // Trade at the given price to move the market price
+        auto trade = [&](uint32_t symbol, uint64_t price)
+        {
+            OrderSide side = (symbol == 0) ? OrderSide::SELL : OrderSide::BUY;
+            OrderSide opposite = (symbol == 0) ? OrderSide::BUY : OrderSide::SELL;
+            REQUIRE(market.AddOrder(Order::Limit(next_id++, symbol, side, price, 2)) == ErrorCode::OK);
+            REQUIRE(market.AddOrder(Order::Limit(next_id++, symbol, opposite, price, 1)) == ErrorCode::OK);
+        };
+
+        // Add a new trailing stop order with the random trailing distance and step
+        auto add = [&]()
+        {
+            Trailing order;
+            order.Id = next_id++;
+            order.Buy = (random() % 2) != 0;
+            if (random() % 2)
+            {
+                order.Distance = 1 + random() % 200;
+                order.Step = random() % order.Distance;
+            }
+            else
+            {
+                order.Distance = -(int64_t)(1 + random() % 100);
+                order.Step = -(int64_t)(random() % -order.Distance);
+            }
+            order.StopPrice = order.Buy ? (ask + 1 + random() % 5000) : (bid - 1 - random() % 5000);
+            order.Limit = (random() % 4) ? 0 : (order.Buy ? 10 : -10);
+            uint32_t symbol = order.Buy ? 0 : 1;
+            OrderSide side = order.Buy ? OrderSide::BUY : OrderSide::SELL;
+            if (order.Limit != 0)
+                REQUIRE(market.AddOrder(Order::TrailingStopLimit(order.Id, symbol, side, order.StopPrice, order.StopPrice + order.Limit, 10, order.Distance, order.Step)) == ErrorCode::OK);
+            else
+                REQUIRE(market.AddOrder(Order::TrailingStop(order.Id, symbol, side, order.StopPrice, 10, order.Distance, order.Step)) == ErrorCode::OK);
+
+            // New trailing stop order is repriced with the current market price
+            reprice(order, order.Buy ? ask : bid);
+            trailing.push_back(order);
+        };
+
+        trade(0, ask);
+        trade(1, bid);
+        for (int i = 0; i < 1000; ++i)
+            add();
+
+        size_t updates = 0;
+        for (int i = 0; i < 500; ++i)
+        {
+            // Move the market prices towards trailing stop orders
+            ask -= 1 + random() % 50;
+            bid += 1 + random() % 50;
+            trade(0, ask);
+            trade(1, bid);
+            for (auto& order : trailing)
+                if (reprice(order, order.Buy ? ask : bid))
+                    ++updates;
+
+            // Replace some trailing stop orders
+            if ((i % 10) == 0)
+            {
+                for (int j = 0; j < 10; ++j)
+                {
+                    size_t index = random() % trailing.size();
+                    REQUIRE(market.DeleteOrder(trailing[index].Id) == ErrorCode::OK);
+                    trailing.erase(trailing.begin() + index);
+                    add();
+                }
+            }
+
+            for (const auto& order : trailing)
+            {
+                const Order* order_ptr = market.GetOrder(order.Id);
+                REQUIRE(order_ptr != nullptr);
+                REQUIRE(order_ptr->StopPrice == order.StopPrice);
+                if (order.Limit != 0)
+                    REQUIRE(order_ptr->Price == (uint64_t)(order.StopPrice + order.Limit));
+            }
+        }
+
+        // Each trailing stop order must be repriced once per market price move
+        REQUIRE(updates > 0);
+        REQUIRE(handler.trailing_updates() == updates);
+    }
+}
+
+TEST_CASE("Market manager pending matching", "[CppTrader][Matching]")
+{
+    class PendingMarketHandler : public MarketHandler
+    {
+    public:
+        const std::vector<size_t>& executions() const { return _executions; }
+
+        void Resize(size_t symbols) { _executions.assign(symbols, 0); }
+
+    protected:
+        void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_executions[order.SymbolId]; }
+
+    private:
+        std::vector<size_t> _executions;
+    };
+
+    class MemoryWriter : public Writer
+    {
+    public:
+        explicit MemoryWriter(std::vector<uint8_t>& buffer) : _buffer(buffer) {}
+        size_t Write(const void* buffer, size_t size) override { _buffer.insert(_buffer.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + size); return size; }
+    private:
+        std::vector<uint8_t>& _buffer;
+    };
+
+    auto crossed = [](const OrderBook* order_book)
+    {
+        return (order_book->best_bid() != nullptr) && (order_book->best_ask() != nullptr) && (order_book->best_bid()->Price >= order_book->best_ask()->Price);
+    };
+
+    const uint32_t symbols = 1000;
+
+    PendingMarketHandler handler;
+    handler.Resize(symbols);
+    MarketManager market(handler);
+
+    // Preload the market with disabled matching
+    uint64_t next_id = 1;
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        Symbol symbol(i, "test");
+        REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+        REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+        REQUIRE(market.AddOrder(Order::BuyLimit(next_id++, i, 100, 10)) == ErrorCode::OK);
+        REQUIRE(market.AddOrder(Order::SellLimit(next_id++, i, 110, 10)) == ErrorCode::OK);
+    }
+
+    // Cross a few order books and add the stop order which could be activated
+    REQUIRE(market.AddOrder(Order::BuyLimit(next_id++, 3, 120, 5)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::SellLimit(next_id++, 7, 90, 5)) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(Order::BuyStop(next_id++, 11, 105, 5)) == ErrorCode::OK);
+    REQUIRE(crossed(market.GetOrderBook(3)));
+    REQUIRE(crossed(market.GetOrderBook(7)));
+
+    // Enabling automatic matching uncrosses only changed order books
+    market.EnableMatching();
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        REQUIRE(!crossed(market.GetOrderBook(i)));
+        REQUIRE(handler.executions()[i] == (((i == 3) || (i == 7) || (i == 11)) ? 2 : 0));
+    }
+    REQUIRE(market.GetOrderBook(11)->best_buy_stop() == nullptr);
+
+    // Crossed order books of the batch are matched after enabling automatic matching
+    market.DisableMatching();
+    std::vector<MarketCommand> commands = { MarketCommand::AddOrder(Order::BuyLimit(next_id++, 20, 110, 5)), MarketCommand::AddOrder(Order::SellLimit(next_id++, 21, 100, 5)) };
+    std::vector<ErrorCode> results(commands.size());
+    REQUIRE(market.ProcessBatch(commands.data(), commands.size(), results.data()) == 0);
+    REQUIRE(crossed(market.GetOrderBook(20)));
+    REQUIRE(crossed(market.GetOrderBook(21)));
+    REQUIRE(market.ProcessCommand(MarketCommand::Match()) == ErrorCode::OK);
+    REQUIRE(!market.IsMatchingEnabled());
+    REQUIRE(!crossed(market.GetOrderBook(20)));
+    REQUIRE(!crossed(market.GetOrderBook(21)));
+    REQUIRE(handler.executions()[20] == 2);
+    REQUIRE(handler.executions()[21] == 2);
+
+    // Crossed order books of the market snapshot are matched after enabling automatic matching
+    REQUIRE(market.AddOrder(Order::BuyLimit(next_id++, 30, 115, 5)) == ErrorCode::OK);
+    std::vector<uint8_t> snapshot;
+    MemoryWriter writer(snapshot);
+    REQUIRE(market.SaveSnapshot(writer) == ErrorCode::OK);
+    PendingMarketHandler restored_handler;
+    restored_handler.Resize(symbols);
+    MarketManager restored(restored_handler);
+    REQUIRE(restored.LoadSnapshot(snapshot.data(), snapshot.size()) == ErrorCode::OK);
+    REQUIRE(crossed(restored.GetOrderBook(30)));
+    REQUIRE(restored.ProcessCommand(MarketCommand::EnableMatching()) == ErrorCode::OK);
+    REQUIRE(restored.IsMatchingEnabled());
+    REQUIRE(!crossed(restored.GetOrderBook(30)));
+    for (uint32_t i = 0; i < symbols; ++i)
+        REQUIRE(restored_handler.executions()[i] == ((i == 30) ? 2 : 0));
+}
@@ -0,0 +1,314 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+#include "trader/matching/market_manager_optimized.h"
+#include "trader/providers/nasdaq/itch_market_adapter.h"
+
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::ITCH;
+using namespace CppTrader::Matching;
+
+namespace {
+
+class MyMarketHandler : public MarketHandlerOptimized
+{
+public:
+    MyMarketHandler()
+        : _add_levels(0),
+          _update_levels(0),
+          _delete_levels(0),
+          _add_orders(0),
+          _update_orders(0),
+          _delete_orders(0),
+          _execute_orders(0),
+          _execute_volume(0)
+    {}
+
+    size_t add_levels() const { return _add_levels; }
+    size_t update_levels() const { return _update_levels; }
+    size_t delete_levels() const { return _delete_levels; }
+    size_t add_orders() const { return _add_orders; }
+    size_t update_orders() const { return _update_orders; }
+    size_t delete_orders() const { return _delete_orders; }
+    size_t execute_orders() const { return _execute_orders; }
+    uint64_t execute_volume() const { return _execute_volume; }
+
+protected:
+    void onAddLevel(const OrderBookOptimized& order_book, const Level& level, bool top) override { ++_add_levels; }
+    void onUpdateLevel(const OrderBookOptimized& order_book, const Level& level, bool top) override { ++_update_levels; }
+    void onDeleteLevel(const OrderBookOptimized& order_book, const Level& level, bool top) override { ++_delete_levels; }
+    void onAddOrder(const OrderOptimized& order) override { ++_add_orders; }
+    void onUpdateOrder(const OrderOptimized& order) override { ++_update_orders; }
+    void onDeleteOrder(const OrderOptimized& order) override { ++_delete_orders; }
+    void onExecuteOrder(const OrderOptimized& order, uint64_t price, uint64_t quantity) override { ++_execute_orders; _execute_volume += quantity; }
+
+private:
+    size_t _add_levels;
+    size_t _update_levels;
+    size_t _delete_levels;
+    size_t _add_orders;
+    size_t _update_orders;
+    size_t _delete_orders;
+    size_t _execute_orders;
+    uint64_t _execute_volume;
+};
+
+std::vector<uint64_t> DumpLevels(const OrderBookOptimized& order_book, const OrderBookOptimized::Levels& levels)
+{
+    std::vector<uint64_t> result;
+    for (const auto& price_level : levels)
+    {
+        const Level& level = order_book.GetLevel(price_level);
+        result.insert(result.end(), { level.Price, level.TotalVolume, level.Orders });
+    }
+    return result;
+}
+
+std::vector<uint64_t> DumpLevels(const OrderBook::Levels& levels, bool reverse)
+{
+    std::vector<uint64_t> result;
+    for (const auto& level : levels)
+        result.insert(reverse ? result.begin() : result.end(), { level.Price, level.TotalVolume, level.Orders });
+    return result;
+}
+
+class ITCHMessageBuilder
+{
+public:
+    ITCHMessageBuilder& Byte(uint8_t value) { _buffer.push_back(value); return *this; }
+    ITCHMessageBuilder& Number(uint64_t value, size_t size)
+    {
+        for (size_t i = size; i-- > 0;)
+            _buffer.push_back((uint8_t)(value >> (8 * i)));
+        return *this;
+    }
+    ITCHMessageBuilder& String(const char* value)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            _buffer.push_back((uint8_t)value[i]);
+        return *this;
+    }
+    ITCHMessageBuilder& Header(char type, uint16_t locate) { return Byte(type).Number(locate, 2).Number(0, 2).Number(0, 6); }
+
+    void* data() { return _buffer.data(); }
+    size_t size() const { return _buffer.size(); }
+
+private:
+    std::vector<uint8_t> _buffer;
+};
+
+} // namespace
+
+TEST_CASE("Optimized market manager", "[CppTrader][Matching]")
+{
+    MyMarketHandler market_handler;
+    MarketManagerOptimized market(market_handler);
+
+    Symbol symbol(0, "test");
+    REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+
+    const OrderBookOptimized* order_book = market.GetOrderBook(0);
+    REQUIRE(order_book != nullptr);
+
+    // Add bid and ask price levels
+    REQUIRE(market.AddOrder(1, 0, OrderSide::BUY, 10, 10) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(2, 0, OrderSide::BUY, 20, 20) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(3, 0, OrderSide::BUY, 20, 30) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(4, 0, OrderSide::SELL, 40, 10) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(5, 0, OrderSide::SELL, 30, 20) == ErrorCode::OK);
+    REQUIRE(market.AddOrder(6, 1, OrderSide::BUY, 10, 10) == ErrorCode::ORDER_BOOK_NOT_FOUND);
+    REQUIRE(order_book->bids_size() == 2);
+    REQUIRE(order_book->asks_size() == 2);
+    REQUIRE(order_book->best_bid()->Price == 20);
+    REQUIRE(order_book->best_bid()->TotalVolume == 50);
+    REQUIRE(order_book->best_bid()->Orders == 2);
+    REQUIRE(order_book->best_ask()->Price == 30);
+    REQUIRE(order_book->GetBid(10)->TotalVolume == 10);
+    REQUIRE(order_book->GetAsk(40)->TotalVolume == 10);
+    REQUIRE(order_book->GetBid(15) == nullptr);
+    REQUIRE(market_handler.add_levels() == 4);
+
+    // Reduce and execute orders
+    REQUIRE(market.ReduceOrder(2, 5) == ErrorCode::OK);
+    REQUIRE(market.ExecuteOrder(3, 10) == ErrorCode::OK);
+    REQUIRE(order_book->best_bid()->TotalVolume == 35);
+    REQUIRE(market.ExecuteOrder(2, 25, 100) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(2) == nullptr);
+    REQUIRE(order_book->best_bid()->TotalVolume == 20);
+    REQUIRE(order_book->best_bid()->Orders == 1);
+    REQUIRE(market_handler.execute_orders() == 2);
+    REQUIRE(market_handler.execute_volume() == 25);
+
+    // Modify and replace orders
+    REQUIRE(market.ModifyOrder(3, 25, 5) == ErrorCode::OK);
+    REQUIRE(order_book->bids_size() == 2);
+    REQUIRE(order_book->best_bid()->Price == 25);
+    REQUIRE(market.ReplaceOrder(5, 7, 35, 15) == ErrorCode::OK);
+    REQUIRE(market.GetOrder(5) == nullptr);
+    REQUIRE(market.GetOrder(7)->Price == 35);
+    REQUIRE(market.GetOrder(7)->Side == OrderSide::SELL);
+    REQUIRE(order_book->best_ask()->Price == 35);
+    REQUIRE(market.ReplaceOrder(7, 4, 35, 15) == ErrorCode::ORDER_DUPLICATE);
+
+    // Delete all orders
+    REQUIRE(market.DeleteOrder(1) == ErrorCode::OK);
+    REQUIRE(market.DeleteOrder(3) == ErrorCode::OK);
+    REQUIRE(market.DeleteOrder(4) == ErrorCode::OK);
+    REQUIRE(market.DeleteOrder(7) == ErrorCode::OK);
+    REQUIRE(market.DeleteOrder(7) == ErrorCode::ORDER_NOT_FOUND);
+    REQUIRE(order_book->empty());
+    REQUIRE(market.levels().empty());
+    REQUIRE(market_handler.add_orders() == 6);
+    REQUIRE(market_handler.delete_orders() == 6);
+    REQUIRE(market_handler.add_levels() == market_handler.delete_levels());
+
+    REQUIRE(market.DeleteOrderBook(0) == ErrorCode::OK);
+    REQUIRE(market.DeleteSymbol(0) == ErrorCode::OK);
+}
+
+TEST_CASE("Optimized market manager random flow", "[CppTrader][Matching]")
+{
+    MarketManager market;
+    MarketManagerOptimized optimized;
+
+    Symbol symbol(0, "test");
+    market.AddSymbol(symbol);
+    market.AddOrderBook(symbol);
+    optimized.AddSymbol(symbol);
+    optimized.AddOrderBook(symbol);
+
+    std::mt19937 random(42);
+    std::vector<uint64_t> active;
+    uint64_t next_id = 1;
+
+    for (int i = 0; i < 10000; ++i)
+    {
+        int action = random() % 10;
+        if ((action < 4) || (active.size() < 10))
+        {
+            uint64_t id = next_id++;
+            uint64_t quantity = 1 + random() % 100;
+            if (random() % 2)
+            {
+                uint64_t price = 500 + random() % 100;
+                REQUIRE(market.AddOrder(Order::BuyLimit(id, 0, price, quantity)) == ErrorCode::OK);
+                REQUIRE(optimized.AddOrder(id, 0, OrderSide::BUY, price, quantity) == ErrorCode::OK);
+            }
+            else
+            {
+                uint64_t price = 600 + random() % 100;
+                REQUIRE(market.AddOrder(Order::SellLimit(id, 0, price, quantity)) == ErrorCode::OK);
+                REQUIRE(optimized.AddOrder(id, 0, OrderSide::SELL, price, quantity) == ErrorCode::OK);
+            }
+            active.push_back(id);
+            continue;
+        }
+
+        size_t index = random() % active.size();
+        uint64_t id = active[index];
+        uint64_t quantity = 1 + random() % 50;
+        switch (action)
+        {
+            case 4:
+            case 5:
+                REQUIRE(market.ReduceOrder(id, quantity) == ErrorCode::OK);
+                REQUIRE(optimized.ReduceOrder(id, quantity) == ErrorCode::OK);
+                break;
+            case 6:
+                REQUIRE(market.ExecuteOrder(id, quantity) == ErrorCode::OK);
+                REQUIRE(optimized.ExecuteOrder(id, quantity) == ErrorCode::OK);
+                break;
+            case 7:
+            {
+                uint64_t price = market.GetOrder(id)->Price + (random() % 5) - 2;
+                REQUIRE(market.ModifyOrder(id, price, quantity) == ErrorCode::OK);
+                REQUIRE(optimized.ModifyOrder(id, price, quantity) == ErrorCode::OK);
+                break;
+            }
+            case 8:
+            {
+                uint64_t new_id = next_id++;
+                uint64_t price = market.GetOrder(id)->Price + (random() % 5) - 2;
+                REQUIRE(market.ReplaceOrder(id, new_id, price, quantity) == ErrorCode::OK);
+                REQUIRE(optimized.ReplaceOrder(id, new_id, price, quantity) == ErrorCode::OK);
+                active.push_back(new_id);
+                break;
+            }
+            default:
+                REQUIRE(market.DeleteOrder(id) == ErrorCode::OK);
+                REQUIRE(optimized.DeleteOrder(id) == ErrorCode::OK);
+                break;
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+        {
+            if (market.GetOrder(active[j]) == nullptr)
+            {
+                REQUIRE(optimized.GetOrder(active[j]) == nullptr);
+                active.erase(active.begin() + j);
+            }
+        }
+    }
+
+    const OrderBook* order_book = market.GetOrderBook(0);
+    const OrderBookOptimized* optimized_book = optimized.GetOrderBook(0);
+    REQUIRE(order_book->bids_size() == optimized_book->bids_size());
+    REQUIRE(order_book->asks_size() == optimized_book->asks_size());
+    REQUIRE(DumpLevels(*optimized_book, optimized_book->bids()) == DumpLevels(order_book->bids(), false));
+    REQUIRE(DumpLevels(*optimized_book, optimized_book->asks()) == DumpLevels(order_book->asks(), true));
+    REQUIRE(order_book->best_bid()->Price == optimized_book->best_bid()->Price);
+    REQUIRE(order_book->best_ask()->Price == optimized_book->best_ask()->Price);
+    REQUIRE(market.orders().size() == active.size());
+}
+
+TEST_CASE("ITCH market adapter", "[CppTrader][Providers][NASDAQ]")
+{
+    MyMarketHandler market_handler;
+    MarketManagerOptimized market(market_handler);
+    ITCHMarketAdapter adapter(market);
+
+    ITCHMessageBuilder directory;
+    directory.Header('R', 1).String("AAPL    ").Number(0, 20);
+    REQUIRE(adapter.ProcessMessage(directory.data(), directory.size()));
+    REQUIRE(market.GetOrderBook(1) != nullptr);
+
+    ITCHMessageBuilder add_buy;
+    add_buy.Header('A', 1).Number(1, 8).Byte('B').Number(100, 4).String("AAPL    ").Number(1500000, 4);
+    REQUIRE(adapter.ProcessMessage(add_buy.data(), add_buy.size()));
+
+    ITCHMessageBuilder add_sell;
+    add_sell.Header('A', 1).Number(2, 8).Byte('S').Number(200, 4).String("AAPL    ").Number(1510000, 4);
+    REQUIRE(adapter.ProcessMessage(add_sell.data(), add_sell.size()));
+
+    ITCHMessageBuilder execute;
+    execute.Header('E', 1).Number(1, 8).Number(40, 4).Number(1, 8);
+    REQUIRE(adapter.ProcessMessage(execute.data(), execute.size()));
+
+    ITCHMessageBuilder replace;
+    replace.Header('U', 1).Number(2, 8).Number(3, 8).Number(50, 4).Number(1505000, 4);
+    REQUIRE(adapter.ProcessMessage(replace.data(), replace.size()));
+
+    const OrderBookOptimized* order_book = market.GetOrderBook(1);
+    REQUIRE(order_book->best_bid()->Price == 1500000);
+    REQUIRE(order_book->best_bid()->TotalVolume == 60);
+    REQUIRE(order_book->best_ask()->Price == 1505000);
+    REQUIRE(order_book->best_ask()->TotalVolume == 50);
+    REQUIRE(market_handler.execute_volume() == 40);
+
+    ITCHMessageBuilder remove;
+    remove.Header('D', 1).Number(3, 8);
+    REQUIRE(adapter.ProcessMessage(remove.data(), remove.size()));
+    REQUIRE(order_book->asks_size() == 0);
+
+    REQUIRE(adapter.messages() == 6);
+    REQUIRE(adapter.errors() == 0);
+}
@@ -0,0 +1,252 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager_sharded.h"
+
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace CppTrader::Matching;
+
+namespace {
+
+class MyMarketHandler : public MarketHandler
+{
+public:
+    MyMarketHandler()
+        : _add_orders(0),
+          _delete_orders(0),
+          _execute_orders(0),
+          _execute_volume(0)
+    {}
+
+    size_t add_orders() const { return _add_orders; }
+    size_t delete_orders() const { return _delete_orders; }
+    size_t execute_orders() const { return _execute_orders; }
+    uint64_t execute_volume() const { return _execute_volume; }
+    std::thread::id thread() const { return _thread; }
+
+protected:
+    void onAddOrder(const Order& order) override { ++_add_orders; _thread = std::this_thread::get_id(); }
+    void onDeleteOrder(const Order& order) override { ++_delete_orders; }
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_execute_orders; _execute_volume += quantity; }
+
+private:
+    size_t _add_orders;
+    size_t _delete_orders;
+    size_t _execute_orders;
+    uint64_t _execute_volume;
+    std::thread::id _thread;
+};
+
+std::vector<uint64_t> DumpLevels(const OrderBook::Levels& levels)
+{
+    std::vector<uint64_t> result;
+    for (const auto& level : levels)
+        result.insert(result.end(), { level.Price, level.TotalVolume, level.Orders });
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Sharded market manager", "[CppTrader][Matching]")
+{
+    const uint32_t symbols = 16;
+    const size_t shards = 4;
+
+    MyMarketHandler reference_handler;
+    MarketManager reference(reference_handler);
+    reference.EnableMatching();
+
+    std::vector<MyMarketHandler> handlers(shards);
+    std::vector<MarketHandler*> handler_ptrs;
+    for (auto& handler : handlers)
+        handler_ptrs.push_back(&handler);
+
+    // Use the small queue capacity to test the full queue case
+    MarketManagerSharded sharded(handler_ptrs, true, 64);
+    REQUIRE(sharded.shards() == shards);
+
+    auto process = [&](const MarketCommand& command)
+    {
+        REQUIRE(reference.ProcessCommand(command) == ErrorCode::OK);
+        sharded.Submit(command);
+    };
+
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        Symbol symbol(i, "test");
+        process(MarketCommand::AddSymbol(symbol));
+        process(MarketCommand::AddOrderBook(symbol));
+    }
+
+    std::mt19937 random(42);
+    std::vector<std::pair<uint32_t, uint64_t>> active;
+    uint64_t next_id = 1;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        int action = random() % 10;
+        if ((action < 5) || (active.size() < 10))
+        {
+            uint64_t id = next_id++;
+            uint32_t symbol = random() % symbols;
+            uint64_t quantity = 1 + random() % 100;
+            uint64_t price = 550 + random() % 100;
+            if (random() % 2)
+                process(MarketCommand::AddOrder(Order::BuyLimit(id, symbol, price, quantity)));
+            else
+                process(MarketCommand::AddOrder(Order::SellLimit(id, symbol, price, quantity)));
+            active.emplace_back(symbol, id);
+        }
+        else
+        {
+            size_t index = random() % active.size();
+            uint32_t symbol = active[index].first;
+            uint64_t id = active[index].second;
+            uint64_t quantity = 1 + random() % 50;
+            switch (action)
+            {
+                case 5:
+                    process(MarketCommand::ReduceOrder(symbol, id, quantity));
+                    break;
+                case 6:
+                    process(MarketCommand::ExecuteOrder(symbol, id, quantity));
+                    break;
+                case 7:
+                    process(MarketCommand::ModifyOrder(symbol, id, reference.GetOrder(id)->Price + (random() % 5) - 2, quantity));
+                    break;
+                case 8:
+                {
+                    uint64_t new_id = next_id++;
+                    process(MarketCommand::ReplaceOrder(symbol, id, new_id, reference.GetOrder(id)->Price + (random() % 5) - 2, quantity));
+                    active.emplace_back(symbol, new_id);
+                    break;
+                }
+                default:
+                    process(MarketCommand::DeleteOrder(symbol, id));
+                    break;
+            }
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+            if (reference.GetOrder(active[j].second) == nullptr)
+                active.erase(active.begin() + j);
+    }
+
+    sharded.Wait();
+    REQUIRE(sharded.errors() == 0);
+
+    // Compare order books of each symbol with the reference market
+    size_t orders = 0;
+    for (size_t i = 0; i < shards; ++i)
+        orders += sharded.shard(i).orders().size();
+    REQUIRE(orders == reference.orders().size());
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        const OrderBook* order_book = reference.GetOrderBook(i);
+        const OrderBook* sharded_book = sharded.shard(sharded.ShardOf(i)).GetOrderBook(i);
+        REQUIRE(sharded_book != nullptr);
+        REQUIRE(DumpLevels(sharded_book->bids()) == DumpLevels(order_book->bids()));
+        REQUIRE(DumpLevels(sharded_book->asks()) == DumpLevels(order_book->asks()));
+    }
+
+    // Market handlers are called from shard worker threads
+    size_t add_orders = 0;
+    size_t delete_orders = 0;
+    size_t execute_orders = 0;
+    uint64_t execute_volume = 0;
+    for (const auto& handler : handlers)
+    {
+        REQUIRE(handler.thread() != std::this_thread::get_id());
+        add_orders += handler.add_orders();
+        delete_orders += handler.delete_orders();
+        execute_orders += handler.execute_orders();
+        execute_volume += handler.execute_volume();
+    }
+    REQUIRE(add_orders == reference_handler.add_orders());
+    REQUIRE(delete_orders == reference_handler.delete_orders());
+    REQUIRE(execute_orders == reference_handler.execute_orders());
+    REQUIRE(execute_volume == reference_handler.execute_volume());
+}
+
+TEST_CASE("Sharded market manager parallel uncrossing", "[CppTrader][Matching]")
+{
+    const uint32_t symbols = 64;
+    const size_t shards = 4;
+
+    MyMarketHandler reference_handler;
+    MarketManager reference(reference_handler);
+
+    std::vector<MyMarketHandler> handlers(shards);
+    std::vector<MarketHandler*> handler_ptrs;
+    for (auto& handler : handlers)
+        handler_ptrs.push_back(&handler);
+
+    MarketManagerSharded sharded(handler_ptrs, false);
+
+    auto process = [&](const MarketCommand& command)
+    {
+        REQUIRE(reference.ProcessCommand(command) == ErrorCode::OK);
+        sharded.Submit(command);
+    };
+
+    // Preload crossed order books with disabled matching
+    std::mt19937 random(42);
+    uint64_t next_id = 1;
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        Symbol symbol(i, "test");
+        process(MarketCommand::AddSymbol(symbol));
+        process(MarketCommand::AddOrderBook(symbol));
+        for (int j = 0; j < 100; ++j)
+        {
+            uint64_t quantity = 1 + random() % 100;
+            uint64_t price = 550 + random() % 100;
+            if (random() % 2)
+                process(MarketCommand::AddOrder(Order::BuyLimit(next_id++, i, price, quantity)));
+            else
+                process(MarketCommand::AddOrder(Order::SellLimit(next_id++, i, price, quantity)));
+        }
+    }
+
+    // Uncross order books of all shards in parallel
+    reference.EnableMatching();
+    sharded.EnableMatching();
+    sharded.Wait();
+    REQUIRE(sharded.errors() == 0);
+    REQUIRE(reference_handler.execute_orders() > 0);
+
+    size_t execute_orders = 0;
+    uint64_t execute_volume = 0;
+    for (size_t i = 0; i < shards; ++i)
+    {
+        REQUIRE(sharded.shard(i).IsMatchingEnabled());
+        REQUIRE(handlers[i].execute_orders() > 0);
+        execute_orders += handlers[i].execute_orders();
+        execute_volume += handlers[i].execute_volume();
+    }
+    REQUIRE(execute_orders == reference_handler.execute_orders());
+    REQUIRE(execute_volume == reference_handler.execute_volume());
+
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        const OrderBook* order_book = reference.GetOrderBook(i);
+        const OrderBook* sharded_book = sharded.shard(sharded.ShardOf(i)).GetOrderBook(i);
+        REQUIRE(DumpLevels(sharded_book->bids()) == DumpLevels(order_book->bids()));
+        REQUIRE(DumpLevels(sharded_book->asks()) == DumpLevels(order_book->asks()));
+        REQUIRE(((order_book->best_bid() == nullptr) || (order_book->best_ask() == nullptr) || (order_book->best_bid()->Price < order_book->best_ask()->Price)));
+    }
+}
+
+TEST_CASE("Sharded market manager without shards", "[CppTrader][Matching]")
+{
+    std::vector<MarketHandler*> handler_ptrs;
+    REQUIRE_THROWS_AS(MarketManagerSharded(handler_ptrs), std::invalid_argument);
+}
@@ -0,0 +1,124 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_scenario.h"
+
+#include <sstream>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+namespace {
+
+class MemoryWriter : public Writer
+{
+public:
+    const std::vector<uint8_t>& buffer() const { return _buffer; }
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        _buffer.insert(_buffer.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + size);
+        return size;
+    }
+
+private:
+    std::vector<uint8_t> _buffer;
+};
+
+} // namespace
+
+TEST_CASE("Market scenario", "[CppTrader][Matching]")
+{
+    const char* text =
+        "# Every command of the matching engine example\n"
+        "enable matching\n"
+        "add symbol 0 EURUSD\n"
+        "add book 0\n"
+        "\n"
+        "add limit buy 1 0 100 10\n"
+        "add limit sell 2 0 110 10\n"
+        "add ioc limit buy 3 0 90 10\n"
+        "add fok limit sell 4 0 120 10\n"
+        "add aon limit buy 5 0 95 20\n"
+        "add stop buy 6 0 200 10\n"
+        "add stop-limit sell 7 0 50 40 10\n"
+        "add trailing stop sell 8 0 50 10 10 2\n"
+        "add trailing stop-limit buy 9 0 200 210 10 10 2\n"
+        "add market sell 10 0 5\n"
+        "add slippage market buy 11 0 5 0\n"
+        "reduce order 1 1\n"
+        "modify order 1 101 8\n"
+        "mitigate order 1 102 10\n"
+        "replace order 1 12 103 7\n"
+        "execute order 12 0 2\n"
+        "execute order 2 111 1\n"
+        "delete order 5\n"
+        "disable matching\n";
+
+    MarketScenario scenario;
+    std::istringstream input(text);
+    std::string line;
+    while (std::getline(input, line))
+        REQUIRE(scenario.Parse(line) == ErrorCode::OK);
+    REQUIRE(scenario.commands() == 22);
+
+    // Invalid commands are not appended
+    REQUIRE(scenario.Parse("add limit buy 1 0 100") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.Parse("add limit buy 1 0 100 10 10") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.Parse("add limit up 1 0 100 10") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.Parse("add limit buy 1 4294967296 100 10") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.Parse("add symbol x EURUSD") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.Parse("reduce order 1 -1") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.Parse("unknown command") == ErrorCode::SCENARIO_INVALID);
+    REQUIRE(scenario.commands() == 22);
+
+    // Save and load the binary scenario
+    MemoryWriter writer;
+    REQUIRE(scenario.Save(writer) == ErrorCode::OK);
+    REQUIRE(writer.buffer() == scenario.buffer());
+    MarketScenario loaded;
+    REQUIRE(loaded.Load(writer.buffer().data(), writer.buffer().size()) == ErrorCode::OK);
+    REQUIRE(loaded.commands() == scenario.commands());
+    REQUIRE(loaded.buffer() == scenario.buffer());
+
+    // Replay the binary scenario
+    MarketManager market;
+    REQUIRE(loaded.Replay(market) == 0);
+    REQUIRE(!market.IsMatchingEnabled());
+    REQUIRE(market.GetSymbol(0) != nullptr);
+    REQUIRE(market.GetOrderBook(0) != nullptr);
+    REQUIRE(market.GetOrder(1) == nullptr);
+    REQUIRE(market.GetOrder(2)->LeavesQuantity == 4);
+    REQUIRE(market.GetOrder(3) == nullptr);
+    REQUIRE(market.GetOrder(4) == nullptr);
+    REQUIRE(market.GetOrder(5) == nullptr);
+    REQUIRE(market.GetOrder(6)->IsStop());
+    REQUIRE(market.GetOrder(7)->IsStopLimit());
+    REQUIRE(market.GetOrder(8)->IsTrailingStop());
+    REQUIRE(market.GetOrder(9)->IsTrailingStopLimit());
+    REQUIRE(market.GetOrder(12)->Price == 103);
+    REQUIRE(market.GetOrder(12)->LeavesQuantity == 5);
+
+    // Symbol and order book commands
+    MarketScenario symbols;
+    for (auto command : { "add symbol 1 GBPUSD", "add book 1", "delete book 1", "delete symbol 1" })
+        REQUIRE(symbols.Parse(command) == ErrorCode::OK);
+    REQUIRE(symbols.Replay(market) == 0);
+    REQUIRE(market.GetOrderBook(1) == nullptr);
+    REQUIRE(market.GetSymbol(1) == nullptr);
+
+    // Preallocated journal tail is skipped
+    std::vector<uint8_t> journal(scenario.buffer());
+    journal.resize(journal.size() + 4096, 0);
+    REQUIRE(loaded.Load(journal.data(), journal.size()) == ErrorCode::OK);
+    REQUIRE(loaded.commands() == scenario.commands());
+
+    // Broken signature is invalid
+    journal[0] ^= 0xFF;
+    REQUIRE(loaded.Load(journal.data(), journal.size()) == ErrorCode::JOURNAL_INVALID);
+    REQUIRE(loaded.empty());
+}
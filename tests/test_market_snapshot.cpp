@@ -0,0 +1,266 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+namespace {
+
+class MemoryWriter : public Writer
+{
+public:
+    const std::vector<uint8_t>& buffer() const { return _buffer; }
+
+    size_t Write(const void* buffer, size_t size) override
+    {
+        _buffer.insert(_buffer.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + size);
+        return size;
+    }
+
+private:
+    std::vector<uint8_t> _buffer;
+};
+
+class SnapshotMarketHandler : public MarketHandler
+{
+public:
+    SnapshotMarketHandler() : _add_order_books(0), _update_order_books(0), _add_orders(0) {}
+
+    size_t add_order_books() const { return _add_order_books; }
+    size_t update_order_books() const { return _update_order_books; }
+    size_t add_orders() const { return _add_orders; }
+
+protected:
+    void onAddOrderBook(const OrderBook& order_book) override { ++_add_order_books; }
+    void onUpdateOrderBook(const OrderBook& order_book, bool top) override { ++_update_order_books; }
+    void onAddOrder(const Order& order) override { ++_add_orders; }
+
+private:
+    size_t _add_order_books;
+    size_t _update_order_books;
+    size_t _add_orders;
+};
+
+// Dump all price levels and orders of the order book
+std::vector<uint64_t> DumpOrderBook(const OrderBook& order_book)
+{
+    std::vector<uint64_t> result;
+    auto dump = [&result](const LevelNode* level_ptr)
+    {
+        result.insert(result.end(), { level_ptr->Price, level_ptr->TotalVolume, level_ptr->HiddenVolume, level_ptr->VisibleVolume, level_ptr->Orders });
+        for (const OrderNode* order_ptr = level_ptr->OrderList.front(); order_ptr != nullptr; order_ptr = order_ptr->next)
+            result.insert(result.end(), { order_ptr->Id, order_ptr->Price, order_ptr->StopPrice, order_ptr->LeavesQuantity, order_ptr->ExecutedQuantity, (uint64_t)order_ptr->TrailingDistance });
+    };
+
+    for (const LevelNode* level_ptr = order_book.best_bid(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        dump(level_ptr);
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_ask(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        dump(level_ptr);
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_buy_stop(); level_ptr != nullptr; level_ptr = order_book.GetNextStopLevel(level_ptr))
+        dump(level_ptr);
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_sell_stop(); level_ptr != nullptr; level_ptr = order_book.GetNextStopLevel(level_ptr))
+        dump(level_ptr);
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_trailing_buy_stop(); level_ptr != nullptr; level_ptr = order_book.GetNextTrailingStopLevel(level_ptr))
+        dump(level_ptr);
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_trailing_sell_stop(); level_ptr != nullptr; level_ptr = order_book.GetNextTrailingStopLevel(level_ptr))
+        dump(level_ptr);
+    return result;
+}
+
+// Generate a random market flow with limit, stop and trailing stop orders
+void GenerateFlow(std::mt19937& random, std::vector<MarketManager*> markets, uint64_t& next_id, int count)
+{
+    std::vector<uint64_t> active;
+    for (auto& order : markets.front()->orders())
+        active.push_back(order.first);
+
+    for (int i = 0; i < count; ++i)
+    {
+        int action = random() % 10;
+        if ((action < 5) || active.empty())
+        {
+            uint64_t id = next_id++;
+            uint32_t symbol = random() % 2;
+            OrderSide side = (random() % 2) ? OrderSide::BUY : OrderSide::SELL;
+            uint64_t price = 100 + random() % 40;
+            uint64_t stop_price = (side == OrderSide::BUY) ? (price + 30) : (price - 30);
+            uint64_t quantity = 1 + random() % 100;
+            Order order;
+            switch (random() % 8)
+            {
+                case 0:
+                    order = Order::Stop(id, symbol, side, stop_price, quantity);
+                    break;
+                case 1:
+                    order = Order::StopLimit(id, symbol, side, stop_price, price, quantity);
+                    break;
+                case 2:
+                    order = Order::TrailingStop(id, symbol, side, (side == OrderSide::BUY) ? 200 : 50, quantity, 10, 2);
+                    break;
+                default:
+                    order = Order::Limit(id, symbol, side, price, quantity, OrderTimeInForce::GTC, (random() % 4) ? std::numeric_limits<uint64_t>::max() : quantity / 2);
+                    break;
+            }
+            for (auto market : markets)
+                REQUIRE(market->AddOrder(order) == ErrorCode::OK);
+            active.push_back(id);
+        }
+        else
+        {
+            uint64_t id = active[random() % active.size()];
+            uint64_t quantity = 1 + random() % 20;
+            for (auto market : markets)
+            {
+                if (action < 8)
+                    REQUIRE(market->ReduceOrder(id, quantity) == ErrorCode::OK);
+                else
+                    REQUIRE(market->DeleteOrder(id) == ErrorCode::OK);
+            }
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+            if (markets.front()->GetOrder(active[j]) == nullptr)
+                active.erase(active.begin() + j);
+    }
+}
+
+void CompareMarkets(const MarketManager& market1, const MarketManager& market2)
+{
+    REQUIRE(market1.orders().size() == market2.orders().size());
+    for (uint32_t i = 0; i < 2; ++i)
+        REQUIRE(DumpOrderBook(*market1.GetOrderBook(i)) == DumpOrderBook(*market2.GetOrderBook(i)));
+}
+
+} // namespace
+
+TEST_CASE("Market snapshot", "[CppTrader][Matching]")
+{
+    MarketManager market;
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        Symbol symbol(i, "test");
+        REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+        REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+    }
+    market.EnableMatching();
+
+    std::mt19937 random(42);
+    uint64_t next_id = 1;
+    GenerateFlow(random, { &market }, next_id, 20000);
+    REQUIRE(!market.orders().empty());
+    REQUIRE((market.GetOrderBook(0)->buy_stop_size() + market.GetOrderBook(0)->sell_stop_size()) > 0);
+    REQUIRE((market.GetOrderBook(0)->trailing_buy_stop_size() + market.GetOrderBook(0)->trailing_sell_stop_size()) > 0);
+
+    MemoryWriter writer;
+    REQUIRE(market.SaveSnapshot(writer) == ErrorCode::OK);
+
+    // Restore the snapshot into market managers with different containers
+    SnapshotMarketHandler handler;
+    MarketManager restored(handler);
+    MarketManager restored_ladder;
+    restored_ladder.EnablePriceLadder(1, 16);
+    restored_ladder.EnableDepth(5);
+    restored_ladder.EnableDirectOrderIndex(100000);
+    REQUIRE(restored.LoadSnapshot(writer.buffer().data(), writer.buffer().size()) == ErrorCode::OK);
+    REQUIRE(restored_ladder.LoadSnapshot(writer.buffer().data(), writer.buffer().size()) == ErrorCode::OK);
+    REQUIRE(restored.IsMatchingEnabled());
+    REQUIRE(handler.add_order_books() == 2);
+    REQUIRE(handler.update_order_books() == 2);
+    REQUIRE(handler.add_orders() == 0);
+    CompareMarkets(market, restored);
+    CompareMarkets(market, restored_ladder);
+    REQUIRE(restored_ladder.GetOrderBook(0)->bid_depth().size() == std::min<size_t>(5, restored_ladder.GetOrderBook(0)->bids_size()));
+
+    // Restored market managers must process the same flow in the same way
+    GenerateFlow(random, { &market, &restored, &restored_ladder }, next_id, 20000);
+    CompareMarkets(market, restored);
+    CompareMarkets(market, restored_ladder);
+
+    // Truncated snapshot is invalid
+    MarketManager truncated;
+    REQUIRE(truncated.LoadSnapshot(writer.buffer().data(), writer.buffer().size() / 2) == ErrorCode::SNAPSHOT_INVALID);
+
+    // Invalid snapshot is rolled back without handler calls
+    SnapshotMarketHandler truncated_handler;
+    MarketManager rolled_back(truncated_handler);
+    REQUIRE(rolled_back.LoadSnapshot(writer.buffer().data(), writer.buffer().size() - sizeof(Order)) == ErrorCode::SNAPSHOT_INVALID);
+    REQUIRE(rolled_back.orders().empty());
+    REQUIRE(rolled_back.GetSymbol(0) == nullptr);
+    REQUIRE(rolled_back.GetOrderBook(0) == nullptr);
+    REQUIRE(truncated_handler.add_order_books() == 0);
+    REQUIRE(truncated_handler.update_order_books() == 0);
+    MarketManager reference;
+    REQUIRE(reference.LoadSnapshot(writer.buffer().data(), writer.buffer().size()) == ErrorCode::OK);
+    REQUIRE(rolled_back.LoadSnapshot(writer.buffer().data(), writer.buffer().size()) == ErrorCode::OK);
+    CompareMarkets(reference, rolled_back);
+
+    // Order with the type not matching its price level container is invalid
+    std::vector<uint8_t> mistyped(writer.buffer());
+    size_t offset = sizeof(SnapshotHeader) + 2 * sizeof(SnapshotSymbol) + sizeof(SnapshotOrderBook) + sizeof(SnapshotLevel);
+    Order first;
+    std::memcpy(&first, &mistyped[offset], sizeof(first));
+    REQUIRE(first.IsLimit());
+    first.Type = OrderType::STOP;
+    std::memcpy(&mistyped[offset], &first, sizeof(first));
+    MarketManager mistyped_market;
+    REQUIRE(mistyped_market.LoadSnapshot(mistyped.data(), mistyped.size()) == ErrorCode::SNAPSHOT_INVALID);
+    REQUIRE(mistyped_market.orders().empty());
+
+    // Order with leaves quantity above its quantity is invalid
+    first.Type = OrderType::LIMIT;
+    first.LeavesQuantity = first.Quantity + 1;
+    std::memcpy(&mistyped[offset], &first, sizeof(first));
+    REQUIRE(mistyped_market.LoadSnapshot(mistyped.data(), mistyped.size()) == ErrorCode::SNAPSHOT_INVALID);
+
+    // Huge orders count in the header is invalid
+    std::vector<uint8_t> huge(writer.buffer());
+    SnapshotHeader header;
+    std::memcpy(&header, huge.data(), sizeof(header));
+    header.Orders = std::numeric_limits<uint64_t>::max();
+    std::memcpy(huge.data(), &header, sizeof(header));
+    MarketManager huge_market;
+    REQUIRE(huge_market.LoadSnapshot(huge.data(), huge.size()) == ErrorCode::SNAPSHOT_INVALID);
+
+    // Corrupted symbol Id is invalid
+    std::vector<uint8_t> corrupted(writer.buffer());
+    SnapshotSymbol symbol;
+    std::memcpy(&symbol, &corrupted[sizeof(SnapshotHeader)], sizeof(symbol));
+    symbol.Value.Id = std::numeric_limits<uint32_t>::max() - 1;
+    std::memcpy(&corrupted[sizeof(SnapshotHeader)], &symbol, sizeof(symbol));
+    MarketManager corrupted_market;
+    REQUIRE(corrupted_market.LoadSnapshot(corrupted.data(), corrupted.size()) == ErrorCode::SNAPSHOT_INVALID);
+    REQUIRE(corrupted_market.GetSymbol(0) == nullptr);
+
+    // Duplicate order Id is invalid
+    std::vector<uint8_t> duplicate(writer.buffer());
+    Order last;
+    std::memcpy(&last, &duplicate[duplicate.size() - sizeof(last)], sizeof(last));
+    REQUIRE(last.Id != first.Id);
+    last.Id = first.Id;
+    std::memcpy(&duplicate[duplicate.size() - sizeof(last)], &last, sizeof(last));
+    MarketManager duplicate_market;
+    REQUIRE(duplicate_market.LoadSnapshot(duplicate.data(), duplicate.size()) == ErrorCode::SNAPSHOT_INVALID);
+    REQUIRE(duplicate_market.orders().empty());
+
+    // Broken signature is invalid
+    std::vector<uint8_t> broken(writer.buffer());
+    broken[0] ^= 0xFF;
+    MarketManager invalid;
+    REQUIRE(invalid.LoadSnapshot(broken.data(), broken.size()) == ErrorCode::SNAPSHOT_INVALID);
+}
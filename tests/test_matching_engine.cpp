@@ -99,6 +99,33 @@ std::pair<int, int> BookStopVolume(const OrderBook* order_book_ptr)
     return std::make_pair(buy_volume, sell_volume);
 }
 
+class LevelsMarketHandler : public MarketHandler
+{
+public:
+    LevelsMarketHandler() { Reset(); }
+
+    size_t add_levels() const { return _add_levels; }
+    size_t update_levels() const { return _update_levels; }
+    size_t delete_levels() const { return _delete_levels; }
+    size_t update_order_books() const { return _update_order_books; }
+    bool top() const { return _top; }
+
+    void Reset() { _add_levels = _update_levels = _delete_levels = _update_order_books = 0; _top = false; }
+
+protected:
+    void onUpdateOrderBook(const OrderBook& order_book, bool top) override { ++_update_order_books; _top = _top || top; }
+    void onAddLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_add_levels; }
+    void onUpdateLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_update_levels; }
+    void onDeleteLevel(const OrderBook& order_book, const Level& level, bool top) override { ++_delete_levels; }
+
+private:
+    size_t _add_levels;
+    size_t _update_levels;
+    size_t _delete_levels;
+    size_t _update_order_books;
+    bool _top;
+};
+
 }
 
 TEST_CASE("Automatic matching - market order", "[CppTrader][Matching]")
@@ -713,3 +740,229 @@ TEST_CASE("Manual matching", "[CppTrader][Matching]")
     REQUIRE(BookOrders(market.GetOrderBook(0)) == std::make_pair(3, 4));
     REQUIRE(BookVolume(market.GetOrderBook(0)) == std::make_pair(60, 65));
 }
+
+TEST_CASE("Batch processing", "[CppTrader][Matching]")
+{
+    MarketManager market;
+
+    // Prepare symbol & order book
+    const char name[8] = "test";
+    Symbol symbol = { 0, name };
+    MarketCommand prepare[] =
+    {
+        MarketCommand::AddSymbol(symbol),
+        MarketCommand::AddOrderBook(symbol)
+    };
+    ErrorCode prepare_results[2];
+    REQUIRE(market.ProcessBatch(prepare, 2, prepare_results) == 0);
+    REQUIRE(market.GetOrderBook(0) != nullptr);
+
+    // Enable automatic matching
+    market.EnableMatching();
+
+    // Add limit and stop orders in one batch
+    MarketCommand orders[] =
+    {
+        MarketCommand::AddOrder(Order::BuyLimit(1, 0, 10, 10)),
+        MarketCommand::AddOrder(Order::BuyLimit(2, 0, 20, 20)),
+        MarketCommand::AddOrder(Order::BuyLimit(3, 0, 30, 30)),
+        MarketCommand::AddOrder(Order::BuyLimit(4, 1, 30, 30)),
+        MarketCommand::AddOrder(Order::SellLimit(5, 0, 30, 30)),
+        MarketCommand::AddOrder(Order::SellLimit(7, 0, 60, 60)),
+        MarketCommand::AddOrder(Order::BuyStop(6, 0, 70, 40)),
+        MarketCommand::ReduceOrder(0, 1, 5),
+        MarketCommand::ModifyOrder(0, 2, 25, 10)
+    };
+    ErrorCode orders_results[9];
+    REQUIRE(market.ProcessBatch(orders, 9, orders_results) == 1);
+    REQUIRE(orders_results[3] == ErrorCode::ORDER_BOOK_NOT_FOUND);
+    REQUIRE(BookOrders(market.GetOrderBook(0)) == std::make_pair(2, 1));
+    REQUIRE(BookVolume(market.GetOrderBook(0)) == std::make_pair(15, 60));
+    REQUIRE(BookStopOrders(market.GetOrderBook(0)) == std::make_pair(1, 0));
+    REQUIRE(BookStopVolume(market.GetOrderBook(0)) == std::make_pair(40, 0));
+
+    // Stop orders are activated once at the end of the batch
+    MarketCommand execute[] =
+    {
+        MarketCommand::AddOrder(Order::BuyLimit(8, 0, 60, 60)),
+        MarketCommand::ExecuteOrder(0, 1, 5)
+    };
+    ErrorCode execute_results[2];
+    REQUIRE(market.ProcessBatch(execute, 2, execute_results) == 0);
+    REQUIRE(BookOrders(market.GetOrderBook(0)) == std::make_pair(1, 0));
+    REQUIRE(BookVolume(market.GetOrderBook(0)) == std::make_pair(10, 0));
+    REQUIRE(BookStopOrders(market.GetOrderBook(0)) == std::make_pair(0, 0));
+    REQUIRE(BookStopVolume(market.GetOrderBook(0)) == std::make_pair(0, 0));
+}
+
+TEST_CASE("Batch processing stop orders", "[CppTrader][Matching]")
+{
+    const char name[8] = "test";
+    Symbol symbol = { 0, name };
+    MarketCommand commands[] =
+    {
+        MarketCommand::AddSymbol(symbol),
+        MarketCommand::AddOrderBook(symbol),
+        MarketCommand::AddOrder(Order::SellLimit(1, 0, 100, 10)),
+        MarketCommand::AddOrder(Order::SellLimit(2, 0, 110, 10)),
+        MarketCommand::AddOrder(Order::BuyLimit(3, 0, 90, 10)),
+        // Trade inside the batch
+        MarketCommand::AddOrder(Order::BuyLimit(4, 0, 100, 10)),
+        // Sell stop order above the best bid is activated immediately
+        MarketCommand::AddOrder(Order::SellStop(5, 0, 95, 5)),
+        // Stop orders beyond the current market must rest
+        MarketCommand::AddOrder(Order::SellStop(6, 0, 80, 5)),
+        MarketCommand::AddOrder(Order::BuyStop(7, 0, 120, 5))
+    };
+    const size_t count = sizeof(commands) / sizeof(commands[0]);
+
+    // Process commands one by one
+    MarketManager sequential;
+    sequential.EnableMatching();
+    for (const auto& command : commands)
+        REQUIRE(sequential.ProcessCommand(command) == ErrorCode::OK);
+
+    // Process commands in one batch
+    MarketManager batch;
+    batch.EnableMatching();
+    ErrorCode results[count];
+    REQUIRE(batch.ProcessBatch(commands, count, results) == 0);
+
+    for (MarketManager* market : { &sequential, &batch })
+    {
+        REQUIRE(market->GetOrder(5) == nullptr);
+        REQUIRE(market->GetOrder(6) != nullptr);
+        REQUIRE(market->GetOrder(7) != nullptr);
+        REQUIRE(BookOrders(market->GetOrderBook(0)) == std::make_pair(1, 1));
+        REQUIRE(BookVolume(market->GetOrderBook(0)) == std::make_pair(5, 10));
+        REQUIRE(BookStopOrders(market->GetOrderBook(0)) == std::make_pair(1, 1));
+        REQUIRE(BookStopVolume(market->GetOrderBook(0)) == std::make_pair(5, 5));
+    }
+}
+
+TEST_CASE("Batch processing from the market handler", "[CppTrader][Matching]")
+{
+    // Market handler adds the passive order with a nested batch
+    class NestedMarketHandler : public MarketHandler
+    {
+    public:
+        MarketManager* market = nullptr;
+        ErrorCode result = ErrorCode::ORDER_NOT_FOUND;
+
+    protected:
+        void onAddOrder(const Order& order) override
+        {
+            if (order.Id == 3)
+            {
+                MarketCommand nested = MarketCommand::AddOrder(Order::BuyLimit(8, 0, 85, 5));
+                market->ProcessBatch(&nested, 1, &result);
+            }
+        }
+    };
+
+    const char name[8] = "test";
+    Symbol symbol = { 0, name };
+    MarketCommand commands[] =
+    {
+        MarketCommand::AddSymbol(symbol),
+        MarketCommand::AddOrderBook(symbol),
+        MarketCommand::AddOrder(Order::SellLimit(1, 0, 100, 10)),
+        MarketCommand::AddOrder(Order::SellLimit(2, 0, 110, 10)),
+        MarketCommand::AddOrder(Order::BuyLimit(3, 0, 90, 10)),
+        MarketCommand::AddOrder(Order::BuyLimit(4, 0, 100, 10)),
+        MarketCommand::AddOrder(Order::SellStop(5, 0, 95, 5)),
+        MarketCommand::AddOrder(Order::SellStop(6, 0, 80, 5)),
+        MarketCommand::AddOrder(Order::BuyStop(7, 0, 120, 5))
+    };
+    const size_t count = sizeof(commands) / sizeof(commands[0]);
+
+    // Process commands one by one
+    NestedMarketHandler sequential_handler;
+    MarketManager sequential(sequential_handler);
+    sequential_handler.market = &sequential;
+    sequential.EnableMatching();
+    for (const auto& command : commands)
+        REQUIRE(sequential.ProcessCommand(command) == ErrorCode::OK);
+
+    // Process commands in one batch
+    NestedMarketHandler batch_handler;
+    MarketManager batch(batch_handler);
+    batch_handler.market = &batch;
+    batch.EnableMatching();
+    ErrorCode results[count];
+    REQUIRE(batch.ProcessBatch(commands, count, results) == 0);
+
+    REQUIRE(sequential_handler.result == ErrorCode::OK);
+    REQUIRE(batch_handler.result == ErrorCode::OK);
+    for (MarketManager* market : { &sequential, &batch })
+    {
+        REQUIRE(market->GetOrder(5) == nullptr);
+        REQUIRE(market->GetOrder(8) != nullptr);
+        REQUIRE(BookOrders(market->GetOrderBook(0)) == std::make_pair(2, 1));
+        REQUIRE(BookVolume(market->GetOrderBook(0)) == std::make_pair(10, 10));
+        REQUIRE(BookStopOrders(market->GetOrderBook(0)) == std::make_pair(1, 1));
+        REQUIRE(BookStopVolume(market->GetOrderBook(0)) == std::make_pair(5, 5));
+    }
+}
+
+TEST_CASE("Conflation", "[CppTrader][Matching]")
+{
+    LevelsMarketHandler handler;
+    MarketManager market(handler);
+    LevelsMarketHandler conflated_handler;
+    MarketManager conflated(conflated_handler);
+    conflated.EnableConflation();
+    REQUIRE(conflated.IsConflationEnabled());
+
+    // Prepare symbol & order book
+    const char name[8] = "test";
+    Symbol symbol = { 0, name };
+    for (auto manager : { &market, &conflated })
+    {
+        manager->AddSymbol(symbol);
+        manager->AddOrderBook(symbol);
+        manager->EnableMatching();
+
+        // Add sell limit orders at five price levels
+        for (uint64_t i = 1; i <= 5; ++i)
+            REQUIRE(manager->AddOrder(Order::SellLimit(i, 0, i * 10, 10)) == ErrorCode::OK);
+    }
+    REQUIRE(conflated_handler.add_levels() == 5);
+    REQUIRE(conflated_handler.update_order_books() == 5);
+
+    // Sweep four price levels with the market order
+    handler.Reset();
+    conflated_handler.Reset();
+    REQUIRE(market.AddOrder(Order::BuyMarket(6, 0, 45)) == ErrorCode::OK);
+    REQUIRE(conflated.AddOrder(Order::BuyMarket(6, 0, 45)) == ErrorCode::OK);
+    REQUIRE(handler.update_order_books() > 1);
+    REQUIRE(conflated_handler.add_levels() == 0);
+    REQUIRE(conflated_handler.update_levels() == 1);
+    REQUIRE(conflated_handler.delete_levels() == 4);
+    REQUIRE(conflated_handler.update_order_books() == 1);
+    REQUIRE(conflated_handler.top());
+    REQUIRE(BookVolume(conflated.GetOrderBook(0)) == BookVolume(market.GetOrderBook(0)));
+
+    // Price level deleted and added again is notified as updated
+    conflated_handler.Reset();
+    REQUIRE(conflated.ReplaceOrder(5, Order::SellLimit(7, 0, 50, 20)) == ErrorCode::OK);
+    REQUIRE(conflated_handler.add_levels() == 0);
+    REQUIRE(conflated_handler.update_levels() == 1);
+    REQUIRE(conflated_handler.delete_levels() == 0);
+    REQUIRE(conflated_handler.update_order_books() == 1);
+    REQUIRE(BookVolume(conflated.GetOrderBook(0)) == std::make_pair(0, 20));
+
+    // Price level added and deleted in the same batch is not notified
+    conflated_handler.Reset();
+    MarketCommand commands[] =
+    {
+        MarketCommand::AddOrder(Order::BuyLimit(8, 0, 40, 10)),
+        MarketCommand::DeleteOrder(0, 8)
+    };
+    ErrorCode results[2];
+    REQUIRE(conflated.ProcessBatch(commands, 2, results) == 0);
+    REQUIRE(conflated_handler.add_levels() == 0);
+    REQUIRE(conflated_handler.update_levels() == 0);
+    REQUIRE(conflated_handler.delete_levels() == 0);
+    REQUIRE(conflated_handler.update_order_books() == 0);
+}
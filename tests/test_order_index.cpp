@@ -0,0 +1,196 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+TEST_CASE("Order index", "[CppTrader][Matching]")
+{
+    std::vector<std::unique_ptr<OrderNode>> orders;
+    for (uint64_t id : { 1, 2, 4095, 4096, 10000, 20000, 30000 })
+        orders.emplace_back(new OrderNode(Order::BuyLimit(id, 0, 100, 10)));
+
+    OrderIndex index;
+    REQUIRE(!index.enabled());
+    REQUIRE(index.empty());
+
+    // Direct index covers only orders below the limit
+    index.SetLimit(20000);
+    REQUIRE(index.enabled());
+    for (auto& order : orders)
+        REQUIRE(index.Insert(order.get()));
+    REQUIRE(!index.Insert(orders[0].get()));
+    REQUIRE(!index.Insert(orders[6].get()));
+    REQUIRE(index.size() == 7);
+    REQUIRE(index.pages() == 3);
+    REQUIRE(index.overflow().size() == 2);
+
+    for (auto& order : orders)
+        REQUIRE(index.Find(order->Id) == order.get());
+    REQUIRE(index.Find(3) == nullptr);
+    REQUIRE(index.Find(8192) == nullptr);
+    REQUIRE(index.Find(19999) == nullptr);
+    REQUIRE(index.Find(20001) == nullptr);
+
+    // Iterate orders in the direct index and then in the overflow hash map
+    std::vector<uint64_t> ids;
+    for (const auto& order : index)
+    {
+        REQUIRE(order.first == order.second->Id);
+        ids.push_back(order.first);
+    }
+    REQUIRE(ids.size() == 7);
+    std::sort(ids.begin() + 5, ids.end());
+    REQUIRE(ids == std::vector<uint64_t>({ 1, 2, 4095, 4096, 10000, 20000, 30000 }));
+
+    // Empty pages are released
+    REQUIRE(index.Erase(4096));
+    REQUIRE(!index.Erase(4096));
+    REQUIRE(index.pages() == 2);
+    REQUIRE(index.Erase(10000));
+    REQUIRE(index.pages() == 1);
+    REQUIRE(index.Erase(30000));
+    REQUIRE(index.size() == 4);
+    REQUIRE(index.Find(4096) == nullptr);
+    REQUIRE(index.Find(1) == orders[0].get());
+
+    // Change the limit with orders moved into the overflow hash map
+    index.SetLimit(2);
+    REQUIRE(index.size() == 4);
+    REQUIRE(index.pages() == 1);
+    REQUIRE(index.overflow().size() == 3);
+    REQUIRE(index.Find(1) == orders[0].get());
+    REQUIRE(index.Find(2) == orders[1].get());
+    REQUIRE(index.Find(4095) == orders[2].get());
+
+    // Disable the direct index
+    index.SetLimit(0);
+    REQUIRE(!index.enabled());
+    REQUIRE(index.pages() == 0);
+    REQUIRE(index.overflow().size() == 4);
+    REQUIRE(index.Find(20000) == orders[5].get());
+
+    index.Clear();
+    REQUIRE(index.empty());
+    REQUIRE(index.begin() == index.end());
+}
+
+TEST_CASE("Order index reserve", "[CppTrader][Matching]")
+{
+    std::vector<std::unique_ptr<OrderNode>> orders;
+    for (uint64_t id : { 1, 4096, 8192 })
+        orders.emplace_back(new OrderNode(Order::BuyLimit(id, 0, 100, 10)));
+
+    // Pages are reserved only for the given capacity with a huge direct index limit
+    OrderIndex index;
+    index.SetLimit(std::numeric_limits<uint64_t>::max() / 2);
+    index.Reserve(10000);
+    REQUIRE(index.pages() == 0);
+    REQUIRE(index.spare_pages() == 3);
+
+    // Inserts take reserved pages
+    for (auto& order : orders)
+        REQUIRE(index.Insert(order.get()));
+    REQUIRE(index.pages() == 3);
+    REQUIRE(index.spare_pages() == 0);
+
+    // Erases keep reserved pages
+    for (auto& order : orders)
+        REQUIRE(index.Erase(order->Id));
+    REQUIRE(index.pages() == 0);
+    REQUIRE(index.spare_pages() == 3);
+
+    // Pages are reserved only up to a small direct index limit
+    index.SetLimit(100);
+    REQUIRE(index.spare_pages() == 1);
+    index.Reserve(1000000);
+    REQUIRE(index.spare_pages() == 1);
+}
+
+TEST_CASE("Market manager with direct order index", "[CppTrader][Matching]")
+{
+    MarketManager market;
+    MarketManager direct;
+    direct.EnableDirectOrderIndex(50000);
+    direct.ReserveOrders(100000);
+    REQUIRE(direct.IsDirectOrderIndexEnabled());
+
+    Symbol symbol(0, "test");
+    market.AddSymbol(symbol);
+    market.AddOrderBook(symbol);
+    direct.AddSymbol(symbol);
+    direct.AddOrderBook(symbol);
+    market.EnableMatching();
+    direct.EnableMatching();
+
+    std::mt19937 random(42);
+    std::vector<uint64_t> active;
+    uint64_t next_id = 1;
+
+    // Order Ids go beyond the direct index limit
+    for (int i = 0; i < 100000; ++i)
+    {
+        int action = random() % 10;
+        if ((action < 5) || active.empty())
+        {
+            uint64_t id = next_id++;
+            uint64_t price = 100 + random() % 20;
+            uint64_t quantity = 1 + random() % 100;
+            Order order = (random() % 2) ? Order::BuyLimit(id, 0, price, quantity) : Order::SellLimit(id, 0, price, quantity);
+            REQUIRE(market.AddOrder(order) == ErrorCode::OK);
+            REQUIRE(direct.AddOrder(order) == ErrorCode::OK);
+            active.push_back(id);
+        }
+        else
+        {
+            size_t index = random() % active.size();
+            uint64_t id = active[index];
+            switch (action)
+            {
+                case 5:
+                case 6:
+                    REQUIRE(market.ReduceOrder(id, 10) == ErrorCode::OK);
+                    REQUIRE(direct.ReduceOrder(id, 10) == ErrorCode::OK);
+                    break;
+                case 7:
+                {
+                    uint64_t new_id = next_id++;
+                    REQUIRE(market.ReplaceOrder(id, new_id, market.GetOrder(id)->Price, 50) == ErrorCode::OK);
+                    REQUIRE(direct.ReplaceOrder(id, new_id, direct.GetOrder(id)->Price, 50) == ErrorCode::OK);
+                    active.push_back(new_id);
+                    break;
+                }
+                default:
+                    REQUIRE(market.DeleteOrder(id) == ErrorCode::OK);
+                    REQUIRE(direct.DeleteOrder(id) == ErrorCode::OK);
+                    break;
+            }
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+        {
+            if (market.GetOrder(active[j]) == nullptr)
+            {
+                REQUIRE(direct.GetOrder(active[j]) == nullptr);
+                active.erase(active.begin() + j);
+            }
+        }
+    }
+
+    REQUIRE(direct.orders().size() == market.orders().size());
+    REQUIRE(direct.orders().size() == active.size());
+    for (auto id : active)
+        REQUIRE(direct.GetOrder(id)->LeavesQuantity == market.GetOrder(id)->LeavesQuantity);
+}
@@ -0,0 +1,334 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+namespace {
+
+std::vector<Level> BookSide(const OrderBook* order_book_ptr, const LevelNode* best)
+{
+    std::vector<Level> levels;
+    for (const LevelNode* level = best; level != nullptr; level = order_book_ptr->GetNextLevel(level))
+        levels.push_back(*level);
+    return levels;
+}
+
+bool SameLevels(const std::vector<Level>& levels1, const std::vector<Level>& levels2)
+{
+    if (levels1.size() != levels2.size())
+        return false;
+
+    for (size_t i = 0; i < levels1.size(); ++i)
+        if ((levels1[i].Price != levels2[i].Price) || (levels1[i].TotalVolume != levels2[i].TotalVolume) || (levels1[i].Orders != levels2[i].Orders))
+            return false;
+
+    return true;
+}
+
+} // namespace
+
+TEST_CASE("Price ladder", "[CppTrader][Matching]")
+{
+    PriceLadder disabled(0, 0);
+    REQUIRE(!disabled.enabled());
+    REQUIRE(!disabled.IsInWindow(100));
+
+    PriceLadder ladder(10, 100);
+    PriceLadder::Levels overflow;
+    REQUIRE(ladder.enabled());
+    REQUIRE(ladder.capacity() == 128);
+    REQUIRE(ladder.empty());
+
+    // Initial window starts from zero price
+    REQUIRE(ladder.IsInWindow(0));
+    REQUIRE(ladder.IsInWindow(1270));
+    REQUIRE(!ladder.IsInWindow(1280));
+    REQUIRE(!ladder.IsInWindow(15));
+
+    // Move the window and fill some price levels
+    ladder.Rebase(10000, overflow);
+    REQUIRE(!ladder.IsInWindow(1270));
+    REQUIRE(ladder.IsInWindow(10000));
+    REQUIRE(ladder.IsInWindow(9360));
+    REQUIRE(!ladder.IsInWindow(9350));
+    REQUIRE(ladder.IsInWindow(10630));
+    REQUIRE(!ladder.IsInWindow(10640));
+
+    LevelNode level1(LevelType::BID, 9360);
+    LevelNode level2(LevelType::BID, 10000);
+    LevelNode level3(LevelType::BID, 10630);
+    ladder.Insert(&level2);
+    ladder.Insert(&level3);
+    ladder.Insert(&level1);
+    REQUIRE(ladder.size() == 3);
+    REQUIRE(ladder.Find(10000) == &level2);
+    REQUIRE(ladder.Find(10010) == nullptr);
+    REQUIRE(ladder.Lowest() == &level1);
+    REQUIRE(ladder.Highest() == &level3);
+    REQUIRE(ladder.Higher(9360) == &level2);
+    REQUIRE(ladder.Higher(9999) == &level2);
+    REQUIRE(ladder.Higher(10000) == &level3);
+    REQUIRE(ladder.Higher(10630) == nullptr);
+    REQUIRE(ladder.Higher(0) == &level1);
+    REQUIRE(ladder.Lower(10630) == &level2);
+    REQUIRE(ladder.Lower(10001) == &level2);
+    REQUIRE(ladder.Lower(10000) == &level1);
+    REQUIRE(ladder.Lower(9360) == nullptr);
+    REQUIRE(ladder.Lower(100000) == &level3);
+
+    // Overflow price levels are merged with the ladder ones
+    LevelNode level4(LevelType::BID, 20000);
+    LevelNode level5(LevelType::BID, 10005);
+    overflow.insert(level4);
+    overflow.insert(level5);
+    REQUIRE(ladder.Higher(overflow, 10000) == &level5);
+    REQUIRE(ladder.Higher(overflow, 10630) == &level4);
+    REQUIRE(ladder.Lower(overflow, 10630) == &level5);
+    REQUIRE(ladder.Lower(overflow, 20000) == &level3);
+    REQUIRE(ladder.Lower(overflow, 30000) == &level4);
+
+    // Move the window to make some price levels to leave and to enter it
+    ladder.Rebase(19700, overflow);
+    REQUIRE(ladder.size() == 1);
+    REQUIRE(ladder.Find(20000) == &level4);
+    REQUIRE(ladder.Find(19060) == nullptr);
+    REQUIRE(overflow.size() == 4);
+    REQUIRE(ladder.Lowest() == &level4);
+    REQUIRE(ladder.Lower(overflow, 20000) == &level3);
+    REQUIRE(ladder.Lower(overflow, 10630) == &level5);
+
+    ladder.Erase(&level4);
+    REQUIRE(ladder.empty());
+    REQUIRE(ladder.Lowest() == nullptr);
+    REQUIRE(ladder.Higher(0) == nullptr);
+}
+
+TEST_CASE("Price ladder sparse window", "[CppTrader][Matching]")
+{
+    // Window of 16384 ticks is covered by 256 bitmap words and 4 summary words
+    PriceLadder ladder(1, 16384);
+    PriceLadder::Levels overflow;
+    REQUIRE(ladder.capacity() == 16384);
+
+    LevelNode level1(LevelType::ASK, 3);
+    LevelNode level2(LevelType::ASK, 4100);
+    LevelNode level3(LevelType::ASK, 16383);
+    ladder.Insert(&level3);
+    ladder.Insert(&level1);
+    ladder.Insert(&level2);
+    REQUIRE(ladder.Lowest() == &level1);
+    REQUIRE(ladder.Highest() == &level3);
+    REQUIRE(ladder.Higher(3) == &level2);
+    REQUIRE(ladder.Higher(4100) == &level3);
+    REQUIRE(ladder.Lower(16383) == &level2);
+    REQUIRE(ladder.Lower(4100) == &level1);
+
+    // Empty bitmap words are skipped with the summary bitmap
+    ladder.Erase(&level2);
+    REQUIRE(ladder.Higher(3) == &level3);
+    REQUIRE(ladder.Lower(16383) == &level1);
+    ladder.Erase(&level1);
+    REQUIRE(ladder.Lower(16383) == nullptr);
+    REQUIRE(ladder.Lowest() == &level3);
+    ladder.Erase(&level3);
+    REQUIRE(ladder.Lowest() == nullptr);
+    REQUIRE(ladder.Highest() == nullptr);
+
+    // Window wrapped around the ring
+    ladder.Rebase(20000, overflow);
+    LevelNode level4(LevelType::ASK, 16383);
+    LevelNode level5(LevelType::ASK, 16384);
+    LevelNode level6(LevelType::ASK, 28000);
+    ladder.Insert(&level4);
+    ladder.Insert(&level5);
+    ladder.Insert(&level6);
+    REQUIRE(ladder.Lowest() == &level4);
+    REQUIRE(ladder.Highest() == &level6);
+    REQUIRE(ladder.Higher(16383) == &level5);
+    REQUIRE(ladder.Higher(16384) == &level6);
+    REQUIRE(ladder.Lower(28000) == &level5);
+    REQUIRE(ladder.Lower(16384) == &level4);
+}
+
+TEST_CASE("Price ladder order book", "[CppTrader][Matching]")
+{
+    MarketManager tree;
+    MarketManager ladder;
+    ladder.EnablePriceLadder(10, 64);
+    REQUIRE(!tree.IsPriceLadderEnabled());
+    REQUIRE(ladder.IsPriceLadderEnabled());
+
+    char name[8] = "test";
+    Symbol symbol = { 0, name };
+    REQUIRE(tree.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(tree.AddOrderBook(symbol) == ErrorCode::OK);
+    REQUIRE(ladder.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(ladder.AddOrderBook(symbol) == ErrorCode::OK);
+    tree.EnableMatching();
+    ladder.EnableMatching();
+
+    // Replay the same random flow with a drifting mid price, far away and unaligned prices
+    std::mt19937_64 random(12345);
+    std::vector<uint64_t> ids;
+    uint64_t mid = 10000;
+    for (uint64_t id = 1; id <= 20000; ++id)
+    {
+        mid = std::max<uint64_t>(2000, mid + (random() % 21) - 10);
+
+        uint64_t action = random() % 10;
+        if ((action < 6) || ids.empty())
+        {
+            bool buy = (random() % 2) == 0;
+            uint64_t distance = ((random() % 20) == 0) ? (random() % 2000) : (random() % 40);
+            uint64_t price = (buy ? (mid - distance) : (mid + distance)) * 10;
+            if ((random() % 50) == 0)
+                price += 5;
+            uint64_t quantity = 1 + random() % 100;
+
+            Order order = buy ? Order::BuyLimit(id, 0, price, quantity) : Order::SellLimit(id, 0, price, quantity);
+            REQUIRE(tree.AddOrder(order) == ladder.AddOrder(order));
+            ids.push_back(id);
+        }
+        else
+        {
+            size_t index = random() % ids.size();
+            uint64_t order_id = ids[index];
+            ids[index] = ids.back();
+            ids.pop_back();
+
+            // Skip orders filled by the automatic matching
+            if (tree.GetOrder(order_id) == nullptr)
+                continue;
+
+            if (action < 8)
+                REQUIRE(tree.DeleteOrder(order_id) == ladder.DeleteOrder(order_id));
+            else
+                REQUIRE(tree.ReduceOrder(order_id, 10) == ladder.ReduceOrder(order_id, 10));
+        }
+
+        const OrderBook* tree_book = tree.GetOrderBook(0);
+        const OrderBook* ladder_book = ladder.GetOrderBook(0);
+        REQUIRE(tree_book->bids_size() == ladder_book->bids_size());
+        REQUIRE(tree_book->asks_size() == ladder_book->asks_size());
+        REQUIRE(((tree_book->best_bid() == nullptr) ? 0 : tree_book->best_bid()->Price) == ((ladder_book->best_bid() == nullptr) ? 0 : ladder_book->best_bid()->Price));
+        REQUIRE(((tree_book->best_ask() == nullptr) ? 0 : tree_book->best_ask()->Price) == ((ladder_book->best_ask() == nullptr) ? 0 : ladder_book->best_ask()->Price));
+
+        if ((id % 100) == 0)
+        {
+            REQUIRE(SameLevels(BookSide(tree_book, tree_book->best_bid()), BookSide(ladder_book, ladder_book->best_bid())));
+            REQUIRE(SameLevels(BookSide(tree_book, tree_book->best_ask()), BookSide(ladder_book, ladder_book->best_ask())));
+        }
+    }
+
+    // Price ladder keeps most of the price levels
+    const OrderBook* ladder_book = ladder.GetOrderBook(0);
+    REQUIRE(ladder_book->bid_ladder().size() + ladder_book->ask_ladder().size() > 0);
+    REQUIRE(ladder_book->bids().size() < ladder_book->bids_size());
+}
+
+TEST_CASE("Price ladder stop levels", "[CppTrader][Matching]")
+{
+    MarketManager tree;
+    MarketManager ladder;
+    ladder.EnablePriceLadder(10, 64);
+
+    char name[8] = "test";
+    Symbol symbol = { 0, name };
+    REQUIRE(tree.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(tree.AddOrderBook(symbol) == ErrorCode::OK);
+    REQUIRE(ladder.AddSymbol(symbol) == ErrorCode::OK);
+    REQUIRE(ladder.AddOrderBook(symbol) == ErrorCode::OK);
+    tree.EnableMatching();
+    ladder.EnableMatching();
+
+    // Replay the same random flow of limit, stop, stop-limit and trailing stop orders
+    std::mt19937_64 random(54321);
+    std::vector<uint64_t> ids;
+    uint64_t mid = 10000;
+    for (uint64_t id = 1; id <= 20000; ++id)
+    {
+        mid = std::max<uint64_t>(2000, mid + (random() % 21) - 10);
+
+        uint64_t action = random() % 10;
+        if ((action < 7) || ids.empty())
+        {
+            bool buy = (random() % 2) == 0;
+            uint64_t distance = ((random() % 20) == 0) ? (random() % 2000) : (random() % 40);
+            uint64_t quantity = 1 + random() % 100;
+
+            Order order;
+            switch (random() % 5)
+            {
+                case 0:
+                case 1:
+                {
+                    uint64_t price = (buy ? (mid - distance) : (mid + distance)) * 10;
+                    order = buy ? Order::BuyLimit(id, 0, price, quantity) : Order::SellLimit(id, 0, price, quantity);
+                    break;
+                }
+                case 2:
+                {
+                    uint64_t stop_price = (buy ? (mid + 1 + distance) : (mid - 1 - distance)) * 10;
+                    order = buy ? Order::BuyStop(id, 0, stop_price, quantity) : Order::SellStop(id, 0, stop_price, quantity);
+                    break;
+                }
+                case 3:
+                {
+                    uint64_t stop_price = (buy ? (mid + 1 + distance) : (mid - 1 - distance)) * 10;
+                    uint64_t price = buy ? (stop_price + 50) : (stop_price - 50);
+                    order = buy ? Order::BuyStopLimit(id, 0, stop_price, price, quantity) : Order::SellStopLimit(id, 0, stop_price, price, quantity);
+                    break;
+                }
+                default:
+                {
+                    uint64_t stop_price = (buy ? (mid + 1 + distance) : (mid - 1 - distance)) * 10;
+                    int64_t trailing = (int64_t)(20 + (random() % 20) * 10);
+                    order = buy ? Order::TrailingBuyStop(id, 0, stop_price, quantity, trailing, 10) : Order::TrailingSellStop(id, 0, stop_price, quantity, trailing, 10);
+                    break;
+                }
+            }
+
+            REQUIRE(tree.AddOrder(order) == ladder.AddOrder(order));
+            ids.push_back(id);
+        }
+        else
+        {
+            size_t index = random() % ids.size();
+            uint64_t order_id = ids[index];
+            ids[index] = ids.back();
+            ids.pop_back();
+
+            // Skip orders filled or activated by the automatic matching
+            if (tree.GetOrder(order_id) == nullptr)
+                continue;
+
+            REQUIRE(tree.DeleteOrder(order_id) == ladder.DeleteOrder(order_id));
+        }
+
+        const OrderBook* tree_book = tree.GetOrderBook(0);
+        const OrderBook* ladder_book = ladder.GetOrderBook(0);
+        REQUIRE(tree_book->bids_size() == ladder_book->bids_size());
+        REQUIRE(tree_book->asks_size() == ladder_book->asks_size());
+        REQUIRE(tree_book->buy_stop_size() == ladder_book->buy_stop_size());
+        REQUIRE(tree_book->sell_stop_size() == ladder_book->sell_stop_size());
+        REQUIRE(tree_book->trailing_buy_stop_size() == ladder_book->trailing_buy_stop_size());
+        REQUIRE(tree_book->trailing_sell_stop_size() == ladder_book->trailing_sell_stop_size());
+        REQUIRE(((tree_book->best_buy_stop() == nullptr) ? 0 : tree_book->best_buy_stop()->Price) == ((ladder_book->best_buy_stop() == nullptr) ? 0 : ladder_book->best_buy_stop()->Price));
+        REQUIRE(((tree_book->best_sell_stop() == nullptr) ? 0 : tree_book->best_sell_stop()->Price) == ((ladder_book->best_sell_stop() == nullptr) ? 0 : ladder_book->best_sell_stop()->Price));
+        REQUIRE(((tree_book->best_trailing_buy_stop() == nullptr) ? 0 : tree_book->best_trailing_buy_stop()->Price) == ((ladder_book->best_trailing_buy_stop() == nullptr) ? 0 : ladder_book->best_trailing_buy_stop()->Price));
+        REQUIRE(((tree_book->best_trailing_sell_stop() == nullptr) ? 0 : tree_book->best_trailing_sell_stop()->Price) == ((ladder_book->best_trailing_sell_stop() == nullptr) ? 0 : ladder_book->best_trailing_sell_stop()->Price));
+    }
+
+    // Price ladders keep some of the stop price levels
+    const OrderBook* ladder_book = ladder.GetOrderBook(0);
+    REQUIRE(ladder_book->buy_stop_ladder().size() + ladder_book->sell_stop_ladder().size() > 0);
+}
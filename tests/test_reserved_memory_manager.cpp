@@ -0,0 +1,127 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <random>
+#include <vector>
+
+using namespace CppTrader::Matching;
+
+namespace {
+
+std::vector<uint64_t> DumpBook(const OrderBook& order_book)
+{
+    std::vector<uint64_t> result;
+    for (const LevelNode* level_ptr = order_book.best_bid(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        result.insert(result.end(), { level_ptr->Price, level_ptr->TotalVolume, level_ptr->Orders });
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_ask(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        result.insert(result.end(), { level_ptr->Price, level_ptr->TotalVolume, level_ptr->Orders });
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Reserved memory manager", "[CppTrader][Matching]")
+{
+    ReservedMemoryManager memory;
+    REQUIRE(memory.capacity() == 0);
+
+    // Allocate from the heap without the reserved memory region
+    void* heap = memory.malloc(100);
+    REQUIRE(heap != nullptr);
+    REQUIRE(!memory.owns(heap));
+    REQUIRE(memory.allocations() == 1);
+
+    REQUIRE(memory.Reserve(10000, true));
+    REQUIRE(memory.capacity() >= 10000);
+    REQUIRE(memory.size() == 0);
+
+    // Allocate aligned blocks from the reserved memory region
+    void* block1 = memory.malloc(3, 1);
+    void* block2 = memory.malloc(64, 64);
+    void* block3 = memory.malloc(8, 8);
+    REQUIRE(memory.owns(block1));
+    REQUIRE(memory.owns(block2));
+    REQUIRE(memory.owns(block3));
+    REQUIRE(((uintptr_t)block2 % 64) == 0);
+    REQUIRE(((uintptr_t)block3 % 8) == 0);
+    REQUIRE((uint8_t*)block2 >= ((uint8_t*)block1 + 3));
+    REQUIRE((uint8_t*)block3 >= ((uint8_t*)block2 + 64));
+    REQUIRE(memory.allocations() == 4);
+    REQUIRE(memory.allocated() == 175);
+
+    // Allocate from the heap when the reserved memory region is exhausted
+    void* overflow = memory.malloc(memory.capacity());
+    REQUIRE(overflow != nullptr);
+    REQUIRE(!memory.owns(overflow));
+
+    memory.free(overflow, memory.capacity());
+    memory.free(block3, 8);
+    memory.free(block2, 64);
+    memory.free(block1, 3);
+    memory.free(heap, 100);
+    REQUIRE(memory.allocations() == 0);
+    REQUIRE(memory.allocated() == 0);
+}
+
+TEST_CASE("Market manager reserve", "[CppTrader][Matching]")
+{
+    const uint32_t symbols = 8;
+
+    MarketManager market;
+    MarketManager reserved;
+    reserved.Reserve(symbols, symbols, 1000, 10000, true);
+    REQUIRE(reserved.memory_manager().capacity() >= (1000 * sizeof(LevelNode) + 10000 * sizeof(OrderNode)));
+    REQUIRE(reserved.symbols().capacity() >= symbols);
+    REQUIRE(reserved.order_books().capacity() >= symbols);
+
+    std::vector<MarketManager*> markets = { &market, &reserved };
+    for (auto target : markets)
+    {
+        for (uint32_t i = 0; i < symbols; ++i)
+        {
+            Symbol symbol(i, "test");
+            REQUIRE(target->AddSymbol(symbol) == ErrorCode::OK);
+            REQUIRE(target->AddOrderBook(symbol) == ErrorCode::OK);
+        }
+        target->EnableMatching();
+    }
+
+    // Reserved market manager must work as the usual one
+    std::mt19937 random(42);
+    std::vector<uint64_t> active;
+    uint64_t next_id = 1;
+    for (int i = 0; i < 20000; ++i)
+    {
+        if (((random() % 3) != 0) || active.empty())
+        {
+            uint64_t id = next_id++;
+            uint32_t symbol = random() % symbols;
+            OrderSide side = (random() % 2) ? OrderSide::BUY : OrderSide::SELL;
+            Order order = Order::Limit(id, symbol, side, 100 + random() % 100, 1 + random() % 100);
+            for (auto target : markets)
+                REQUIRE(target->AddOrder(order) == ErrorCode::OK);
+            active.push_back(id);
+        }
+        else
+        {
+            uint64_t id = active[random() % active.size()];
+            for (auto target : markets)
+                REQUIRE(target->DeleteOrder(id) == ErrorCode::OK);
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+            if (market.GetOrder(active[j]) == nullptr)
+                active.erase(active.begin() + j);
+    }
+
+    REQUIRE(reserved.orders().size() == market.orders().size());
+    for (uint32_t i = 0; i < symbols; ++i)
+        REQUIRE(DumpBook(*reserved.GetOrderBook(i)) == DumpBook(*market.GetOrderBook(i)));
+}
@@ -0,0 +1,165 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace CppTrader::Matching;
+
+namespace {
+
+class TradeMarketHandler : public MarketHandler
+{
+public:
+    TradeMarketHandler() : _last_price(0) {}
+
+    uint64_t last_price() const { return _last_price; }
+
+protected:
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { _last_price = price; }
+
+private:
+    uint64_t _last_price;
+};
+
+} // namespace
+
+TEST_CASE("Top of the book publisher", "[CppTrader][Matching]")
+{
+    TopOfBookPublisher publisher;
+
+    TopOfBook top;
+    REQUIRE(publisher.TryRead(top));
+    REQUIRE(top.Sequence == 0);
+    REQUIRE(top.BidPrice == 0);
+    REQUIRE(top.AskPrice == 0);
+
+    publisher.Publish(100, 10, 110, 20, 105);
+    publisher.Publish(101, 11, 109, 21, 106);
+    REQUIRE(publisher.sequence() == 2);
+
+    top = publisher.Read();
+    REQUIRE(top.Sequence == 2);
+    REQUIRE(top.BidPrice == 101);
+    REQUIRE(top.BidVolume == 11);
+    REQUIRE(top.AskPrice == 109);
+    REQUIRE(top.AskVolume == 21);
+    REQUIRE(top.LastPrice == 106);
+}
+
+TEST_CASE("Top of the book concurrent readers", "[CppTrader][Matching]")
+{
+    const uint64_t publications = 200000;
+
+    TopOfBookPublisher publisher;
+    std::atomic<bool> done(false);
+    std::atomic<size_t> torn(0);
+
+    // Readers check the invariant between fields of each publication
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 2; ++i)
+    {
+        readers.emplace_back([&]()
+        {
+            uint64_t sequence = 0;
+            while (!done.load(std::memory_order_acquire))
+            {
+                // Nothing is published yet
+                TopOfBook top = publisher.Read();
+                if (top.Sequence == 0)
+                    continue;
+                if ((top.BidVolume != top.BidPrice * 2) || (top.AskPrice != top.BidPrice + 1) || (top.AskVolume != top.BidPrice * 3) || (top.LastPrice != top.BidPrice) || (top.Sequence < sequence))
+                    ++torn;
+                sequence = top.Sequence;
+            }
+        });
+    }
+
+    for (uint64_t i = 1; i <= publications; ++i)
+        publisher.Publish(i, i * 2, i + 1, i * 3, i);
+    done = true;
+
+    for (auto& reader : readers)
+        reader.join();
+
+    REQUIRE(torn == 0);
+    REQUIRE(publisher.sequence() == publications);
+    REQUIRE(publisher.Read().BidPrice == publications);
+}
+
+TEST_CASE("Market manager top of the book", "[CppTrader][Matching]")
+{
+    const uint32_t symbols = 4;
+
+    TradeMarketHandler market_handler;
+    MarketManager market(market_handler);
+    market.EnableTopOfBook();
+    market.EnableMatching();
+
+    for (uint32_t i = 0; i < symbols; ++i)
+    {
+        Symbol symbol(i, "test");
+        REQUIRE(market.AddSymbol(symbol) == ErrorCode::OK);
+        REQUIRE(market.AddOrderBook(symbol) == ErrorCode::OK);
+        REQUIRE(market.GetOrderBook(i)->IsTopOfBookEnabled());
+    }
+
+    std::mt19937 random(42);
+    std::vector<uint64_t> last_prices(symbols, 0);
+    uint64_t next_id = 1;
+    for (int i = 0; i < 20000; ++i)
+    {
+        uint32_t symbol = random() % symbols;
+        uint64_t id = 1 + random() % next_id;
+        switch (random() % 4)
+        {
+            case 0:
+                market.DeleteOrder(id);
+                break;
+            case 1:
+                market.ReduceOrder(id, 1 + random() % 10);
+                break;
+            default:
+            {
+                OrderSide side = (random() % 2) ? OrderSide::BUY : OrderSide::SELL;
+                market.AddOrder(Order::Limit(next_id++, symbol, side, 100 + random() % 50, 1 + random() % 100));
+                break;
+            }
+        }
+
+        // Published top of the book must match the order book best price levels
+        const OrderBook* order_book_ptr = market.GetOrderBook(symbol);
+        TopOfBook top = order_book_ptr->top_of_book().Read();
+        REQUIRE(top.BidPrice == ((order_book_ptr->best_bid() != nullptr) ? order_book_ptr->best_bid()->Price : 0));
+        REQUIRE(top.BidVolume == ((order_book_ptr->best_bid() != nullptr) ? order_book_ptr->best_bid()->TotalVolume : 0));
+        REQUIRE(top.AskPrice == ((order_book_ptr->best_ask() != nullptr) ? order_book_ptr->best_ask()->Price : 0));
+        REQUIRE(top.AskVolume == ((order_book_ptr->best_ask() != nullptr) ? order_book_ptr->best_ask()->TotalVolume : 0));
+    }
+
+    // Last trade price of the book with the latest execution
+    uint64_t id = next_id++;
+    REQUIRE(market.AddOrder(Order::Limit(id, 0, OrderSide::BUY, 10, 5)) == ErrorCode::OK);
+    uint64_t sequence = market.GetOrderBook(0)->top_of_book().sequence();
+    REQUIRE(market.ExecuteOrder(id, 7, 1) == ErrorCode::OK);
+    TopOfBook top = market.GetOrderBook(0)->top_of_book().Read();
+    REQUIRE(top.LastPrice == 7);
+    REQUIRE(top.LastPrice == market_handler.last_price());
+
+    // Each execution is published once
+    REQUIRE(top.Sequence == (sequence + 1));
+    const OrderBook* order_book_ptr = market.GetOrderBook(0);
+    REQUIRE(order_book_ptr->best_bid() != nullptr);
+    const OrderNode* best_ptr = order_book_ptr->best_bid()->OrderList.front();
+    REQUIRE(market.ExecuteOrder(best_ptr->Id, best_ptr->Price, best_ptr->LeavesQuantity) == ErrorCode::OK);
+    top = order_book_ptr->top_of_book().Read();
+    REQUIRE(top.Sequence == (sequence + 2));
+    REQUIRE(top.BidPrice == ((order_book_ptr->best_bid() != nullptr) ? order_book_ptr->best_bid()->Price : 0));
+    REQUIRE(top.BidVolume == ((order_book_ptr->best_bid() != nullptr) ? order_book_ptr->best_bid()->TotalVolume : 0));
+}
@@ -0,0 +1,216 @@
+//
+// Created by Ivan Shynkarenka on 16.10.2026
+//
+
+#include "test.h"
+
+#include "trader/matching/market_manager.h"
+
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace CppCommon;
+using namespace CppTrader::Matching;
+
+namespace {
+
+class VolumeMarketHandler : public MarketHandler
+{
+public:
+    VolumeMarketHandler() : _executions(0), _volume(0) {}
+
+    size_t executions() const { return _executions; }
+    uint64_t volume() const { return _volume; }
+
+protected:
+    void onExecuteOrder(const Order& order, uint64_t price, uint64_t quantity) override { ++_executions; _volume += quantity; }
+
+private:
+    size_t _executions;
+    uint64_t _volume;
+};
+
+std::vector<uint64_t> DumpBook(const OrderBook& order_book)
+{
+    std::vector<uint64_t> result;
+    for (const LevelNode* level_ptr = order_book.best_bid(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        result.insert(result.end(), { level_ptr->Price, level_ptr->TotalVolume, level_ptr->Orders });
+    result.push_back(0);
+    for (const LevelNode* level_ptr = order_book.best_ask(); level_ptr != nullptr; level_ptr = order_book.GetNextLevel(level_ptr))
+        result.insert(result.end(), { level_ptr->Price, level_ptr->TotalVolume, level_ptr->Orders });
+    return result;
+}
+
+} // namespace
+
+TEST_CASE("Volume index", "[CppTrader][Matching]")
+{
+    VolumeIndex index;
+    REQUIRE(index.empty());
+    REQUIRE(index.Below(std::numeric_limits<uint64_t>::max()) == 0);
+    REQUIRE(index.Above(0) == 0);
+
+    // Extreme prices
+    index.Add(0, 5);
+    index.Add(std::numeric_limits<uint64_t>::max(), 7);
+    REQUIRE(index.total() == 12);
+    REQUIRE(index.Below(0) == 5);
+    REQUIRE(index.Above(0) == 12);
+    REQUIRE(index.Below(std::numeric_limits<uint64_t>::max() - 1) == 5);
+    REQUIRE(index.Above(std::numeric_limits<uint64_t>::max()) == 7);
+    index.Subtract(0, 5);
+    index.Subtract(std::numeric_limits<uint64_t>::max(), 7);
+    REQUIRE(index.empty());
+
+    // Compare with the ordered map of price volumes
+    std::mt19937 random(42);
+    std::map<uint64_t, uint64_t> volumes;
+    for (int i = 0; i < 20000; ++i)
+    {
+        uint64_t price = (random() % 2) ? (100000 + random() % 1000) : ((uint64_t)random() << 20);
+        if ((random() % 3) || volumes.empty())
+        {
+            uint64_t volume = 1 + random() % 100;
+            index.Add(price, volume);
+            volumes[price] += volume;
+        }
+        else
+        {
+            auto it = volumes.begin();
+            std::advance(it, random() % volumes.size());
+            uint64_t volume = 1 + random() % it->second;
+            index.Subtract(it->first, volume);
+            if ((it->second -= volume) == 0)
+                volumes.erase(it);
+        }
+
+        uint64_t query = (random() % 2) ? (100000 + random() % 1000) : ((uint64_t)random() << 20);
+        uint64_t below = 0;
+        uint64_t above = 0;
+        uint64_t total = 0;
+        for (const auto& volume : volumes)
+        {
+            if (volume.first <= query)
+                below += volume.second;
+            if (volume.first >= query)
+                above += volume.second;
+            total += volume.second;
+        }
+        REQUIRE(index.total() == total);
+        REQUIRE(index.Below(query) == below);
+        REQUIRE(index.Above(query) == above);
+    }
+
+    index.Clear();
+    REQUIRE(index.empty());
+    REQUIRE(index.Below(100500) == 0);
+}
+
+TEST_CASE("Market manager volume index", "[CppTrader][Matching]")
+{
+    VolumeMarketHandler handler;
+    VolumeMarketHandler indexed_handler;
+    MarketManager market(handler);
+    MarketManager indexed(indexed_handler);
+    indexed.EnableVolumeIndex();
+    indexed.EnablePriceLadder(1, 64);
+    REQUIRE(indexed.IsVolumeIndexEnabled());
+
+    std::vector<MarketManager*> markets = { &market, &indexed };
+    Symbol symbol(0, "test");
+    for (auto target : markets)
+    {
+        REQUIRE(target->AddSymbol(symbol) == ErrorCode::OK);
+        REQUIRE(target->AddOrderBook(symbol) == ErrorCode::OK);
+        target->EnableMatching();
+    }
+    REQUIRE(indexed.GetOrderBook(0)->IsVolumeIndexEnabled());
+
+    std::mt19937 random(42);
+    std::vector<uint64_t> active;
+    uint64_t next_id = 1;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        int action = random() % 10;
+        if ((action < 6) || active.empty())
+        {
+            uint64_t id = next_id++;
+            OrderSide side = (random() % 2) ? OrderSide::BUY : OrderSide::SELL;
+            uint64_t price = 100 + random() % 40;
+            uint64_t quantity = 1 + random() % 100;
+            Order order;
+            switch (random() % 8)
+            {
+                case 0:
+                    order = Order::Limit(id, 0, side, price, quantity * 10, OrderTimeInForce::FOK);
+                    break;
+                case 1:
+                    order = Order::Limit(id, 0, side, price, quantity, OrderTimeInForce::AON);
+                    break;
+                case 2:
+                    order = Order::Market(id, 0, side, quantity * 10, random() % 10);
+                    order.TimeInForce = OrderTimeInForce::FOK;
+                    break;
+                default:
+                    order = Order::Limit(id, 0, side, price, quantity);
+                    break;
+            }
+            for (auto target : markets)
+                REQUIRE(target->AddOrder(order) == ErrorCode::OK);
+            active.push_back(id);
+        }
+        else
+        {
+            uint64_t id = active[random() % active.size()];
+            uint64_t quantity = 1 + random() % 20;
+            for (auto target : markets)
+            {
+                if (action < 8)
+                    REQUIRE(target->ReduceOrder(id, quantity) == ErrorCode::OK);
+                else
+                    REQUIRE(target->DeleteOrder(id) == ErrorCode::OK);
+            }
+        }
+
+        // Forget filled and deleted orders
+        for (size_t j = active.size(); j-- > 0;)
+            if (market.GetOrder(active[j]) == nullptr)
+                active.erase(active.begin() + j);
+
+        // Volume index must match price levels volumes
+        const OrderBook* order_book = market.GetOrderBook(0);
+        const OrderBook* indexed_book = indexed.GetOrderBook(0);
+        uint64_t price = 95 + random() % 50;
+        REQUIRE(indexed_book->GetBidVolume(price) == order_book->GetBidVolume(price));
+        REQUIRE(indexed_book->GetAskVolume(price) == order_book->GetAskVolume(price));
+    }
+
+    // Rejected 'Fill-Or-Kill' orders must not change the matching results
+    REQUIRE(handler.executions() > 0);
+    REQUIRE(indexed_handler.executions() == handler.executions());
+    REQUIRE(indexed_handler.volume() == handler.volume());
+    REQUIRE(DumpBook(*indexed.GetOrderBook(0)) == DumpBook(*market.GetOrderBook(0)));
+
+    // Volume index must be restored from the market snapshot
+    std::vector<uint8_t> snapshot;
+    class MemoryWriter : public Writer
+    {
+    public:
+        explicit MemoryWriter(std::vector<uint8_t>& buffer) : _buffer(buffer) {}
+        size_t Write(const void* buffer, size_t size) override { _buffer.insert(_buffer.end(), (const uint8_t*)buffer, (const uint8_t*)buffer + size); return size; }
+    private:
+        std::vector<uint8_t>& _buffer;
+    } writer(snapshot);
+    REQUIRE(market.SaveSnapshot(writer) == ErrorCode::OK);
+    MarketManager restored;
+    restored.EnableVolumeIndex();
+    REQUIRE(restored.LoadSnapshot(snapshot.data(), snapshot.size()) == ErrorCode::OK);
+    for (uint64_t price = 95; price < 145; ++price)
+    {
+        REQUIRE(restored.GetOrderBook(0)->GetBidVolume(price) == market.GetOrderBook(0)->GetBidVolume(price));
+        REQUIRE(restored.GetOrderBook(0)->GetAskVolume(price) == market.GetOrderBook(0)->GetAskVolume(price));
+    }
+}